@@ -1132,6 +1132,7 @@ public:
 
 
 	TObjPtr<AInventory>	Inventory;		// [RH] This actor's inventory
+	TObjPtr<AInventory>	LastFoundInventory;	// one-entry cache for FindInventory; not serialized
 	DWORD			InventoryID;	// A unique ID to keep track of inventory items
 
 	BYTE smokecounter;
@@ -786,6 +786,7 @@ static double mapxstart=0; //x-value for the bitmap.
 static bool stopped = true;
 
 static void AM_calcMinMaxMtoF();
+static void AM_clearLineState();
 
 static void DrawMarker (FTexture *tex, double x, double y, int yadjust,
 	INTBOOL flip, double xscale, double yscale, int translation, double alpha, DWORD fillcolor, FRenderStyle renderstyle);
@@ -1329,6 +1330,7 @@ void AM_LevelInit ()
 	}
 
 	AM_clearMarks();
+	AM_clearLineState();
 
 	AM_findMinMaxBoundaries();
 	scale_mtof = min_scale_mtof / 0.7;
@@ -2368,6 +2370,95 @@ bool AM_isLockBoundary (line_t &line, int *lockptr = NULL)
 	return result;
 }
 
+//=============================================================================
+//
+// Classifying a line means walking special info, sector action chains and
+// 3D floor lists, and polyobject lines even need a BSP lookup to find their
+// portal group. None of that can change outside a gametic, but with an
+// uncapped framerate AM_drawWalls used to redo it for every frame - and
+// with portal overlays once per portal group on top of that. The results
+// are cached lazily here and reused until the next gametic.
+//
+//=============================================================================
+
+enum
+{
+	AMLS_Teleport,
+	AMLS_Exit,
+	AMLS_Trigger,
+	AMLS_Lock,
+	AMLS_3DFloor,
+	AMLS_PortalGroup,
+};
+
+struct AMLineState
+{
+	WORD known, flags;
+	int lock;
+	int portalgroup;
+};
+
+static TArray<AMLineState> am_linestate;
+static int am_linestatetic = -1;
+
+static void AM_clearLineState ()
+{
+	am_linestatetic = -1;
+}
+
+static AMLineState &AM_lineState (int i)
+{
+	if (am_linestatetic != gametic || am_linestate.Size() != (unsigned)numlines)
+	{
+		am_linestatetic = gametic;
+		am_linestate.Resize(numlines);
+		if (numlines > 0) memset(&am_linestate[0], 0, numlines * sizeof(AMLineState));
+	}
+	return am_linestate[i];
+}
+
+static bool AM_lineFlag (int i, int which)
+{
+	AMLineState &state = AM_lineState(i);
+	WORD bit = WORD(1 << which);
+
+	if (!(state.known & bit))
+	{
+		bool result = false;
+		switch (which)
+		{
+		case AMLS_Teleport:	result = AM_isTeleportBoundary(lines[i]); break;
+		case AMLS_Exit:		result = AM_isExitBoundary(lines[i]); break;
+		case AMLS_Trigger:	result = AM_isTriggerBoundary(lines[i]); break;
+		case AMLS_Lock:		result = AM_isLockBoundary(lines[i], &state.lock); break;
+		case AMLS_3DFloor:	result = AM_Check3DFloors(&lines[i]); break;
+		}
+		state.known |= bit;
+		if (result) state.flags |= bit;
+	}
+	return !!(state.flags & bit);
+}
+
+static int AM_linePortalGroup (int i)
+{
+	AMLineState &state = AM_lineState(i);
+
+	if (!(state.known & (1 << AMLS_PortalGroup)))
+	{
+		if (lines[i].sidedef[0]->Flags & WALLF_POLYOBJ)
+		{
+			// For polyobjects we must test the surrounding sector to get the proper group.
+			state.portalgroup = P_PointInSector(lines[i].v1->fX() + lines[i].Delta().X / 2, lines[i].v1->fY() + lines[i].Delta().Y / 2)->PortalGroup;
+		}
+		else
+		{
+			state.portalgroup = lines[i].frontsector->PortalGroup;
+		}
+		state.known |= 1 << AMLS_PortalGroup;
+	}
+	return state.portalgroup;
+}
+
 //=============================================================================
 //
 // Determines visible lines, draws them.
@@ -2390,17 +2481,7 @@ void AM_drawWalls (bool allmap)
 
 		for (i = 0; i < numlines; i++)
 		{
-			int pg;
-			
-			if (lines[i].sidedef[0]->Flags & WALLF_POLYOBJ)
-			{
-				// For polyobjects we must test the surrounding sector to get the proper group.
-				pg = P_PointInSector(lines[i].v1->fX() + lines[i].Delta().X / 2, lines[i].v1->fY() + lines[i].Delta().Y / 2)->PortalGroup;
-			}
-			else
-			{
-				pg = lines[i].frontsector->PortalGroup;
-			}
+			int pg = AM_linePortalGroup(i);
 			DVector2 offset;
 			bool portalmode = numportalgroups > 0 &&  pg != MapPortalGroup;
 			if (pg == p)
@@ -2450,16 +2531,17 @@ void AM_drawWalls (bool allmap)
 					else
 						AM_drawMline(&l, AMColors.WallColor);
 				}
-				else if (AM_isTeleportBoundary(lines[i]) && AMColors.isValid(AMColors.IntraTeleportColor))
+				else if (AM_lineFlag(i, AMLS_Teleport) && AMColors.isValid(AMColors.IntraTeleportColor))
 				{ // intra-level teleporters
 					AM_drawMline(&l, AMColors.IntraTeleportColor);
 				}
-				else if (AM_isExitBoundary(lines[i]) && AMColors.isValid(AMColors.InterTeleportColor))
+				else if (AM_lineFlag(i, AMLS_Exit) && AMColors.isValid(AMColors.InterTeleportColor))
 				{ // inter-level/game-ending teleporters
 					AM_drawMline(&l, AMColors.InterTeleportColor);
 				}
-				else if (AM_isLockBoundary(lines[i], &lock))
+				else if (AM_lineFlag(i, AMLS_Lock))
 				{
+					lock = AM_lineState(i).lock;
 					if (AMColors.displayLocks)
 					{
 						color = P_GetMapColorForLock(lock);
@@ -2478,7 +2560,7 @@ void AM_drawWalls (bool allmap)
 				}
 				else if (am_showtriggerlines
 					&& AMColors.isValid(AMColors.SpecialWallColor)
-					&& AM_isTriggerBoundary(lines[i]))
+					&& AM_lineFlag(i, AMLS_Trigger))
 				{
 					AM_drawMline(&l, AMColors.SpecialWallColor);	// wall with special non-door action the player can do
 				}
@@ -2496,7 +2578,7 @@ void AM_drawWalls (bool allmap)
 				{
 					AM_drawMline(&l, AMColors.CDWallColor); // ceiling level change
 				}
-				else if (AM_Check3DFloors(&lines[i]))
+				else if (AM_lineFlag(i, AMLS_3DFloor))
 				{
 					AM_drawMline(&l, AMColors.EFWallColor); // Extra floor border
 				}
@@ -53,6 +53,9 @@ void DBot::Clear ()
 	allround = false;
 	increase = false;
 	old = { 0, 0 };
+	reach_target = NULL;
+	reach_result = false;
+	reach_tic = -1;
 }
 
 FSerializer &Serialize(FSerializer &arc, const char *key, botskill_t &skill, botskill_t *def)
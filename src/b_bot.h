@@ -183,6 +183,14 @@ public:
 
 	DVector2	old;
 
+	// Per-tic memo for Reachable (b_func.cpp). The move code asks about the
+	// same destination the think code just traced, so remember the last
+	// answer for the duration of the tic. The target pointer is only ever
+	// compared, never dereferenced, so it needs no GC barrier.
+	AActor		*reach_target;
+	bool		reach_result;
+	int			reach_tic;
+
 private:
 	//(b_think.cpp)
 	void Think ();
@@ -191,6 +199,7 @@ private:
 
 	//(b_func.cpp)
 	bool Reachable (AActor *target);
+	bool TraceReachable (AActor *target);
 	void Dofire (ticcmd_t *cmd);
 	AActor *Choose_Mate ();
 	AActor *Find_enemy ();
@@ -29,7 +29,21 @@ static FRandom pr_botdofire ("BotDoFire");
 
 
 //Checks TRUE reachability from bot to a looker.
+//Nothing moves between the think and move phases of a bot's tic, so the
+//same question about the same target gives the same answer and the
+//traversal only needs to run once per target and tic.
 bool DBot::Reachable (AActor *rtarget)
+{
+	if (reach_tic == level.maptime && reach_target == rtarget)
+		return reach_result;
+
+	reach_tic = level.maptime;
+	reach_target = rtarget;
+	reach_result = TraceReachable (rtarget);
+	return reach_result;
+}
+
+bool DBot::TraceReachable (AActor *rtarget)
 {
 	if (player->mo == rtarget)
 		return false;
@@ -1219,7 +1219,7 @@ void C_DrawConsole (bool hw2d)
 	if (lines > 0)
 	{
 		// No more enqueuing because adding new text to the console won't touch the actual print data.
-		conbuffer->FormatText(ConFont, ConWidth / textScale);
+		conbuffer->FormatText(ConFont, ConWidth / textScale, RowAdjust + lines);
 		unsigned int consolelines = conbuffer->GetFormattedLineCount();
 		FBrokenLines **blines = conbuffer->GetLines();
 		FBrokenLines **printline = blines + consolelines - 1 - RowAdjust;
@@ -1415,6 +1415,7 @@ static bool C_HandleKey (event_t *ev, FCommandBuffer &buffer)
 		case GK_HOME:
 			if (ev->data3 & GKM_CTRL)
 			{ // Move to top of console buffer
+				conbuffer->EnsureAllFormatted();
 				RowAdjust = conbuffer->GetFormattedLineCount();
 			}
 			else
@@ -35,6 +35,7 @@
 
 #include "c_console.h"
 #include "c_consolebuffer.h"
+#include "templates.h"
 
 
 //==========================================================================
@@ -47,6 +48,7 @@ FConsoleBuffer::FConsoleBuffer()
 {
 	mLogFile = NULL;
 	mAddType = NEWLINE;
+	mFormatStart = 0;
 	mLastFont = NULL;
 	mLastDisplayWidth = -1;
 	mLastLineNeedsUpdate = false;
@@ -254,9 +256,14 @@ void FConsoleBuffer::AddMidText(const char *string, bool bold, FILE *Logfile)
 //
 // Format the text for output
 //
+// Only the lines that can actually appear on screen get broken up: the
+// minrows newest rows, plus whatever was already formatted. When the font
+// or the display width changes the old result is merely thrown away, not
+// recomputed wholesale, so resizing no longer stalls on large buffers.
+//
 //==========================================================================
 
-void FConsoleBuffer::FormatText(FFont *formatfont, int displaywidth)
+void FConsoleBuffer::FormatText(FFont *formatfont, int displaywidth, unsigned minrows)
 {
 	if (formatfont != mLastFont || displaywidth != mLastDisplayWidth || mBufferWasCleared)
 	{
@@ -265,16 +272,17 @@ void FConsoleBuffer::FormatText(FFont *formatfont, int displaywidth)
 		mBrokenStart.Clear();
 		mBrokenStart.Push(0);
 		mBrokenLines.Clear();
+		mFormatStart = mConsoleText.Size();
 		mLastFont = formatfont;
 		mLastDisplayWidth = displaywidth;
 		mBufferWasCleared = false;
 	}
 	unsigned brokensize = mBrokenConsoleText.Size();
-	if (brokensize == mConsoleText.Size())
+	if (mFormatStart + brokensize == mConsoleText.Size())
 	{
 		// The last line got text appended. We have to wait until here to format it because
 		// it is possible that during display new text will be added from the NetUpdate calls in the software version of DrawTextureV.
-		if (mLastLineNeedsUpdate)
+		if (mLastLineNeedsUpdate && brokensize > 0)
 		{
 			brokensize--;
 			V_FreeBrokenLines(mBrokenConsoleText[brokensize]);
@@ -283,7 +291,7 @@ void FConsoleBuffer::FormatText(FFont *formatfont, int displaywidth)
 	}
 	mBrokenLines.Resize(mBrokenStart[brokensize]);
 	mBrokenStart.Resize(brokensize);
-	for (unsigned i = brokensize; i < mConsoleText.Size(); i++)
+	for (unsigned i = mFormatStart + brokensize; i < mConsoleText.Size(); i++)
 	{
 		FBrokenLines *bl = V_BreakLines(formatfont, displaywidth, mConsoleText[i], true);
 		mBrokenConsoleText.Push(bl);
@@ -297,6 +305,77 @@ void FConsoleBuffer::FormatText(FFont *formatfont, int displaywidth)
 	mTextLines = mBrokenLines.Size();
 	mBrokenStart.Push(mTextLines);
 	mLastLineNeedsUpdate = false;
+	if ((unsigned)mTextLines < minrows)
+	{
+		FormatBackwards(minrows);
+	}
+}
+
+//==========================================================================
+//
+// Extends the formatted region towards the start of the buffer until at
+// least minrows rows exist or everything has been broken up. Grows by at
+// least the already formatted amount per step, so scrolling backwards
+// through the entire buffer splices each old entry only O(log n) times.
+//
+//==========================================================================
+
+void FConsoleBuffer::FormatBackwards(unsigned minrows)
+{
+	while (mBrokenLines.Size() < minrows && mFormatStart > 0)
+	{
+		unsigned chunk = MAX(minrows == UINT_MAX ? mFormatStart : minrows - mBrokenLines.Size(), mBrokenConsoleText.Size());
+		TArray<FBrokenLines *> text, lines;
+		TArray<unsigned int> starts;
+
+		chunk = MIN(chunk, mFormatStart);
+		for (unsigned i = mFormatStart - chunk; i < mFormatStart; i++)
+		{
+			FBrokenLines *bl = V_BreakLines(mLastFont, mLastDisplayWidth, mConsoleText[i], true);
+			text.Push(bl);
+			starts.Push(lines.Size());
+			while (bl->Width != -1)
+			{
+				lines.Push(bl);
+				bl++;
+			}
+		}
+
+		// Splice the previously formatted lines behind the new ones.
+		unsigned base = lines.Size();
+		for (unsigned i = 0; i < mBrokenConsoleText.Size(); i++)
+		{
+			text.Push(mBrokenConsoleText[i]);
+		}
+		for (unsigned i = 0; i < mBrokenStart.Size(); i++)
+		{
+			starts.Push(mBrokenStart[i] + base);
+		}
+		for (unsigned i = 0; i < mBrokenLines.Size(); i++)
+		{
+			lines.Push(mBrokenLines[i]);
+		}
+		mBrokenConsoleText = text;
+		mBrokenStart = starts;
+		mBrokenLines = lines;
+		mFormatStart -= chunk;
+	}
+	mTextLines = mBrokenLines.Size();
+}
+
+//==========================================================================
+//
+// For operations that need the true total line count, like jumping to the
+// top of the buffer.
+//
+//==========================================================================
+
+void FConsoleBuffer::EnsureAllFormatted()
+{
+	if (mLastFont != NULL && !mBufferWasCleared)
+	{
+		FormatBackwards(UINT_MAX);
+	}
 }
 
 //==========================================================================
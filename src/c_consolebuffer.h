@@ -49,29 +49,35 @@ enum EAddType
 class FConsoleBuffer
 {
 	TArray<FString> mConsoleText;
+	// The broken arrays only cover the source lines from mFormatStart up, i.e. the
+	// part of the buffer that has actually been looked at since the last font or
+	// width change. Older lines are broken on demand when scrolling reaches them.
 	TArray<FBrokenLines *> mBrokenConsoleText;	// This holds the structures returned by V_BreakLines and is used for memory management.
-	TArray<unsigned int> mBrokenStart;		
+	TArray<unsigned int> mBrokenStart;
 	TArray<FBrokenLines *> mBrokenLines;		// This holds the single lines, indexed by mBrokenStart and is used for printing.
 	FILE * mLogFile;
 	EAddType mAddType;
 	int mTextLines;
 	bool mBufferWasCleared;
-	
+
+	unsigned mFormatStart;
 	FFont *mLastFont;
 	int mLastDisplayWidth;
 	bool mLastLineNeedsUpdate;
 
 	void WriteLineToLog(FILE *LogFile, const char *outline);
 	void FreeBrokenText(unsigned int start = 0, unsigned int end = INT_MAX);
+	void FormatBackwards(unsigned minrows);
 
 	void Linefeed(FILE *Logfile);
-	
+
 public:
 	FConsoleBuffer();
 	~FConsoleBuffer();
 	void AddText(int printlevel, const char *string, FILE *logfile = NULL);
 	void AddMidText(const char *string, bool bold, FILE *logfile);
-	void FormatText(FFont *formatfont, int displaywidth);
+	void FormatText(FFont *formatfont, int displaywidth, unsigned minrows = UINT_MAX);
+	void EnsureAllFormatted();
 	void ResizeBuffer(unsigned newsize);
 	void WriteContentToLog(FILE *logfile);
 	void Clear()
@@ -48,6 +48,7 @@
 FColorMatcher::FColorMatcher ()
 {
 	Pal = NULL;
+	memset (CacheKey, 0xFF, sizeof(CacheKey));
 }
 
 FColorMatcher::FColorMatcher (const DWORD *palette)
@@ -63,12 +64,15 @@ FColorMatcher::FColorMatcher (const FColorMatcher &other)
 FColorMatcher &FColorMatcher::operator= (const FColorMatcher &other)
 {
 	Pal = other.Pal;
+	memcpy (CacheKey, other.CacheKey, sizeof(CacheKey));
+	memcpy (CacheValue, other.CacheValue, sizeof(CacheValue));
 	return *this;
 }
 
 void FColorMatcher::SetPalette (const DWORD *palette)
 {
 	Pal = (const PalEntry *)palette;
+	memset (CacheKey, 0xFF, sizeof(CacheKey));
 }
 
 BYTE FColorMatcher::Pick (int r, int g, int b)
@@ -76,5 +80,18 @@ BYTE FColorMatcher::Pick (int r, int g, int b)
 	if (Pal == NULL)
 		return 1;
 
-	return (BYTE)BestColor ((uint32 *)Pal, r, g, b);
+	// Remapping a texture or building a translation asks for the same few
+	// colors over and over again, so remember recent results in a small
+	// direct mapped cache instead of running the full 256 entry search
+	// for every request.
+	DWORD color = (r << 16) | (g << 8) | b;
+	int slot = (color ^ (color >> 11) ^ (color >> 22)) & (CACHE_SIZE - 1);
+
+	if (CacheKey[slot] == color)
+		return CacheValue[slot];
+
+	BYTE best = (BYTE)BestColor ((uint32 *)Pal, r, g, b);
+	CacheKey[slot] = color;
+	CacheValue[slot] = best;
+	return best;
 }
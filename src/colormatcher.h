@@ -51,7 +51,11 @@ public:
 	FColorMatcher &operator= (const FColorMatcher &other);
 
 private:
+	enum { CACHE_SIZE = 4096 };		// must be a power of 2
+
 	const PalEntry *Pal;
+	DWORD CacheKey[CACHE_SIZE];		// color in the low 24 bits, 0xFFFFFFFF if the slot is empty
+	BYTE CacheValue[CACHE_SIZE];
 };
 
 extern FColorMatcher ColorMatcher;
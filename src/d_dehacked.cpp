@@ -115,6 +115,9 @@ struct StateMapper
 
 static TArray<StateMapper> StateMap;
 
+// One entry per original state number, built on demand from StateMap.
+static TArray<StateMapper> FlatStateMap;
+
 // Sound equivalences. When a patch tries to change a sound,
 // use these sound names.
 static TArray<FSoundID> SoundMap;
@@ -419,29 +422,35 @@ static int FindSprite (const char *sprname)
 
 static FState *FindState (int statenum)
 {
-	int stateacc;
-	unsigned i;
-
-	if (statenum == 0)
+	if (statenum <= 0)
 		return NULL;
 
-	for (i = 0, stateacc = 1; i < StateMap.Size(); i++)
+	if (FlatStateMap.Size() == 0)
 	{
-		if (stateacc <= statenum && stateacc + StateMap[i].StateSpan > statenum)
+		// Expand the span compressed StateMap into one entry per original
+		// state number, so that each lookup is a plain array index instead
+		// of a scan over all spans. Patches resolve states constantly, and
+		// servers that chain-load many patches pay for this a lot.
+		for (unsigned i = 0; i < StateMap.Size(); i++)
 		{
-			if (StateMap[i].State != NULL)
+			for (int j = 0; j < StateMap[i].StateSpan; j++)
 			{
-				if (StateMap[i].OwnerIsPickup)
-				{
-					PushTouchedActor(StateMap[i].Owner);
-				}
-				return StateMap[i].State + statenum - stateacc;
+				StateMapper s = StateMap[i];
+				if (s.State != NULL) s.State += j;
+				FlatStateMap.Push(s);
 			}
-			else return NULL;
 		}
-		stateacc += StateMap[i].StateSpan;
 	}
-	return NULL;
+
+	if ((unsigned)statenum > FlatStateMap.Size())
+		return NULL;
+
+	const StateMapper &s = FlatStateMap[statenum - 1];
+	if (s.State != NULL && s.OwnerIsPickup)
+	{
+		PushTouchedActor(s.Owner);
+	}
+	return s.State;
 }
 
 int FindStyle (const char *namestr)
@@ -3042,6 +3051,8 @@ void FinishDehPatch ()
 	// Now that all Dehacked patches have been processed, it's okay to free StateMap.
 	StateMap.Clear();
 	StateMap.ShrinkToFit();
+	FlatStateMap.Clear();
+	FlatStateMap.ShrinkToFit();
 	TouchedActors.Clear();
 	TouchedActors.ShrinkToFit();
 
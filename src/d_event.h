@@ -118,6 +118,10 @@ typedef enum
 
 // Called by IO functions when input is detected.
 void D_PostEvent (const event_t* ev);
+
+// Input latency instrumentation hooks; see "stat latency".
+void D_LatencyBuildCmd (void);
+void D_LatencyPresent (void);
 void D_RemoveNextCharEvent();
 
 
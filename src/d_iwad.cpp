@@ -46,6 +46,7 @@
 #include "sc_man.h"
 #include "v_video.h"
 #include "gameconfigfile.h"
+#include "threadpool.h"
 #include "resourcefiles/resourcefile.h"
 #include "version.h"
 
@@ -335,24 +336,40 @@ int FIWadManager::CheckIWAD (const char *doomwaddir, WadStuff *wads)
 
 	slash = (doomwaddir[0] && doomwaddir[strlen (doomwaddir)-1] != '/') ? "/" : "";
 
-	// Search for a pre-defined IWAD
-	for (unsigned i=0; i< mIWadNames.Size(); i++)
+	// Check all candidate names for existence in one parallel pass. On
+	// network file systems the per-file checks are what makes this crawl,
+	// and they are independent of each other.
+	TArray<FString> paths;
+	TArray<BYTE> exists;
+	paths.Resize(mIWadNames.Size());
+	exists.Resize(mIWadNames.Size());
+	FThreadPool::Instance().ParallelFor((int)mIWadNames.Size(), [&](int i)
 	{
+		exists[i] = false;
 		if (mIWadNames[i].IsNotEmpty() && wads[i].Path.IsEmpty())
 		{
 			FString iwad;
-			
+
 			iwad.Format ("%s%s%s", doomwaddir, slash, mIWadNames[i].GetChars());
 			FixPathSeperator (iwad);
-			if (FileExists (iwad))
+			paths[i] = iwad;
+			exists[i] = FileExists (iwad);
+		}
+	});
+
+	// The scans share the lump check state (and may open zips, which do
+	// their own parallel setup), so they stay serial. Normally only one
+	// or two candidates actually exist.
+	for (unsigned i=0; i< mIWadNames.Size(); i++)
+	{
+		if (exists[i])
+		{
+			wads[i].Type = ScanIWAD (paths[i]);
+			if (wads[i].Type != -1)
 			{
-				wads[i].Type = ScanIWAD (iwad);
-				if (wads[i].Type != -1)
-				{
-					wads[i].Path = iwad;
-					wads[i].Name = mIWads[wads[i].Type].Name;
-					numfound++;
-				}
+				wads[i].Path = paths[i];
+				wads[i].Name = mIWads[wads[i].Type].Name;
+				numfound++;
 			}
 		}
 	}
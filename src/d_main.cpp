@@ -84,6 +84,7 @@
 #include "gi.h"
 #include "b_bot.h"		//Added by MC:
 #include "stats.h"
+#include "profiler.h"
 #include "gameconfigfile.h"
 #include "sbar.h"
 #include "decallib.h"
@@ -230,6 +231,11 @@ FStartupInfo DoomStartupInfo;
 FString lastIWAD;
 int restart = 0;
 bool batchrun;	// just run the startup and collect all error messages in a logfile, then quit without any interaction
+				// This is as close to a headless mode as the engine has. There is no
+				// dedicated server: the netcode is lockstep peer to peer, every node
+				// runs the full game including the renderer, and the playsim leans on
+				// texture and sprite metadata in too many places to compile those
+				// subsystems out behind stubs.
 
 cycle_t FrameCycles;
 
@@ -284,6 +290,85 @@ void D_ProcessEvents (void)
 	}
 }
 
+//==========================================================================
+//
+// Input latency instrumentation
+//
+// Tracks how long device input sits in the pipeline: from the moment the
+// input backend posts an event, to the ticcmd build that consumes it, to
+// the screen update that shows its effect. The samples go into power-of-
+// two millisecond histograms displayed by "stat latency", which gives
+// hard numbers for "feels laggy" reports instead of guesswork.
+//
+//==========================================================================
+
+enum
+{
+	LATENCY_Build,			// event posted -> ticcmd built
+	LATENCY_Present,		// event posted -> frame shown
+
+	NUM_LATENCY_STAGES,
+	NUM_LATENCY_BUCKETS = 8	// <4, <8, ... <256, >=256 ms
+};
+
+static unsigned int PendingInputTime;	// oldest device event not yet in a ticcmd
+static unsigned int CmdInputTime;		// that event's time for the frame being built
+static unsigned int LatencyHist[NUM_LATENCY_STAGES][NUM_LATENCY_BUCKETS];
+static unsigned int LatencyLast[NUM_LATENCY_STAGES];
+static unsigned int LatencyCount[NUM_LATENCY_STAGES];
+static QWORD LatencyTotal[NUM_LATENCY_STAGES];
+
+static void D_LatencyAddSample (int stage, unsigned int ms)
+{
+	int bucket = 0;
+	while (bucket < NUM_LATENCY_BUCKETS - 1 && ms >= (4u << bucket))
+	{
+		bucket++;
+	}
+	LatencyHist[stage][bucket]++;
+	LatencyLast[stage] = ms;
+	LatencyTotal[stage] += ms;
+	LatencyCount[stage]++;
+}
+
+void D_LatencyBuildCmd ()
+{
+	if (PendingInputTime != 0)
+	{
+		D_LatencyAddSample (LATENCY_Build, I_MSTime() - PendingInputTime);
+		CmdInputTime = PendingInputTime;
+		PendingInputTime = 0;
+	}
+}
+
+void D_LatencyPresent ()
+{
+	if (CmdInputTime != 0)
+	{
+		D_LatencyAddSample (LATENCY_Present, I_MSTime() - CmdInputTime);
+		CmdInputTime = 0;
+	}
+}
+
+ADD_STAT (latency)
+{
+	static const char *stagenames[NUM_LATENCY_STAGES] = { "tic", "show" };
+	FString out;
+
+	for (int i = 0; i < NUM_LATENCY_STAGES; ++i)
+	{
+		out.AppendFormat ("%s%s: last=%3u ms  avg=%3u ms  [",
+			i > 0 ? "\n" : "", stagenames[i], LatencyLast[i],
+			LatencyCount[i] != 0 ? (unsigned int)(LatencyTotal[i] / LatencyCount[i]) : 0);
+		for (int j = 0; j < NUM_LATENCY_BUCKETS; ++j)
+		{
+			out.AppendFormat ("%s%u", j > 0 ? " " : "", LatencyHist[i][j]);
+		}
+		out += ']';
+	}
+	return out;
+}
+
 //==========================================================================
 //
 // D_PostEvent
@@ -299,6 +384,11 @@ void D_PostEvent (const event_t *ev)
 	{
 		return;
 	}
+	if (PendingInputTime == 0 &&
+		(ev->type == EV_KeyDown || ev->type == EV_KeyUp || ev->type == EV_Mouse))
+	{
+		PendingInputTime = I_MSTime ();
+	}
 	events[eventhead] = *ev;
 	if (ev->type == EV_Mouse && !paused && menuactive == MENU_Off && ConsoleState != c_down && ConsoleState != c_falling
 		)
@@ -769,7 +859,10 @@ void D_Display ()
 			screen->SetBlendingRect(viewwindowx, viewwindowy,
 				viewwindowx + viewwidth, viewwindowy + viewheight);
 
-			Renderer->RenderView(&players[consoleplayer]);
+			{
+				PROF_ZONE ("renderview");
+				Renderer->RenderView(&players[consoleplayer]);
+			}
 
 			if ((hw2d = screen->Begin2D(viewactive)))
 			{
@@ -890,7 +983,9 @@ void D_Display ()
 		C_DrawConsole (hw2d);	// draw console
 		M_Drawer ();			// menu is drawn even on top of everything
 		FStat::PrintStat ();
+		FZoneProfiler::Draw ();
 		screen->Update ();		// page flip or blit buffer
+		D_LatencyPresent ();
 	}
 	else
 	{
@@ -988,12 +1083,15 @@ void D_DoomLoop ()
 				I_StartFrame ();
 			}
 			
+			FZoneProfiler::BeginFrame ();
+
 			// process one or more tics
 			if (singletics)
 			{
 				I_StartTic ();
 				D_ProcessEvents ();
 				G_BuildTiccmd (&netcmds[consoleplayer][maketic%BACKUPTICS]);
+				D_LatencyBuildCmd ();
 				if (advancedemo)
 					D_DoAdvanceDemo ();
 				C_Ticker ();
@@ -1008,11 +1106,23 @@ void D_DoomLoop ()
 			}
 			else
 			{
+				PROF_ZONE ("tics");
 				TryRunTics (); // will run at least one tic
 			}
 			// Update display, next frame, with current state.
+			//
+			// Ticking and drawing must stay sequential on this thread: the
+			// renderers read the live playsim objects directly (there is no
+			// snapshot of render-relevant state to hand to another thread),
+			// and the interpolation code samples them right before drawing.
+			// Overlapping the next tic with the current frame would race on
+			// every actor the view can see.
 			I_StartTic ();
-			D_Display ();
+			{
+				PROF_ZONE ("display");
+				D_Display ();
+			}
+			FZoneProfiler::EndFrame ();
 			if (wantToRestart)
 			{
 				wantToRestart = false;
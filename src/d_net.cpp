@@ -981,6 +981,7 @@ void NetUpdate (void)
 		
 		//Printf ("mk:%i ",maketic);
 		G_BuildTiccmd (&localcmds[maketic % LOCALCMDTICS]);
+		D_LatencyBuildCmd ();
 		maketic++;
 
 		if (ticdup == 1 || maketic == 0)
@@ -1065,7 +1066,9 @@ void NetUpdate (void)
 
 	if (demoplayback)
 	{
-		resendto[0] = nettics[0] = (maketic / ticdup);
+		// Pretend the tics being fast-forwarded through have already
+		// arrived, so TryRunTics does not wait out real time for them.
+		resendto[0] = nettics[0] = (maketic / ticdup) + demoskiptics;
 		return;			// Don't touch netcmd data while playing a demo, as it'll already exist.
 	}
 
@@ -1802,6 +1805,16 @@ void D_QuitNetGame (void)
 //
 // TryRunTics
 //
+// Game tics are deliberately atomic with respect to rendering: the frame
+// interpolation machinery snapshots actor state at tic boundaries, and a
+// frame rendered between two halves of a tic would see a world where some
+// thinkers have run and others have not. Spreading thinker execution in
+// slices across the frame budget would therefore need a second copy of all
+// render-visible state, not just a different scheduler, and it could never
+// be enabled in netgames or demos where the tic is the unit of lockstep.
+// The practical lever against the tic-boundary sawtooth is making the tic
+// itself cheaper.
+//
 void TryRunTics (void)
 {
 	int 		i;
@@ -1863,6 +1876,19 @@ void TryRunTics (void)
 		counts = realtics;
 	else
 		counts = availabletics;
+
+	// When fast-forwarding through a demo, run up to a second's worth of
+	// tics per pass instead of following real time; NetUpdate above has
+	// already announced them as available.
+	if (demoplayback && demoskiptics > 0)
+	{
+		counts = MIN (demoskiptics, TICRATE);
+		demoskiptics -= counts;
+		// Keep the local tic counter in step with the tics about to run,
+		// or the sanity checks below would see the game running ahead of
+		// itself once the fast-forward is over.
+		maketic += counts * ticdup;
+	}
 	
 	// Uncapped framerate needs seprate checks
 	if (counts == 0 && !doWait)
@@ -1873,8 +1899,9 @@ void TryRunTics (void)
 		{
 			C_Ticker();
 			M_Ticker();
-			// Repredict the player for new buffered movement
-			P_UnPredictPlayer();
+			// Predict forward for new buffered movement. Since no new
+			// authoritative tic has run, this only simulates the tics
+			// that arrived since the last prediction.
 			P_PredictPlayer(&players[consoleplayer]);
 		}
 		return;
@@ -1906,14 +1933,21 @@ void TryRunTics (void)
 		// Check possible stall conditions
 		Net_CheckLastReceived (counts);
 
-		// don't stay in here forever -- give the menu a chance to work
-		if (I_GetTime (false) - entertic >= 1)
+		// Don't stay in here forever. With an uncapped framerate the frame
+		// goes back to the renderer right away: a listen server must not
+		// freeze its own view just because a remote node is late. The world
+		// stays on the last completed tic and the local player keeps moving
+		// through prediction, the same as the no-new-tics case above. With
+		// a capped framerate wait out one tic so the menu keeps working.
+		if (!doWait || I_GetTime (false) - entertic >= 1)
 		{
-			C_Ticker ();
-			M_Ticker ();
-			// Repredict the player for new buffered movement
-			P_UnPredictPlayer();
-			P_PredictPlayer(&players[consoleplayer]);
+			if (realtics >= 1)
+			{
+				C_Ticker ();
+				M_Ticker ();
+				// Predict forward for new buffered movement
+				P_PredictPlayer(&players[consoleplayer]);
+			}
 			return;
 		}
 	}
@@ -180,18 +180,37 @@ int UnpackUserCmd (usercmd_t *ucmd, const usercmd_t *basis, BYTE **stream)
 			}
 			ucmd->buttons = buttons;
 		}
-		if (flags & UCMDF_PITCH)
-			ucmd->pitch = ReadWord (stream);
-		if (flags & UCMDF_YAW)
-			ucmd->yaw = ReadWord (stream);
-		if (flags & UCMDF_FORWARDMOVE)
-			ucmd->forwardmove = ReadWord (stream);
-		if (flags & UCMDF_SIDEMOVE)
-			ucmd->sidemove = ReadWord (stream);
-		if (flags & UCMDF_UPMOVE)
-			ucmd->upmove = ReadWord (stream);
-		if (flags & UCMDF_ROLL)
-			ucmd->roll = ReadWord (stream);
+		if (flags & UCMDF_SHORTDELTAS)
+		{
+			// The analog fields were sent as byte deltas from the basis.
+			if (flags & UCMDF_PITCH)
+				ucmd->pitch += (SBYTE)ReadByte (stream);
+			if (flags & UCMDF_YAW)
+				ucmd->yaw += (SBYTE)ReadByte (stream);
+			if (flags & UCMDF_FORWARDMOVE)
+				ucmd->forwardmove += (SBYTE)ReadByte (stream);
+			if (flags & UCMDF_SIDEMOVE)
+				ucmd->sidemove += (SBYTE)ReadByte (stream);
+			if (flags & UCMDF_UPMOVE)
+				ucmd->upmove += (SBYTE)ReadByte (stream);
+			if (flags & UCMDF_ROLL)
+				ucmd->roll += (SBYTE)ReadByte (stream);
+		}
+		else
+		{
+			if (flags & UCMDF_PITCH)
+				ucmd->pitch = ReadWord (stream);
+			if (flags & UCMDF_YAW)
+				ucmd->yaw = ReadWord (stream);
+			if (flags & UCMDF_FORWARDMOVE)
+				ucmd->forwardmove = ReadWord (stream);
+			if (flags & UCMDF_SIDEMOVE)
+				ucmd->sidemove = ReadWord (stream);
+			if (flags & UCMDF_UPMOVE)
+				ucmd->upmove = ReadWord (stream);
+			if (flags & UCMDF_ROLL)
+				ucmd->roll = ReadWord (stream);
+		}
 	}
 
 	return int(*stream - start);
@@ -250,35 +269,65 @@ int PackUserCmd (const usercmd_t *ucmd, const usercmd_t *basis, BYTE **stream)
 			}
 		}
 	}
-	if (ucmd->pitch != basis->pitch)
+	// The deltas are computed with short arithmetic so that angle wraps
+	// still come out as small steps.
+	SWORD dpitch = SWORD(ucmd->pitch - basis->pitch);
+	SWORD dyaw = SWORD(ucmd->yaw - basis->yaw);
+	SWORD dforward = SWORD(ucmd->forwardmove - basis->forwardmove);
+	SWORD dside = SWORD(ucmd->sidemove - basis->sidemove);
+	SWORD dup = SWORD(ucmd->upmove - basis->upmove);
+	SWORD droll = SWORD(ucmd->roll - basis->roll);
+
+	// If every analog field moved by less than a byte's range since the
+	// basis - the common case for mouse aiming - the changed ones can be
+	// sent as single byte deltas instead of full words.
+	bool shortdeltas =
+		dpitch >= -128 && dpitch <= 127 &&
+		dyaw >= -128 && dyaw <= 127 &&
+		dforward >= -128 && dforward <= 127 &&
+		dside >= -128 && dside <= 127 &&
+		dup >= -128 && dup <= 127 &&
+		droll >= -128 && droll <= 127;
+
+	if (shortdeltas && (dpitch | dyaw | dforward | dside | dup | droll))
+	{
+		flags |= UCMDF_SHORTDELTAS;
+	}
+	if (dpitch != 0)
 	{
 		flags |= UCMDF_PITCH;
-		WriteWord (ucmd->pitch, stream);
+		if (shortdeltas) WriteByte (BYTE(dpitch), stream);
+		else WriteWord (ucmd->pitch, stream);
 	}
-	if (ucmd->yaw != basis->yaw)
+	if (dyaw != 0)
 	{
 		flags |= UCMDF_YAW;
-		WriteWord (ucmd->yaw, stream);
+		if (shortdeltas) WriteByte (BYTE(dyaw), stream);
+		else WriteWord (ucmd->yaw, stream);
 	}
-	if (ucmd->forwardmove != basis->forwardmove)
+	if (dforward != 0)
 	{
 		flags |= UCMDF_FORWARDMOVE;
-		WriteWord (ucmd->forwardmove, stream);
+		if (shortdeltas) WriteByte (BYTE(dforward), stream);
+		else WriteWord (ucmd->forwardmove, stream);
 	}
-	if (ucmd->sidemove != basis->sidemove)
+	if (dside != 0)
 	{
 		flags |= UCMDF_SIDEMOVE;
-		WriteWord (ucmd->sidemove, stream);
+		if (shortdeltas) WriteByte (BYTE(dside), stream);
+		else WriteWord (ucmd->sidemove, stream);
 	}
-	if (ucmd->upmove != basis->upmove)
+	if (dup != 0)
 	{
 		flags |= UCMDF_UPMOVE;
-		WriteWord (ucmd->upmove, stream);
+		if (shortdeltas) WriteByte (BYTE(dup), stream);
+		else WriteWord (ucmd->upmove, stream);
 	}
-	if (ucmd->roll != basis->roll)
+	if (droll != 0)
 	{
 		flags |= UCMDF_ROLL;
-		WriteWord (ucmd->roll, stream);
+		if (shortdeltas) WriteByte (BYTE(droll), stream);
+		else WriteWord (ucmd->roll, stream);
 	}
 
 	// Write the packing bits
@@ -368,14 +417,16 @@ int SkipTicCmd (BYTE **stream, int count)
 
 			if (type == DEM_USERCMD)
 			{
+				int fieldlen = (*flow & UCMDF_SHORTDELTAS) ? 1 : 2;
+
 				moreticdata = false;
 				skip = 1;
-				if (*flow & UCMDF_PITCH)		skip += 2;
-				if (*flow & UCMDF_YAW)			skip += 2;
-				if (*flow & UCMDF_FORWARDMOVE)	skip += 2;
-				if (*flow & UCMDF_SIDEMOVE)		skip += 2;
-				if (*flow & UCMDF_UPMOVE)		skip += 2;
-				if (*flow & UCMDF_ROLL)			skip += 2;
+				if (*flow & UCMDF_PITCH)		skip += fieldlen;
+				if (*flow & UCMDF_YAW)			skip += fieldlen;
+				if (*flow & UCMDF_FORWARDMOVE)	skip += fieldlen;
+				if (*flow & UCMDF_SIDEMOVE)		skip += fieldlen;
+				if (*flow & UCMDF_UPMOVE)		skip += fieldlen;
+				if (*flow & UCMDF_ROLL)			skip += fieldlen;
 				if (*flow & UCMDF_BUTTONS)
 				{
 					if (*++flow & 0x80)
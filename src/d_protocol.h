@@ -83,6 +83,11 @@ enum
 	UCMDF_SIDEMOVE		= 0x10,
 	UCMDF_UPMOVE		= 0x20,
 	UCMDF_ROLL			= 0x40,
+
+	// The analog fields above are sent as single byte deltas from the basis
+	// command instead of full words. Only usable when every changed field
+	// moved by less than a byte's range since the basis.
+	UCMDF_SHORTDELTAS	= 0x80,
 };
 
 // When changing the following enum, be sure to update Net_SkipCommand()
@@ -36,6 +36,7 @@
 
 #include <stdlib.h>
 #include "doomtype.h"
+#include "objectpool.h"
 
 class PClass;
 
@@ -498,12 +499,12 @@ public:
 
 	void *operator new(size_t len)
 	{
-		return M_Malloc(len);
+		return Obj_Malloc(len);
 	}
 
 	void operator delete (void *mem)
 	{
-		M_Free(mem);
+		Obj_Free(mem);
 	}
 
 	// GC fiddling
@@ -570,7 +571,7 @@ protected:
 
 	void operator delete (void *mem, EInPlace *)
 	{
-		M_Free (mem);
+		Obj_Free (mem);
 	}
 };
 
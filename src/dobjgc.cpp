@@ -109,6 +109,14 @@
 #define GCSWEEPCOST		10
 #define GCFINALIZECOST	100
 
+// Bounds for the time one collector step may take. The actual limit is
+// derived from the headroom the previous frame left in the 35Hz tick
+// budget, so a lightly loaded game retires garbage faster while a
+// struggling one never spends more than GCMAXSTEPTIME at once.
+#define GCTICBUDGET		(1000.0 / TICRATE)
+#define GCMINSTEPTIME	0.2
+#define GCMAXSTEPTIME	5.0
+
 // TYPES -------------------------------------------------------------------
 
 // This object is responsible for marking sectors during the propagate
@@ -135,6 +143,7 @@ IMPLEMENT_CLASS(DSectorMarker)
 // EXTERNAL DATA DECLARATIONS ----------------------------------------------
 
 extern DThinker *NextToThink;
+extern cycle_t FrameCycles;
 
 // PUBLIC DATA DEFINITIONS -------------------------------------------------
 
@@ -477,12 +486,19 @@ static size_t SingleStep()
 // Step
 //
 // Performs enough single steps to cover GCSTEPSIZE * StepMul% bytes of
-// memory.
+// memory, or as many as the frame headroom allows, whichever gives the
+// collector more to do. The previous frame's time is the best available
+// predictor for this one, so its slack against the tick budget sizes the
+// step; a frame that already overran gets the minimum step only.
 //
 //==========================================================================
 
 void Step()
 {
+	double slack = GCTICBUDGET - FrameCycles.TimeMS();
+	double budget = clamp(slack * 0.25, GCMINSTEPTIME, GCMAXSTEPTIME);
+	cycle_t steptime;
+
 	size_t lim = (GCSTEPSIZE/100) * StepMul;
 	size_t olim;
 	if (lim == 0)
@@ -490,11 +506,18 @@ void Step()
 		lim = (~(size_t)0) / 2;		// no limit
 	}
 	Dept += AllocBytes - Threshold;
+	steptime.Reset();
 	do
 	{
+		steptime.Clock();
 		olim = lim;
 		lim -= SingleStep();
-	} while (olim > lim && State != GCS_Pause);
+		steptime.Unclock();
+		if (steptime.TimeMS() >= budget)
+		{
+			break;
+		}
+	} while (State != GCS_Pause && (olim > lim || Dept >= GCSTEPSIZE));
 	if (State != GCS_Pause)
 	{
 		if (Dept < GCSTEPSIZE)
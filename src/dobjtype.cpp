@@ -2917,7 +2917,7 @@ PClass *PClass::FindClass (FName zaname)
 
 DObject *PClass::CreateNew() const
 {
-	BYTE *mem = (BYTE *)M_Malloc (Size);
+	BYTE *mem = (BYTE *)Obj_Malloc (Size);
 	assert (mem != NULL);
 
 	// Set this object's defaults before constructing it.
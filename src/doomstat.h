@@ -144,6 +144,7 @@ extern	FString			newdemomap;
 extern	bool			demoplayback;
 extern	bool			demorecording;
 extern	int				demover;
+extern	int				demoskiptics;	// fast-forward the demo this many tics
 
 // Quit after playing a demo from cmdline.
 extern	bool			singledemo; 	
@@ -40,6 +40,9 @@
 #include "doomerrors.h"
 #include "serializer.h"
 #include "d_player.h"
+#include "c_cvars.h"
+
+#include <algorithm>
 
 
 static cycle_t ThinkCycles;
@@ -47,6 +50,19 @@ extern cycle_t BotSupportCycles;
 extern cycle_t ActionCycles;
 extern int BotWTG;
 
+// Per-class tick profiling. The bookkeeping costs two clock reads around
+// every single Tick call, so it stays off unless someone is hunting for
+// the class that is eating the tic.
+CVAR (Bool, profilethinkers, false, 0)
+CVAR (Float, profilethinkers_alarm, 0, 0)	// in ms; single ticks above this are logged
+
+struct FThinkerProfileEntry
+{
+	int Count = 0;
+	double TotalMS = 0, WorstMS = 0;
+};
+static TMap<PClass *, FThinkerProfileEntry> ThinkerProfile;
+
 IMPLEMENT_CLASS (DThinker)
 
 DThinker *NextToThink;
@@ -355,6 +371,11 @@ void DThinker::RunThinkers ()
 	ActionCycles.Reset();
 	BotWTG = 0;
 
+	if (profilethinkers)
+	{
+		ThinkerProfile.Clear();
+	}
+
 	ThinkCycles.Clock();
 
 	// Tick every thinker left from last time
@@ -407,7 +428,29 @@ int DThinker::TickThinkers (FThinkerList *list, FThinkerList *dest)
 
 		if (!(node->ObjectFlags & OF_EuthanizeMe))
 		{ // Only tick thinkers not scheduled for destruction
-			node->Tick();
+			if (!profilethinkers)
+			{
+				node->Tick();
+			}
+			else
+			{
+				cycle_t clock;
+
+				clock.Reset();
+				clock.Clock();
+				node->Tick();
+				clock.Unclock();
+
+				double ms = clock.TimeMS();
+				FThinkerProfileEntry &entry = ThinkerProfile[node->GetClass()];
+				entry.Count++;
+				entry.TotalMS += ms;
+				if (ms > entry.WorstMS) entry.WorstMS = ms;
+				if (profilethinkers_alarm > 0 && ms >= profilethinkers_alarm)
+				{
+					Printf ("%s took %.3f ms to tick\n", node->GetClass()->TypeName.GetChars(), ms);
+				}
+			}
 			node->ObjectFlags &= ~OF_JustSpawned;
 			GC::CheckGC();
 		}
@@ -525,5 +568,28 @@ ADD_STAT (think)
 {
 	FString out;
 	out.Format ("Think time = %04.2f ms, Action = %04.2f ms", ThinkCycles.TimeMS(), ActionCycles.TimeMS());
+	if (profilethinkers)
+	{
+		// Show the heaviest classes from the last tic, worst first.
+		TArray<TMap<PClass *, FThinkerProfileEntry>::Pair *> sorted;
+		TMap<PClass *, FThinkerProfileEntry>::Iterator it(ThinkerProfile);
+		TMap<PClass *, FThinkerProfileEntry>::Pair *pair;
+
+		while (it.NextPair(pair))
+		{
+			sorted.Push(pair);
+		}
+		std::sort(&sorted[0], &sorted[0] + sorted.Size(),
+			[](TMap<PClass *, FThinkerProfileEntry>::Pair *a, TMap<PClass *, FThinkerProfileEntry>::Pair *b)
+			{
+				return a->Value.TotalMS > b->Value.TotalMS;
+			});
+		for (unsigned i = 0; i < sorted.Size() && i < 10; i++)
+		{
+			out.AppendFormat ("\n%-24s count %5d total %7.3f ms worst %7.3f ms",
+				sorted[i]->Key->TypeName.GetChars(), sorted[i]->Value.Count,
+				sorted[i]->Value.TotalMS, sorted[i]->Value.WorstMS);
+		}
+	}
 	return out;
 }
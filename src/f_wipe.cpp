@@ -56,35 +56,13 @@ static int fade;
 #define MELT_WIDTH		160
 #define MELT_HEIGHT		200
 
-void wipe_shittyColMajorXform (short *array)
-{
-	int x, y;
-	short *dest;
-	int width = SCREENWIDTH / 2;
-
-	dest = new short[width*SCREENHEIGHT*2];
-
-	for(y = 0; y < SCREENHEIGHT; y++)
-		for(x = 0; x < width; x++)
-			dest[x*SCREENHEIGHT+y] = array[y*width+x];
-
-	memcpy(array, dest, SCREENWIDTH*SCREENHEIGHT);
-
-	delete[] dest;
-}
-
 bool wipe_initMelt (int ticks)
 {
 	int i, r;
-	
+
 	// copy start screen to main screen
 	screen->DrawBlock (0, 0, SCREENWIDTH, SCREENHEIGHT, (BYTE *)wipe_scr_start);
-	
-	// makes this wipe faster (in theory)
-	// to have stuff in column-major format
-	wipe_shittyColMajorXform (wipe_scr_start);
-	wipe_shittyColMajorXform (wipe_scr_end);
-	
+
 	// setup initial column positions
 	// (y<0 => not ready to scroll yet)
 	y = new int[MELT_WIDTH];
@@ -100,9 +78,7 @@ bool wipe_initMelt (int ticks)
 
 bool wipe_doMelt (int ticks)
 {
-	int i, j, dy, x;
-	const short *s;
-	short *d;
+	int i, dy;
 	bool done = true;
 
 	while (ticks--)
@@ -114,36 +90,45 @@ bool wipe_doMelt (int ticks)
 			{
 				y[i]++;
 				done = false;
-			} 
+			}
 			else if (y[i] < MELT_HEIGHT)
 			{
 				dy = (y[i] < 16) ? y[i]+1 : 8;
 				y[i] = MIN(y[i] + dy, MELT_HEIGHT);
 				done = false;
 			}
-			if (ticks == 0 && y[i] >= 0)
-			{ // Only draw for the final tick.
-				const int pitch = screen->GetPitch() / 2;
-				int sy = y[i] * SCREENHEIGHT / MELT_HEIGHT;
+		}
+		if (ticks == 0)
+		{ // Only draw for the final tick. The buffers are row-major, so walk
+		  // destination rows and copy one contiguous span per melt strip
+		  // instead of scattering single pixels across the whole frame.
+			const int pitch = screen->GetPitch() / 2;
+			const int width = SCREENWIDTH / 2;
+			short *dest = (short *)screen->GetBuffer();
+			int strip_y[MELT_WIDTH];
+
+			for (i = 0; i < MELT_WIDTH; i++)
+			{
+				strip_y[i] = y[i] < 0 ? -1 : y[i] * SCREENHEIGHT / MELT_HEIGHT;
+			}
+			for (int ry = 0; ry < SCREENHEIGHT; ry++)
+			{
+				short *d = dest + ry * pitch;
 
-				for (x = i * (SCREENWIDTH/2) / MELT_WIDTH; x < (i + 1) * (SCREENWIDTH/2) / MELT_WIDTH; ++x)
+				for (i = 0; i < MELT_WIDTH; i++)
 				{
-					s = &wipe_scr_end[x*SCREENHEIGHT];
-					d = &((short *)screen->GetBuffer())[x];
+					int sy = strip_y[i];
 
-					for (j = sy; j != 0; --j)
-					{
-						*d = *(s++);
-						d += pitch;
+					if (sy < 0)
+					{ // not started yet; leave the start screen in place
+						continue;
 					}
 
-					s = &wipe_scr_start[x*SCREENHEIGHT];
+					int x1 = i * width / MELT_WIDTH;
+					int x2 = (i + 1) * width / MELT_WIDTH;
+					const short *s = ry < sy ? &wipe_scr_end[ry * width] : &wipe_scr_start[(ry - sy) * width];
 
-					for (j = SCREENHEIGHT - sy; j != 0; --j)
-					{
-						*d = *(s++);
-						d += pitch;
-					}
+					memcpy(d + x1, s + x1, (x2 - x1) * sizeof(short));
 				}
 			}
 		}
@@ -43,6 +43,16 @@
 #include "templates.h"
 #include "m_misc.h"
 
+#include <limits.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 
 //==========================================================================
 //
@@ -545,6 +555,96 @@ char *MemoryReader::Gets(char *strbuf, int len)
 	return GetsFromBuffer(bufptr, strbuf, len);
 }
 
+//==========================================================================
+//
+// MemoryMappedFileReader
+//
+// maps an entire file into the address space so that uncompressed lumps
+// can be read from it without intermediate copies
+//
+//==========================================================================
+
+MemoryMappedFileReader::MemoryMappedFileReader ()
+: MemoryReader(NULL, 0)
+{
+#ifdef _WIN32
+	FileHandle = (void *)(size_t)-1;	// INVALID_HANDLE_VALUE
+	MappingHandle = NULL;
+#endif
+}
+
+bool MemoryMappedFileReader::Open (const char *filename)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || size.QuadPart > LONG_MAX ||
+		(sizeof(void*) < 8 && size.QuadPart > 256*1024*1024))
+	{
+		// Don't gobble up the address space of 32 bit processes with huge mappings.
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL)
+	{
+		CloseHandle(file);
+		return false;
+	}
+	const void *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (base == NULL)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+	FileHandle = file;
+	MappingHandle = mapping;
+	bufptr = (const char *)base;
+	Length = (long)size.QuadPart;
+#else
+	int fd = open(filename, O_RDONLY);
+	if (fd == -1)
+	{
+		return false;
+	}
+	off_t size = lseek(fd, 0, SEEK_END);
+	if (size <= 0 || size > (off_t)LONG_MAX ||
+		(sizeof(void*) < 8 && size > (off_t)(256*1024*1024)))
+	{
+		// Don't gobble up the address space of 32 bit processes with huge mappings.
+		close(fd);
+		return false;
+	}
+	void *base = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);	// the mapping holds its own reference to the file
+	if (base == MAP_FAILED)
+	{
+		return false;
+	}
+	bufptr = (const char *)base;
+	Length = (long)size;
+#endif
+	FilePos = 0;
+	return true;
+}
+
+MemoryMappedFileReader::~MemoryMappedFileReader ()
+{
+#ifdef _WIN32
+	if (bufptr != NULL) UnmapViewOfFile((void *)bufptr);
+	if (MappingHandle != NULL) CloseHandle(MappingHandle);
+	if (FileHandle != (void *)(size_t)-1) CloseHandle(FileHandle);
+#else
+	if (bufptr != NULL) munmap((void *)bufptr, Length);
+#endif
+	bufptr = NULL;
+}
+
 //==========================================================================
 //
 // MemoryArrayReader
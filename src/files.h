@@ -336,6 +336,25 @@ protected:
 	const char * bufptr;
 };
 
+// Reads from a read-only memory mapping of an entire file. Since this acts
+// like a MemoryReader, uncompressed lumps stored in such a file can be used
+// straight out of the mapping through GetBuffer() without being copied into
+// separate cache buffers.
+class MemoryMappedFileReader : public MemoryReader
+{
+public:
+	MemoryMappedFileReader ();
+	~MemoryMappedFileReader ();
+
+	bool Open (const char *filename);
+
+private:
+#ifdef _WIN32
+	void *FileHandle;
+	void *MappingHandle;
+#endif
+};
+
 class MemoryArrayReader : public FileReader
 {
 public:
@@ -289,16 +289,44 @@ char *FParser::GetTokens(char *s)
 	}
 		
 	// check for empty last token
-	
+
 	if(!tokn || !tokn[0])
 	{
 		NumTokens = NumTokens - 1;
 	}
-	
+
+	// cache the operator table index of each operator token, so that the
+	// recursive expression evaluator can compare ints instead of string
+	// comparing every operator against every token over and over
+
+	for(int i = 0; i < NumTokens; i++)
+	{
+		TokenOp[i] = TokenType[i] == operator_ ? MatchOperator(Tokens[i]) : -1;
+	}
+
 	Rover++;
 	return Rover;
 }
 
+//==========================================================================
+//
+// find the operator table entry for an operator token
+// brackets and commas are not in the table and yield -1
+//
+//==========================================================================
+
+int FParser::MatchOperator(const char *value)
+{
+	int i;
+
+	for(i=0; i<num_operators; i++)
+	{
+		if(!strcmp(operators[i].string, value))
+			return i;
+	}
+	return -1;
+}
+
 
 //==========================================================================
 //
@@ -532,11 +560,68 @@ int FParser::FindOperatorBackwards(int start, int stop, const char *value)
 		
 		// only check when we are not in brackets
 		// if we find what we want, return it
-		
+
 		if(!bracketlevel && !strcmp(value, Tokens[i]))
 			return i;
     }
-	
+
+	return -1;
+}
+
+//==========================================================================
+//
+// the same two searches, keyed on the precomputed operator index instead
+// of the operator's string
+//
+//==========================================================================
+
+int FParser::FindOperator(int start, int stop, int op)
+{
+	int i;
+	int bracketlevel = 0;
+
+	for(i=start; i<=stop; i++)
+    {
+		// only interested in operators
+		if(TokenType[i] != operator_) continue;
+
+		// use bracketlevel to check the number of brackets
+		// which we are inside
+		bracketlevel += Tokens[i][0]=='(' ? 1 :
+		Tokens[i][0]==')' ? -1 : 0;
+
+		// only check when we are not in brackets
+		if(!bracketlevel && TokenOp[i] == op)
+			return i;
+    }
+
+	return -1;
+}
+
+int FParser::FindOperatorBackwards(int start, int stop, int op)
+{
+	int i;
+	int bracketlevel = 0;
+
+	for(i=stop; i>=start; i--)      // check backwards
+    {
+		// operators only
+
+		if(TokenType[i] != operator_) continue;
+
+		// use bracketlevel to check the number of brackets
+		// which we are inside
+
+		bracketlevel += Tokens[i][0]=='(' ? -1 :
+		Tokens[i][0]==')' ? 1 : 0;
+
+		// only check when we are not in brackets
+		// if we find what we want, return it
+
+		if(!bracketlevel && TokenOp[i] == op)
+			return i;
+    }
+
 	return -1;
 }
 
@@ -671,11 +756,11 @@ void FParser::EvaluateExpression(svalue_t &result, int start, int stop)
 		
 		if (operators[i].direction==forward)
 		{
-			n = FindOperatorBackwards(start, stop, operators[i].string);
+			n = FindOperatorBackwards(start, stop, i);
 		}
 		else
 		{
-			n = FindOperator(start, stop, operators[i].string);
+			n = FindOperator(start, stop, i);
 		}
 
 		if( n != -1)
@@ -400,6 +400,7 @@ struct FParser
 
 	char *Tokens[T_MAXTOKENS];
 	tokentype_t TokenType[T_MAXTOKENS];
+	int TokenOp[T_MAXTOKENS];	// operator table index per token, -1 if none
 	int NumTokens;
 	DFsScript *Script;       // the current script
 	DFsSection *Section;
@@ -434,8 +435,11 @@ struct FParser
 
 	void Run(char *rover, char *data, char *end);
 	void RunStatement();
+	int MatchOperator(const char *value);
 	int FindOperator(int start, int stop, const char *value);
 	int FindOperatorBackwards(int start, int stop, const char *value);
+	int FindOperator(int start, int stop, int op);
+	int FindOperatorBackwards(int start, int stop, int op);
 	void SimpleEvaluate(svalue_t &, int n);
 	void PointlessBrackets(int *start, int *stop);
 	void EvaluateExpression(svalue_t &, int start, int stop);
@@ -49,6 +49,7 @@
 #include "p_saveg.h"
 #include "p_tick.h"
 #include "d_main.h"
+#include "profiler.h"
 #include "wi_stuff.h"
 #include "hu_stuff.h"
 #include "st_stuff.h"
@@ -89,6 +90,7 @@
 #include "resourcefiles/resourcefile.h"
 
 #include <zlib.h>
+#include <thread>
 
 #include "g_hub.h"
 
@@ -112,6 +114,7 @@ void	G_DoVictory (void);
 void	G_DoWorldDone (void);
 void	G_DoSaveGame (bool okForQuicksave, FString filename, const char *description);
 void	G_DoAutoSave ();
+void	G_FinishAsyncSave ();
 
 void STAT_Serialize(FSerializer &file);
 bool WriteZip(const char *filename, TArray<FString> &filenames, TArray<FCompressedBuffer> &content);
@@ -124,6 +127,7 @@ CVAR (Bool, storesavepic, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 CVAR (Bool, longsavemessages, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 CVAR (String, save_dir, "", CVAR_ARCHIVE|CVAR_GLOBALCONFIG);
 CVAR (Bool, cl_waitforsave, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG);
+CVAR (Bool, save_async, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG);
 EXTERN_CVAR (Float, con_midtime);
 
 //==========================================================================
@@ -177,6 +181,7 @@ FString			newdemomap;
 FString			demoname;
 bool 			demorecording;
 bool 			demoplayback;
+int				demoskiptics;			// tics left to fast-forward through
 bool			demonew;				// [RH] Only used around G_InitNew for demos
 int				demover;
 BYTE*			demobuffer;
@@ -1841,6 +1846,9 @@ void G_DoLoadGame ()
 	hidecon = gameaction == ga_loadgamehidecon;
 	gameaction = ga_nothing;
 
+	// If this savegame is still being written, wait for it.
+	G_FinishAsyncSave();
+
 	FResourceFile *resfile = FResourceFile::OpenResourceFile(savename.GetChars(), nullptr, true, true);
 	if (resfile == nullptr)
 	{
@@ -2183,6 +2191,75 @@ static void PutSavePic (FileWriter *file, int width, int height)
 	}
 }
 
+//==========================================================================
+//
+// Background savegame writer
+//
+// The playsim must be serialized synchronously, but once everything has
+// been compressed into self-contained buffers the actual disk write can
+// be handed off to a worker thread. The job owns deep copies of all
+// buffers and names because the originals (the level snapshots and the
+// JSON output) get cleaned up before G_DoSaveGame returns.
+//
+//==========================================================================
+
+struct FSaveGameJob
+{
+	char *filename;
+	TArray<char *> lumpnames;
+	TArray<FCompressedBuffer> content;
+};
+
+static std::thread SaveGameThread;
+static bool SaveGameFailed;
+
+static void G_SaveGameWorker(FSaveGameJob *job)
+{
+	// FStrings must be created and destroyed entirely on this thread -
+	// their reference counting is not thread safe.
+	TArray<FString> lumpnames;
+	for (unsigned i = 0; i < job->lumpnames.Size(); i++)
+	{
+		lumpnames.Push(job->lumpnames[i]);
+	}
+	SaveGameFailed = !WriteZip(job->filename, lumpnames, job->content);
+	for (unsigned i = 0; i < job->lumpnames.Size(); i++)
+	{
+		delete[] job->lumpnames[i];
+		job->content[i].Clean();
+	}
+	delete[] job->filename;
+	delete job;
+}
+
+//==========================================================================
+//
+// Waits for a pending savegame write to complete. Must be called before
+// reading any savegame file and before starting the next save.
+//
+//==========================================================================
+
+void G_FinishAsyncSave()
+{
+	if (SaveGameThread.joinable())
+	{
+		SaveGameThread.join();
+		if (SaveGameFailed)
+		{
+			Printf(PRINT_HIGH, "Save failed\n");
+			SaveGameFailed = false;
+		}
+	}
+}
+
+static FCompressedBuffer CopyForSaveJob(const FCompressedBuffer &buf)
+{
+	FCompressedBuffer copy = buf;
+	copy.mBuffer = new char[buf.mCompressedSize];
+	memcpy(copy.mBuffer, buf.mBuffer, buf.mCompressedSize);
+	return copy;
+}
+
 void G_DoSaveGame (bool okForQuicksave, FString filename, const char *description)
 {
 	TArray<FCompressedBuffer> savegame_content;
@@ -2197,6 +2274,9 @@ void G_DoSaveGame (bool okForQuicksave, FString filename, const char *descriptio
 		return;
 	}
 
+	// Only one savegame can be written at a time.
+	G_FinishAsyncSave();
+
 	if (demoplayback)
 	{
 		filename = G_BuildSaveName ("demosave." SAVEGAME_EXT, -1);
@@ -2273,27 +2353,53 @@ void G_DoSaveGame (bool okForQuicksave, FString filename, const char *descriptio
 	savegame_filenames.Push("globals.json");
 
 	G_WriteSnapshots (savegame_filenames, savegame_content);
-	
 
-	WriteZip(filename, savegame_filenames, savegame_content);
 
-	M_NotifyNewSave (filename.GetChars(), description, okForQuicksave);
+	if (save_async)
+	{
+		FSaveGameJob *job = new FSaveGameJob;
+		job->filename = copystring(filename);
+		for (unsigned i = 0; i < savegame_content.Size(); i++)
+		{
+			job->lumpnames.Push(copystring(savegame_filenames[i]));
+			job->content.Push(CopyForSaveJob(savegame_content[i]));
+		}
+		static bool addedterm = false;
+		if (!addedterm)
+		{
+			atterm (G_FinishAsyncSave);
+			addedterm = true;
+		}
+		SaveGameThread = std::thread(G_SaveGameWorker, job);
+
+		M_NotifyNewSave (filename.GetChars(), description, okForQuicksave);
+
+		// Failures get reported when the writer thread is joined.
+		if (longsavemessages) Printf ("%s (%s)\n", GStrings("GGSAVED"), filename.GetChars());
+		else Printf ("%s\n", GStrings("GGSAVED"));
+	}
+	else
+	{
+		WriteZip(filename, savegame_filenames, savegame_content);
+
+		M_NotifyNewSave (filename.GetChars(), description, okForQuicksave);
+
+		// Check whether the file is ok by trying to open it.
+		FResourceFile *test = FResourceFile::OpenResourceFile(filename, nullptr, true);
+		if (test != nullptr)
+		{
+			delete test;
+			if (longsavemessages) Printf ("%s (%s)\n", GStrings("GGSAVED"), filename.GetChars());
+			else Printf ("%s\n", GStrings("GGSAVED"));
+		}
+		else Printf(PRINT_HIGH, "Save failed\n");
+	}
 
 	// delete the JSON buffers we created just above. Everything else will
 	// either still be needed or taken care of automatically.
 	savegame_content[1].Clean();
 	savegame_content[2].Clean();
 
-	// Check whether the file is ok by trying to open it.
-	FResourceFile *test = FResourceFile::OpenResourceFile(filename, nullptr, true);
-	if (test != nullptr)
-	{
-		delete test;
-		if (longsavemessages) Printf ("%s (%s)\n", GStrings("GGSAVED"), filename.GetChars());
-		else Printf ("%s\n", GStrings("GGSAVED"));
-	}
-	else Printf(PRINT_HIGH, "Save failed\n");
-
 
 	BackupSaveName = filename;
 
@@ -2531,6 +2637,26 @@ CCMD (playdemo)
 	}
 }
 
+// Demos have no keyframes, so there is nothing to seek to directly. Instead
+// the playsim runs batches of tics per frame through the requested stretch,
+// which gets through a demo at many times real time while keeping the
+// display and console responsive.
+CCMD (demo_skiptics)
+{
+	if (argv.argc() < 2)
+	{
+		Printf ("Usage: demo_skiptics <tics>\n");
+	}
+	else if (!demoplayback)
+	{
+		Printf ("No demo is being played.\n");
+	}
+	else
+	{
+		demoskiptics = MAX (atoi (argv[1]), 0);
+	}
+}
+
 CCMD (timedemo)
 {
 	if (argv.argc() > 1)
@@ -2699,6 +2825,7 @@ void G_DoPlayDemo (void)
 	int demolump;
 
 	gameaction = ga_nothing;
+	demoskiptics = 0;
 
 	// [RH] Allow for demos not loaded as lumps
 	demolump = Wads.CheckNumForFullName (defdemoname, true);
@@ -2775,6 +2902,11 @@ void G_TimeDemo (const char* name)
 	timingdemo = true;
 	singletics = true;
 
+	if (Args->CheckValue ("-benchfile") != NULL)
+	{
+		FZoneProfiler::StartBench ();
+	}
+
 	defdemoname = name;
 	gameaction = (gameaction == ga_loadgame) ? ga_loadgameplaydemo : ga_playdemo;
 }
@@ -2811,6 +2943,7 @@ bool G_CheckDemoStatus (void)
 
 		P_SetupWeapons_ntohton();
 		demoplayback = false;
+		demoskiptics = 0;
 		netgame = false;
 		multiplayer = false;
 		singletics = false;
@@ -2826,6 +2959,14 @@ bool G_CheckDemoStatus (void)
 		{
 			if (timingdemo)
 			{
+				const char *benchfile = Args->CheckValue ("-benchfile");
+				if (benchfile != NULL)
+				{
+					if (FZoneProfiler::StopBench (benchfile, gametic, endtime))
+						Printf ("Benchmark results written to %s\n", benchfile);
+					else
+						Printf ("Could not write %s\n", benchfile);
+				}
 				// Trying to get back to a stable state after timing a demo
 				// seems to cause problems. I don't feel like fixing that
 				// right now.
@@ -49,6 +49,9 @@ void G_DoLoadGame (void);
 // Called by M_Responder.
 void G_SaveGame (const char *filename, const char *description);
 
+// Waits for a pending background savegame write to complete.
+void G_FinishAsyncSave (void);
+
 // Only called by startup code.
 void G_RecordDemo (const char* name);
 
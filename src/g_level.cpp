@@ -91,11 +91,17 @@
 #include "g_hub.h"
 
 #include <string.h>
+#include <thread>
 
 void STAT_StartNewGame(const char *lev);
 void STAT_ChangeLevel(const char *newl);
 
 EXTERN_CVAR(Bool, save_formatted)
+
+// Skip the screen wipe and the blocking precache pass on level changes.
+// Textures and sounds are loaded on first use instead, trading a few
+// in-game hitches for the shortest possible time to first input.
+CVAR (Bool, g_instanttransition, false, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 EXTERN_CVAR (Float, sv_gravity)
 EXTERN_CVAR (Float, sv_aircontrol)
 EXTERN_CVAR (Int, disableautosave)
@@ -724,6 +730,77 @@ void G_SecretExitLevel (int position)
 	G_ChangeLevel(G_GetSecretExitMap(), position, 0);
 }
 
+//==========================================================================
+//
+// Map prefetch
+//
+// While the intermission runs, a worker thread reads the next map's bytes
+// from its containing file through a private handle. This shares nothing
+// with the main thread - it only pulls the data into the OS file cache so
+// that the real load in G_DoLoadLevel hits warm pages. More of
+// P_SetupLevel cannot move off the main thread; everything past the raw
+// reads writes the level globals.
+//
+//==========================================================================
+
+static std::thread MapPrefetchThread;
+
+static void G_JoinMapPrefetch ()
+{
+	if (MapPrefetchThread.joinable())
+	{
+		MapPrefetchThread.join();
+	}
+}
+
+static void G_StartMapPrefetch (const char *mapname)
+{
+	G_JoinMapPrefetch();
+
+	int lump = Wads.CheckNumForName(mapname);
+	if (lump < 0)
+	{
+		return;
+	}
+	FString path = Wads.GetWadFullName(Wads.GetLumpFile(lump));
+	int offset = Wads.GetLumpOffset(lump);
+	if (offset < 0)
+	{
+		// The lump's container cannot report a file position.
+		return;
+	}
+
+	static bool addedterm = false;
+	if (!addedterm)
+	{
+		atterm (G_JoinMapPrefetch);
+		addedterm = true;
+	}
+
+	MapPrefetchThread = std::thread([path, offset]()
+	{
+		// 8 MB from the map marker onward covers the data lumps of all but
+		// the most extreme maps; reading too much merely warms extra cache.
+		const size_t prefetchsize = 8 * 1024 * 1024;
+		FILE *f = fopen(path, "rb");
+		if (f != NULL)
+		{
+			char buffer[65536];
+			size_t left = prefetchsize;
+			if (fseek(f, offset, SEEK_SET) == 0)
+			{
+				while (left > 0)
+				{
+					size_t got = fread(buffer, 1, MIN(left, sizeof(buffer)), f);
+					if (got == 0) break;
+					left -= got;
+				}
+			}
+			fclose(f);
+		}
+	});
+}
+
 //==========================================================================
 //
 //
@@ -884,6 +961,13 @@ void G_DoCompleted (void)
 	viewactive = false;
 	automapactive = false;
 
+	// Start pulling the next map's data into the file cache while the
+	// intermission is on screen.
+	if (wminfo.next.IsNotEmpty())
+	{
+		G_StartMapPrefetch (wminfo.next);
+	}
+
 // [RH] If you ever get a statistics driver operational, adapt this.
 //	if (statcopy)
 //		memcpy (statcopy, &wminfo, sizeof(wminfo));
@@ -920,11 +1004,14 @@ void DAutosaver::Tick ()
 extern gamestate_t 	wipegamestate; 
  
 void G_DoLoadLevel (int position, bool autosave)
-{ 
+{
 	static int lastposition = 0;
 	gamestate_t oldgs = gamestate;
 	int i;
 
+	// Don't overlap the prefetch reader with the real load.
+	G_JoinMapPrefetch ();
+
 	if (NextSkill >= 0)
 	{
 		UCVarValue val;
@@ -957,7 +1044,11 @@ void G_DoLoadLevel (int position, bool autosave)
 			TEXTCOLOR_BOLD "%s - %s\n\n",
 			mapname.GetChars(), level.LevelName.GetChars());
 
-	if (wipegamestate == GS_LEVEL)
+	if (g_instanttransition)
+	{ // No wipe also means no full screen capture before the transition.
+		NoWipe = 1;
+	}
+	else if (wipegamestate == GS_LEVEL)
 		wipegamestate = GS_FORCEWIPE;
 
 	if (gamestate != GS_TITLELEVEL)
@@ -1006,6 +1097,11 @@ void G_DoLoadLevel (int position, bool autosave)
 	level.maptime = 0;
 	P_SetupLevel (level.MapName, position);
 
+	// The old level's objects are all dead now, and the load stall hides
+	// the collection cost, so sweep them out in one go instead of letting
+	// the incremental collector chew on them during play.
+	GC::FullGC ();
+
 	AM_LevelInit();
 
 	// [RH] Start lightning, if MAPINFO tells us to
@@ -1527,7 +1623,10 @@ void G_SnapshotLevel ()
 		{
 			SaveVersion = SAVEVER;
 			G_SerializeLevel(arc, false);
-			level.info->Snapshot = arc.GetCompressedOutput();
+			// Snapshots get compressed on every hub transition and normally
+			// never leave memory, so favor speed over ratio here. The output
+			// is still zip compatible deflate for when a savegame is written.
+			level.info->Snapshot = arc.GetCompressedOutput(Z_BEST_SPEED);
 		}
 	}
 }
@@ -620,6 +620,9 @@ DImpactDecal *DImpactDecal::StaticCreate (const FDecalTemplate *tpl, const DVect
 
 		if (!decal->StickToWall (wall, pos.X, pos.Y, ffloor).isValid())
 		{
+			// Do not leave an invisible decal eating into the cl_maxdecals
+			// budget behind.
+			decal->Destroy();
 			return NULL;
 		}
 
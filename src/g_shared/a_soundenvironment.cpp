@@ -57,6 +57,11 @@ void ASoundEnvironment::PostBeginPlay ()
 	}
 }
 
+// The zone table is the precomputation: the map loader assigns every sector
+// its zone up front, so picking the listener's reverb in S_UpdateSounds is a
+// single array lookup, and this write on activation is the only time an
+// environment is ever "computed". The mixer applies no geometric occlusion,
+// so there is nothing else on the sound-start path to cache.
 void ASoundEnvironment::Activate (AActor *activator)
 {
 	Zones[Sector->ZoneNumber].Environment = S_FindEnvironment ((args[0]<<8) | (args[1]));
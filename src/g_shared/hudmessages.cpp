@@ -140,7 +140,13 @@ DHUDMessage::DHUDMessage (FFont *font, const char *text, float x, float y, int h
 	VisibilityFlags = 0;
 	Style = STYLE_Translucent;
 	Alpha = 1.;
-	ResetText (SourceText);
+	NumLines = 0;
+	Width = 0;
+	Height = 0;
+	// The text is not broken into lines here; that is deferred until the
+	// first draw so that a message replacing an identical one can take over
+	// the old layout instead (see TryStealLayout).
+	LayoutDone = false;
 }
 
 //============================================================================
@@ -293,6 +299,77 @@ void DHUDMessage::ResetText (const char *text)
 			Width = MAX<int> (Width, Lines[NumLines].Width);
 		}
 	}
+	LayoutDone = true;
+}
+
+//============================================================================
+//
+// DHUDMessage :: TryStealLayout
+//
+// ACS mods update the same HUD message id every tic, most of the time with
+// unchanged text. If the message being replaced broke identical source text
+// with identical layout settings, take over its broken lines instead of
+// running V_BreakLines again.
+//
+//============================================================================
+
+bool DHUDMessage::TryStealLayout (DHUDMessage *old)
+{
+	if (LayoutDone || !old->LayoutDone || old->Lines == NULL ||
+		Font != old->Font || NoWrap != old->NoWrap ||
+		WrapWidth != old->WrapWidth || HUDWidth != old->HUDWidth ||
+		strcmp (SourceText, old->SourceText) != 0)
+	{
+		return false;
+	}
+	Lines = old->Lines;
+	NumLines = old->NumLines;
+	Width = old->Width;
+	Height = old->Height;
+	LayoutDone = true;
+	old->Lines = NULL;
+	return true;
+}
+
+//============================================================================
+//
+// DHUDMessage :: IsIdenticalTo
+//
+// Returns true if the other message displays exactly the same as this one,
+// so replacing this message with it would be a no-op apart from restarting
+// the timer.
+//
+//============================================================================
+
+bool DHUDMessage::IsIdenticalTo (DHUDMessage *other)
+{
+	return GetClass() == other->GetClass() &&
+		Left == other->Left && Top == other->Top &&
+		CenterX == other->CenterX && NoWrap == other->NoWrap &&
+		HoldTics == other->HoldTics &&
+		VisibilityFlags == other->VisibilityFlags &&
+		HUDWidth == other->HUDWidth && HUDHeight == other->HUDHeight &&
+		ClipX == other->ClipX && ClipY == other->ClipY &&
+		ClipWidth == other->ClipWidth && ClipHeight == other->ClipHeight &&
+		HandleAspect == other->HandleAspect && WrapWidth == other->WrapWidth &&
+		TextColor == other->TextColor && Font == other->Font &&
+		Style == other->Style && Alpha == other->Alpha &&
+		SourceText != NULL && other->SourceText != NULL &&
+		strcmp (SourceText, other->SourceText) == 0;
+}
+
+//============================================================================
+//
+// DHUDMessage :: ResetTimer
+//
+// Puts the timing state back to that of a freshly constructed message.
+//
+//============================================================================
+
+void DHUDMessage::ResetTimer ()
+{
+	Tics = 0;
+	State = 0;
 }
 
 //============================================================================
@@ -326,6 +403,8 @@ void DHUDMessage::Draw (int bottom, int visibility)
 	bool clean = false;
 	int hudheight;
 
+	EnsureLayout ();
+
 	// If any of the visibility flags match, do NOT draw this message.
 	if (VisibilityFlags & visibility)
 	{
@@ -537,6 +616,30 @@ bool DHUDMessageFadeOut::Tick ()
 	return false;
 }
 
+//============================================================================
+//
+// DHUDMessageFadeOut :: IsIdenticalTo
+//
+//============================================================================
+
+bool DHUDMessageFadeOut::IsIdenticalTo (DHUDMessage *other)
+{
+	return Super::IsIdenticalTo (other) &&
+		FadeOutTics == static_cast<DHUDMessageFadeOut *>(other)->FadeOutTics;
+}
+
+//============================================================================
+//
+// DHUDMessageFadeOut :: ResetTimer
+//
+//============================================================================
+
+void DHUDMessageFadeOut::ResetTimer ()
+{
+	Tics = 0;
+	State = 1;
+}
+
 //============================================================================
 //
 // DHUDMessageFadeOut :: DoDraw
@@ -641,6 +744,30 @@ bool DHUDMessageFadeInOut::Tick ()
 	return true;
 }
 
+//============================================================================
+//
+// DHUDMessageFadeInOut :: IsIdenticalTo
+//
+//============================================================================
+
+bool DHUDMessageFadeInOut::IsIdenticalTo (DHUDMessage *other)
+{
+	return Super::IsIdenticalTo (other) &&
+		FadeInTics == static_cast<DHUDMessageFadeInOut *>(other)->FadeInTics;
+}
+
+//============================================================================
+//
+// DHUDMessageFadeInOut :: ResetTimer
+//
+//============================================================================
+
+void DHUDMessageFadeInOut::ResetTimer ()
+{
+	Tics = 0;
+	State = FadeInTics == 0;
+}
+
 //============================================================================
 //
 // DHUDMessageFadeInOut :: DoDraw
@@ -713,6 +840,7 @@ DHUDMessageTypeOnFadeOut::DHUDMessageTypeOnFadeOut (FFont *font, const char *tex
 	if (TypeOnTime == 0.f)
 		TypeOnTime = 0.1f;
 	CurrLine = 0;
+	EnsureLayout ();	// the line lengths are needed right away
 	LineLen = (int)Lines[0].Text.Len();
 	LineVisible = 0;
 	State = 3;
@@ -817,6 +945,34 @@ void DHUDMessageTypeOnFadeOut::ScreenSizeChanged ()
 	}
 }
 
+//============================================================================
+//
+// DHUDMessageTypeOnFadeOut :: IsIdenticalTo
+//
+//============================================================================
+
+bool DHUDMessageTypeOnFadeOut::IsIdenticalTo (DHUDMessage *other)
+{
+	return Super::IsIdenticalTo (other) &&
+		TypeOnTime == static_cast<DHUDMessageTypeOnFadeOut *>(other)->TypeOnTime;
+}
+
+//============================================================================
+//
+// DHUDMessageTypeOnFadeOut :: ResetTimer
+//
+//============================================================================
+
+void DHUDMessageTypeOnFadeOut::ResetTimer ()
+{
+	// The constructor breaks the lines immediately, so they are valid here.
+	Tics = 0;
+	State = 3;
+	CurrLine = 0;
+	LineLen = (int)Lines[0].Text.Len();
+	LineVisible = 0;
+}
+
 //============================================================================
 //
 // DHUDMessageTypeOnFadeOut :: DoDraw
@@ -92,10 +92,13 @@ public:
 	{
 		Alpha = alpha;
 	}
+	bool TryStealLayout (DHUDMessage *old);
+	virtual bool IsIdenticalTo (DHUDMessage *other);
+	virtual void ResetTimer ();
 	void SetNoWrap(bool nowrap)
 	{
 		NoWrap = nowrap;
-		ResetText(SourceText);
+		LayoutDone = false;
 	}
 	void SetClipRect(int x, int y, int width, int height, bool aspect)
 	{
@@ -108,10 +111,21 @@ public:
 	void SetWrapWidth(int wrap)
 	{
 		WrapWidth = wrap;
-		ResetText(SourceText);
+		LayoutDone = false;
 	}
 
 protected:
+	// Breaking the text into lines is deferred until it is needed, so that
+	// a message replacing an identical one can take over its layout.
+	void EnsureLayout()
+	{
+		if (!LayoutDone)
+		{
+			ResetText(SourceText);
+		}
+	}
+
+	bool LayoutDone;
 	FBrokenLines *Lines;
 	int Width, Height, NumLines;
 	float Left, Top;
@@ -160,6 +174,8 @@ public:
 	virtual void Serialize(FSerializer &arc);
 	virtual void DoDraw (int linenum, int x, int y, bool clean, int hudheight);
 	virtual bool Tick ();
+	virtual bool IsIdenticalTo (DHUDMessage *other);
+	virtual void ResetTimer ();
 
 protected:
 	int FadeOutTics;
@@ -179,6 +195,8 @@ public:
 	virtual void Serialize(FSerializer &arc);
 	virtual void DoDraw (int linenum, int x, int y, bool clean, int hudheight);
 	virtual bool Tick ();
+	virtual bool IsIdenticalTo (DHUDMessage *other);
+	virtual void ResetTimer ();
 
 protected:
 	int FadeInTics;
@@ -199,6 +217,8 @@ public:
 	virtual void DoDraw (int linenum, int x, int y, bool clean, int hudheight);
 	virtual bool Tick ();
 	virtual void ScreenSizeChanged ();
+	virtual bool IsIdenticalTo (DHUDMessage *other);
+	virtual void ResetTimer ();
 
 protected:
 	float TypeOnTime;
@@ -203,6 +203,17 @@ class SBarInfoCommand
 		SBarInfo	*script;
 };
 
+// Note for anyone eyeing the per-frame tree walk below as an optimization
+// target: flattening the resolved command tree into a linear draw list was
+// tried and rejected. Several flow controls override Draw with real per-frame
+// work (CommandDrawImage draws and then conditionally descends, CommandAlpha
+// swaps out the block context for its subtree), so a flat program would need
+// every such override split into emit-style ops - a rewrite of all of
+// sbarinfo_commands.cpp for little gain. The expensive state checks already
+// run only from Tick with change detection (see the cache members in
+// CommandDrawString and friends); what Draw does each frame is mostly
+// coordinate math that must be redone anyway because it depends on the
+// current screen size, and the submission side is batched by the backends.
 class SBarInfoCommandFlowControl : public SBarInfoCommand
 {
 	public:
@@ -407,7 +407,22 @@ void DBaseStatusBar::AttachMessage (DHUDMessage *msg, DWORD id, int layer)
 	old = (id == 0 || id == 0xFFFFFFFF) ? NULL : DetachMessage (id);
 	if (old != NULL)
 	{
-		old->Destroy();
+		if (old->IsIdenticalTo (msg))
+		{
+			// Scripts that refresh an unchanged message every tic only need
+			// the timer restarted. Keeping the old object avoids feeding the
+			// garbage collector and dirtying the view border each time.
+			old->ResetTimer ();
+			msg->Destroy ();
+			msg = old;
+		}
+		else
+		{
+			// If the replacement shows the same text with the same layout
+			// settings, reuse the old message's broken lines.
+			msg->TryStealLayout (old);
+			old->Destroy();
+		}
 	}
 
 	// Merge unknown layers into the default layer.
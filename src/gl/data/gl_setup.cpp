@@ -706,6 +706,7 @@ void gl_CleanLevelData()
 		delete portals[i];
 	}
 	portals.Clear();
+	gl_DeleteFakeFlatCache();
 }
 
 
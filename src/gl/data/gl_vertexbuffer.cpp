@@ -128,6 +128,7 @@ void FSimpleVertexBuffer::set(FSimpleVertex *verts, int count)
 FFlatVertexBuffer::FFlatVertexBuffer(int width, int height)
 : FVertexBuffer(!gl.legacyMode)
 {
+	glGenBuffers(1, &ibo_id);	// The index buffer can always be a real buffer.
 	switch (gl.buffermethod)
 	{
 	case BM_PERSISTENT:
@@ -159,6 +160,10 @@ FFlatVertexBuffer::FFlatVertexBuffer(int width, int height)
 	}
 	mIndex = mCurIndex = 0;
 	mNumReserved = NUM_RESERVED;
+	mRegion = 0;
+	mCurStart = 0;
+	mCurLimit = BUFFER_SIZE_TO_USE;
+	memset(mFences, 0, sizeof(mFences));
 	vbo_shadowdata.Resize(mNumReserved);
 
 	// the first quad is reserved for handling coordinates through uniforms.
@@ -201,12 +206,23 @@ FFlatVertexBuffer::FFlatVertexBuffer(int width, int height)
 
 FFlatVertexBuffer::~FFlatVertexBuffer()
 {
+	for (int i = 0; i < NUM_REGIONS; ++i)
+	{
+		if (mFences[i] != NULL)
+		{
+			glDeleteSync(mFences[i]);
+		}
+	}
 	if (vbo_id != 0)
 	{
 		glBindBuffer(GL_ARRAY_BUFFER, vbo_id);
 		glUnmapBuffer(GL_ARRAY_BUFFER);
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
+	if (ibo_id != 0)
+	{
+		glDeleteBuffers(1, &ibo_id);
+	}
 	if (gl.legacyMode)
 	{
 		delete[] map;
@@ -228,6 +244,7 @@ void FFlatVertexBuffer::OutputResized(int width, int height)
 
 void FFlatVertexBuffer::BindVBO()
 {
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_id);
 	glBindBuffer(GL_ARRAY_BUFFER, vbo_id);
 	if (!gl.legacyMode)
 	{
@@ -272,6 +289,48 @@ void FFlatVertexBuffer::Unmap()
 	}
 }
 
+//==========================================================================
+//
+// Prepares the streaming space for a new frame.
+//
+// For persistent buffers that space is a ring of NUM_REGIONS frame-sized
+// regions: a fence is dropped behind the region that was just written and
+// the region being entered is waited on, so writes can never land in
+// memory the GPU is still drawing from. The wait only actually blocks if
+// the GPU has fallen more than NUM_REGIONS-1 frames behind.
+//
+//==========================================================================
+
+void FFlatVertexBuffer::Reset()
+{
+	if (gl.buffermethod == BM_PERSISTENT)
+	{
+		unsigned int regionsize = (BUFFER_SIZE_TO_USE - mIndex) / NUM_REGIONS;
+
+		if (mFences[mRegion] != NULL)
+		{
+			glDeleteSync(mFences[mRegion]);
+		}
+		mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		mRegion = (mRegion + 1) % NUM_REGIONS;
+		if (mFences[mRegion] != NULL)
+		{
+			glClientWaitSync(mFences[mRegion], GL_SYNC_FLUSH_COMMANDS_BIT, (GLuint64)1000000000);
+			glDeleteSync(mFences[mRegion]);
+			mFences[mRegion] = NULL;
+		}
+		mCurStart = mIndex + mRegion * regionsize;
+		mCurLimit = mCurStart + regionsize;
+	}
+	else
+	{
+		mCurStart = mIndex;
+		mCurLimit = BUFFER_SIZE_TO_USE;
+	}
+	mCurIndex = mCurStart;
+}
+
 //==========================================================================
 //
 // Initialize a single vertex
@@ -329,12 +388,24 @@ int FFlatVertexBuffer::CreateSubsectorVertices(subsector_t *sub, const secplane_
 int FFlatVertexBuffer::CreateSectorVertices(sector_t *sec, const secplane_t &plane, int floor)
 {
 	int rt = vbo_shadowdata.Size();
+	int istart = ibo_data.Size();
 	// First calculate the vertices for the sector itself
 	for(int j=0; j<sec->subsectorcount; j++)
 	{
 		subsector_t *sub = sec->subsectors[j];
+		int vi = vbo_shadowdata.Size();
 		CreateSubsectorVertices(sub, plane, floor);
+		// Pretriangulate the fan so that the whole run can later go out
+		// as a single indexed draw.
+		for (unsigned int k = 2; k < sub->numlines; k++)
+		{
+			ibo_data.Push(vi);
+			ibo_data.Push(vi + k - 1);
+			ibo_data.Push(vi + k);
+		}
 	}
+	FIboRange range = { istart, (int)ibo_data.Size() - istart };
+	mIndexRanges.Insert(rt, range);
 	return rt;
 }
 
@@ -420,6 +491,24 @@ void FFlatVertexBuffer::CreateFlatVBO()
 	}
 }
 
+//==========================================================================
+//
+// Looks up the index range covering the fan triangulation of the
+// subsector run that starts at the given vertex index. Returns false for
+// runs that produced no triangles, in which case the caller has to fall
+// back to per-subsector drawing.
+//
+//==========================================================================
+
+bool FFlatVertexBuffer::GetIndexRange(int vindex, int *start, int *count)
+{
+	FIboRange *range = mIndexRanges.CheckKey(vindex);
+	if (range == nullptr || range->count == 0) return false;
+	*start = range->start;
+	*count = range->count;
+	return true;
+}
+
 //==========================================================================
 //
 //
@@ -433,7 +522,19 @@ void FFlatVertexBuffer::UpdatePlaneVertices(sector_t *sec, int plane)
 	secplane_t &splane = sec->GetSecPlane(plane);
 	FFlatVertex *vt = &vbo_shadowdata[startvt];
 	FFlatVertex *mapvt = &map[startvt];
-	for(int i=0; i<countvt; i++, vt++, mapvt++)
+	if (!splane.isSlope())
+	{
+		// The overwhelmingly common case: a horizontal plane has the same
+		// height everywhere, so don't evaluate the plane equation per vertex.
+		float z = (float)splane.ZatPoint(0., 0.);
+		if (plane == sector_t::floor && sec->transdoor) z -= 1;
+		for(int i=0; i<countvt; i++, vt++, mapvt++)
+		{
+			vt->z = z;
+			mapvt->z = z;
+		}
+	}
+	else for(int i=0; i<countvt; i++, vt++, mapvt++)
 	{
 		vt->z = splane.ZatPoint(vt->x, vt->y);
 		if (plane == sector_t::floor && sec->transdoor) vt->z -= 1;
@@ -450,8 +551,38 @@ void FFlatVertexBuffer::UpdatePlaneVertices(sector_t *sec, int plane)
 void FFlatVertexBuffer::CreateVBO()
 {
 	vbo_shadowdata.Resize(mNumReserved);
+	ibo_data.Clear();
+	mIndexRanges.Clear();
 	CreateFlatVBO();
 	mCurIndex = mIndex = vbo_shadowdata.Size();
+
+	if (ibo_data.Size() > 0)
+	{
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_id);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, ibo_data.Size() * sizeof(unsigned int), &ibo_data[0], GL_STATIC_DRAW);
+	}
+
+	// The buffer is being rewritten wholesale, so any fences from the
+	// previous map's frames are stale.
+	for (int i = 0; i < NUM_REGIONS; ++i)
+	{
+		if (mFences[i] != NULL)
+		{
+			glDeleteSync(mFences[i]);
+			mFences[i] = NULL;
+		}
+	}
+	mRegion = 0;
+	mCurStart = mIndex;
+	if (gl.buffermethod == BM_PERSISTENT)
+	{
+		mCurLimit = mCurStart + (BUFFER_SIZE_TO_USE - mIndex) / NUM_REGIONS;
+	}
+	else
+	{
+		mCurLimit = BUFFER_SIZE_TO_USE;
+	}
+
 	Map();
 	memcpy(map, &vbo_shadowdata[0], vbo_shadowdata.Size() * sizeof(FFlatVertex));
 	Unmap();
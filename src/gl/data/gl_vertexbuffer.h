@@ -109,10 +109,34 @@ class FFlatVertexBuffer : public FVertexBuffer
 	unsigned int mCurIndex;
 	unsigned int mNumReserved;
 
+	unsigned int ibo_id;
+
+	// Index ranges of the pretriangulated subsector fans, keyed by the
+	// first vertex of a sector's subsector run in the VBO. Every run is
+	// laid out contiguously, so when all of a sector's subsectors are
+	// visible the whole plane can be drawn with one indexed call.
+	struct FIboRange
+	{
+		int start;
+		int count;
+	};
+	TMap<int, FIboRange> mIndexRanges;
+
+	// With a persistent mapping the streaming space is cut into regions
+	// used round-robin, one per frame, each guarded by a fence so that
+	// new data never lands in memory the GPU is still drawing from.
+	// GLsync is a typedef for this pointer type; the real name cannot be
+	// used here because this header must not include the system GL headers.
+	int mRegion;
+	unsigned int mCurStart;
+	unsigned int mCurLimit;
+	struct __GLsync *mFences[3];
+
 	void CheckPlanes(sector_t *sector);
 
 	static const unsigned int BUFFER_SIZE = 2000000;
 	static const unsigned int BUFFER_SIZE_TO_USE = 1999500;
+	static const int NUM_REGIONS = 3;
 
 public:
 	enum
@@ -127,6 +151,7 @@ public:
 	};
 
 	TArray<FFlatVertex> vbo_shadowdata;	// this is kept around for updating the actual (non-readable) buffer and as stand-in for pre GL 4.x
+	TArray<unsigned int> ibo_data;		// fan triangulations of the static flat geometry, one contiguous range per sector plane
 
 	FFlatVertexBuffer(int width, int height);
 	~FFlatVertexBuffer();
@@ -137,6 +162,7 @@ public:
 
 	void CreateVBO();
 	void CheckUpdate(sector_t *sector);
+	bool GetIndexRange(int vindex, int *start, int *count);
 
 	FFlatVertex *GetBuffer()
 	{
@@ -147,7 +173,7 @@ public:
 		FFlatVertex *p = GetBuffer();
 		*poffset = mCurIndex;
 		mCurIndex += num;
-		if (mCurIndex >= BUFFER_SIZE_TO_USE) mCurIndex = mIndex;
+		if (mCurIndex >= mCurLimit) mCurIndex = mCurStart;
 		return p;
 	}
 
@@ -157,17 +183,26 @@ public:
 		unsigned int diff = newofs - mCurIndex;
 		*poffset = mCurIndex;
 		mCurIndex = newofs;
-		if (mCurIndex >= BUFFER_SIZE_TO_USE) mCurIndex = mIndex;
+		if (mCurIndex >= mCurLimit) mCurIndex = mCurStart;
 		return diff;
 	}
 #ifdef __GL_PCH_H	// we need the system includes for this but we cannot include them ourselves without creating #define clashes. The affected files wouldn't try to draw anyway.
 	void RenderArray(unsigned int primtype, unsigned int offset, unsigned int count)
 	{
 		drawcalls.Clock();
+		scene_drawcalls++;
 		glDrawArrays(primtype, offset, count);
 		drawcalls.Unclock();
 	}
 
+	void RenderIndexed(unsigned int primtype, int start, int count)
+	{
+		drawcalls.Clock();
+		scene_drawcalls++;
+		glDrawElements(primtype, count, GL_UNSIGNED_INT, (const void *)(intptr_t)(start * sizeof(unsigned int)));
+		drawcalls.Unclock();
+	}
+
 	void RenderCurrent(FFlatVertex *newptr, unsigned int primtype, unsigned int *poffset = NULL, unsigned int *pcount = NULL)
 	{
 		unsigned int offset;
@@ -178,10 +213,7 @@ public:
 	}
 
 #endif
-	void Reset()
-	{
-		mCurIndex = mIndex;
-	}
+	void Reset();
 
 	void Map();
 	void Unmap();
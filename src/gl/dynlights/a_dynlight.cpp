@@ -177,6 +177,7 @@ void ADynamicLight::PostSerialize()
 	// The default constructor which is used for creating objects before deserialization will not set this variable.
 	// It needs to be true for all placed lights.
 	visibletoplayer = true;
+	m_locationValid = false;
 	LinkLight();
 }
 
@@ -193,6 +194,7 @@ void ADynamicLight::BeginPlay()
 	m_Radius[0] = args[LIGHT_INTENSITY];
 	m_Radius[1] = args[LIGHT_SECONDARY_INTENSITY];
 	visibletoplayer = true;
+	m_locationValid = false;
 }
 
 //==========================================================================
@@ -382,20 +384,34 @@ void ADynamicLight::UpdateLocation()
 	{
 		if (target)
 		{
-			DAngle angle = target->Angles.Yaw;
-			double s = angle.Sin();
-			double c = angle.Cos();
-
-			DVector3 pos = target->Vec3Offset(m_off.X * c + m_off.Y * s, m_off.X * s - m_off.Y * c, m_off.Z + target->GetBobOffset());
-			SetXYZ(pos); // attached lights do not need to go into the regular blockmap
-			Prev = target->Pos();
-			subsector = R_PointInSubsector(Prev);
-			Sector = subsector->sector;
-
-			// Some z-coordinate fudging to prevent the light from getting too close to the floor or ceiling planes. With proper attenuation this would render them invisible.
-			// A distance of 5 is needed so that the light's effect doesn't become too small.
-			if (Z() < target->floorz + 5.) 	SetZ(target->floorz + 5.);
-			else if (Z() > target->ceilingz - 5.) 	SetZ(target->ceilingz - 5.);
+			// Most attached lights hang on owners that never move (torches,
+			// lamps and the like), so only recompute the position and redo
+			// the subsector search when one of its inputs has changed.
+			double bob = target->GetBobOffset();
+			if (!m_locationValid || target->Pos() != Prev || target->Angles.Yaw != m_lastUpdateAngle ||
+				bob != m_lastUpdateBob || target->floorz != m_lastUpdateFloorZ || target->ceilingz != m_lastUpdateCeilingZ)
+			{
+				m_locationValid = true;
+				m_lastUpdateAngle = target->Angles.Yaw;
+				m_lastUpdateBob = bob;
+				m_lastUpdateFloorZ = target->floorz;
+				m_lastUpdateCeilingZ = target->ceilingz;
+
+				DAngle angle = target->Angles.Yaw;
+				double s = angle.Sin();
+				double c = angle.Cos();
+
+				DVector3 pos = target->Vec3Offset(m_off.X * c + m_off.Y * s, m_off.X * s - m_off.Y * c, m_off.Z + bob);
+				SetXYZ(pos); // attached lights do not need to go into the regular blockmap
+				Prev = target->Pos();
+				subsector = R_PointInSubsector(Prev);
+				Sector = subsector->sector;
+
+				// Some z-coordinate fudging to prevent the light from getting too close to the floor or ceiling planes. With proper attenuation this would render them invisible.
+				// A distance of 5 is needed so that the light's effect doesn't become too small.
+				if (Z() < target->floorz + 5.) 	SetZ(target->floorz + 5.);
+				else if (Z() > target->ceilingz - 5.) 	SetZ(target->ceilingz - 5.);
+			}
 		}
 		else
 		{
@@ -447,6 +463,7 @@ void ADynamicLight::SetOrigin(double x, double y, double z, bool moving)
 void ADynamicLight::SetOffset(const DVector3 &pos)
 {
 	m_off = pos;
+	m_locationValid = false;
 	UpdateLocation();
 }
 
@@ -133,6 +133,16 @@ protected:
 	FCycler m_cycler;
 	subsector_t * subsector;
 
+	// Cached inputs of the last UpdateLocation for attached lights. If none
+	// of them changed the owner has not moved, and the position and
+	// subsector search can be skipped. Not serialized; deserialized lights
+	// start out invalid and recompute on their first tick.
+	DAngle m_lastUpdateAngle;
+	double m_lastUpdateBob;
+	double m_lastUpdateFloorZ;
+	double m_lastUpdateCeilingZ;
+	bool m_locationValid;
+
 public:
 	int m_Radius[2];
 	BYTE lightflags;
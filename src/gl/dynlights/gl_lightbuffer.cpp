@@ -40,6 +40,8 @@ FLightBuffer::FLightBuffer()
 {
 
 	mBufferSize = INITIAL_BUFFER_SIZE;
+	mIndex = 0;
+	mClearGen = 0;
 	mByteSize = mBufferSize * sizeof(float);
 	if (gl.flags & RFL_SHADER_STORAGE_BUFFER)
 	{
@@ -81,9 +83,19 @@ FLightBuffer::~FLightBuffer()
 
 void FLightBuffer::Clear()
 {
+	// If the last frame came close to filling the buffer, grow it now.
+	// Between frames nothing needs to be copied over, so this avoids the
+	// expensive mid-frame reallocation path for all but the first frame
+	// with a sudden spike in light counts.
+	if (mIndex > mBufferSize / 8)
+	{
+		GrowBuffer(false);
+	}
+
 	mIndex = 0;
 	mIndices.Clear();
 	mUploadIndex = 0;
+	mClearGen++;	// invalidates all cached upload indices from the last frame
 }
 
 int FLightBuffer::UploadLights(FDynLightData &data)
@@ -123,37 +135,7 @@ int FLightBuffer::UploadLights(FDynLightData &data)
 	if (mIndex + totalsize > mBufferSize/4)
 	{
 		// reallocate the buffer with twice the size
-		unsigned int newbuffer;
-
-		// first unmap the old buffer
-		glBindBuffer(mBufferType, mBufferId);
-		glUnmapBuffer(mBufferType);
-
-		// create and bind the new buffer, bind the old one to a copy target (too bad that DSA is not yet supported well enough to omit this crap.)
-		glGenBuffers(1, &newbuffer);
-		glBindBufferBase(mBufferType, LIGHTBUF_BINDINGPOINT, newbuffer);
-		glBindBuffer(mBufferType, newbuffer);	// Note: Some older AMD drivers don't do that in glBindBufferBase, as they should.
-		glBindBuffer(GL_COPY_READ_BUFFER, mBufferId);
-
-		// create the new buffer's storage (twice as large as the old one)
-		mBufferSize *= 2;
-		mByteSize *= 2;
-		if (gl.lightmethod == LM_DIRECT)
-		{
-			glBufferStorage(mBufferType, mByteSize, NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
-			mBufferPointer = (float*)glMapBufferRange(mBufferType, 0, mByteSize, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
-		}
-		else
-		{
-			glBufferData(mBufferType, mByteSize, NULL, GL_DYNAMIC_DRAW);
-			mBufferPointer = (float*)glMapBufferRange(mBufferType, 0, mByteSize, GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT);
-		}
-
-		// copy contents and delete the old buffer.
-		glCopyBufferSubData(GL_COPY_READ_BUFFER, mBufferType, 0, 0, mByteSize/2);
-		glBindBuffer(GL_COPY_READ_BUFFER, 0);
-		glDeleteBuffers(1, &mBufferId);
-		mBufferId = newbuffer;
+		GrowBuffer(true);
 	}
 
 	float *copyptr;
@@ -175,6 +157,61 @@ int FLightBuffer::UploadLights(FDynLightData &data)
 	return bufferindex;
 }
 
+//==========================================================================
+//
+// Doubles the buffer. Copying the current contents over is only needed
+// when growing mid-frame; Clear() grows between frames where the buffer
+// holds nothing worth keeping.
+//
+//==========================================================================
+
+void FLightBuffer::GrowBuffer(bool copycontents)
+{
+	unsigned int newbuffer;
+
+	// first unmap the old buffer
+	glBindBuffer(mBufferType, mBufferId);
+	if (mBufferPointer != NULL)
+	{
+		glUnmapBuffer(mBufferType);
+		mBufferPointer = NULL;
+	}
+
+	// create and bind the new buffer, bind the old one to a copy target (too bad that DSA is not yet supported well enough to omit this crap.)
+	glGenBuffers(1, &newbuffer);
+	glBindBufferBase(mBufferType, LIGHTBUF_BINDINGPOINT, newbuffer);
+	glBindBuffer(mBufferType, newbuffer);	// Note: Some older AMD drivers don't do that in glBindBufferBase, as they should.
+	if (copycontents) glBindBuffer(GL_COPY_READ_BUFFER, mBufferId);
+
+	// create the new buffer's storage (twice as large as the old one)
+	mBufferSize *= 2;
+	mByteSize *= 2;
+	if (gl.lightmethod == LM_DIRECT)
+	{
+		glBufferStorage(mBufferType, mByteSize, NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+		mBufferPointer = (float*)glMapBufferRange(mBufferType, 0, mByteSize, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+	}
+	else
+	{
+		glBufferData(mBufferType, mByteSize, NULL, GL_DYNAMIC_DRAW);
+		if (copycontents)
+		{
+			// we are inside a Begin/Finish pair, so remap what we just unmapped
+			mBufferPointer = (float*)glMapBufferRange(mBufferType, 0, mByteSize, GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT);
+		}
+	}
+
+	if (copycontents)
+	{
+		// copy contents and delete the old buffer.
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, mBufferType, 0, 0, mByteSize/2);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	}
+	glDeleteBuffers(1, &mBufferId);
+	mBufferId = newbuffer;
+	mLastMappedIndex = UINT_MAX;	// any range binding still points at the old buffer
+}
+
 void FLightBuffer::Begin()
 {
 	if (gl.lightmethod == LM_DEFERRED)
@@ -18,6 +18,9 @@ class FLightBuffer
 	unsigned int mBlockSize;
 	unsigned int mBufferSize;
 	unsigned int mByteSize;
+	unsigned int mClearGen;
+
+	void GrowBuffer(bool copycontents);
 
 public:
 
@@ -31,6 +34,7 @@ public:
 	unsigned int GetBlockSize() const { return mBlockSize; }
 	unsigned int GetBufferType() const { return mBufferType; }
 	unsigned int GetIndexPtr() const { return mIndices.Size();	}
+	unsigned int GetClearGen() const { return mClearGen; }
 	void StoreIndex(int index) { mIndices.Push(index); }
 	int GetIndex(int i) const { return mIndices[i];	}
 };
@@ -260,6 +260,12 @@ unsigned int FModelVertexBuffer::SetupFrame(unsigned int frame1, unsigned int fr
 		glVertexPointer(3, GL_FLOAT, sizeof(FModelVertex), &vbo_ptr[frame1].x);
 		glTexCoordPointer(2, GL_FLOAT, sizeof(FModelVertex), &vbo_ptr[frame1].u);
 	}
+	else if (gl_RenderState.GetInterpolationFactor() == 1.f)
+	{
+		// fully on the second frame, no need to interpolate anything.
+		glVertexPointer(3, GL_FLOAT, sizeof(FModelVertex), &vbo_ptr[frame2].x);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(FModelVertex), &vbo_ptr[frame1].u);
+	}
 	else
 	{
 		// must interpolate
@@ -267,11 +273,14 @@ unsigned int FModelVertexBuffer::SetupFrame(unsigned int frame1, unsigned int fr
 		glVertexPointer(3, GL_FLOAT, sizeof(FModelVertex), &iBuffer[0].x);
 		glTexCoordPointer(2, GL_FLOAT, sizeof(FModelVertex), &vbo_ptr[frame1].u);
 		float frac = gl_RenderState.GetInterpolationFactor();
+		float inv = 1.f - frac;
+		const FModelVertex *old = &vbo_ptr[frame1];
+		const FModelVertex *nw = &vbo_ptr[frame2];
 		for (unsigned i = 0; i < size; i++)
 		{
-			iBuffer[i].x = vbo_ptr[frame1 + i].x * (1.f - frac) + vbo_ptr[frame2 + i].x * frac;
-			iBuffer[i].y = vbo_ptr[frame1 + i].y * (1.f - frac) + vbo_ptr[frame2 + i].y * frac;
-			iBuffer[i].z = vbo_ptr[frame1 + i].z * (1.f - frac) + vbo_ptr[frame2 + i].z * frac;
+			iBuffer[i].x = old[i].x * inv + nw[i].x * frac;
+			iBuffer[i].y = old[i].y * inv + nw[i].y * frac;
+			iBuffer[i].z = old[i].z * inv + nw[i].z * frac;
 		}
 	}
 	return frame1;
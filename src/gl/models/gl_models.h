@@ -334,7 +334,7 @@ protected:
 	TArray<FModelVertex> mVertices;
 	TArray<unsigned int> mIndices;
 	
-	void MakeSlabPolys(int x, int y, kvxslab_t *voxptr, FVoxelMap &check);
+	void MakeGreedyMesh(FVoxelMap &check);
 	void AddFace(int x1, int y1, int z1, int x2, int y2, int z2, int x3, int y3, int z3, int x4, int y4, int z4, BYTE color, FVoxelMap &check);
 	unsigned int AddVertex(FModelVertex &vert, FVoxelMap &check);
 
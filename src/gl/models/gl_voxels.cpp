@@ -283,77 +283,197 @@ void FVoxelModel::AddFace(int x1, int y1, int z1, int x2, int y2, int z2, int x3
 
 //===========================================================================
 //
-// 
+// Greedy meshing
+//
+// One quad per exposed voxel face adds up to millions of vertices on big
+// voxel packs, so instead of emitting the slab faces directly the voxel is
+// expanded into a dense grid and same-colored coplanar faces are merged
+// into maximal rectangles per face direction. The set of exposed faces is
+// taken from the KVX cull bits, exactly as the old per-slab code did, so
+// the merged mesh covers the same surface.
 //
 //===========================================================================
 
-void FVoxelModel::MakeSlabPolys(int x, int y, kvxslab_t *voxptr, FVoxelMap &check)
+struct FVoxelQuad
 {
-	const BYTE *col = voxptr->col;
-	int zleng = voxptr->zleng;
-	int ztop = voxptr->ztop;
-	int cull = voxptr->backfacecull;
+	int u, v, w, h;
+	BYTE col;
+};
 
-	if (cull & 16)
+static void GreedyMesh2D(TArray<WORD> &mask, int w, int h, TArray<FVoxelQuad> &out)
+{
+	for (int v = 0; v < h; v++)
 	{
-		AddFace(x, y, ztop, x+1, y, ztop, x, y+1, ztop, x+1, y+1, ztop, *col, check);
+		for (int u = 0; u < w; )
+		{
+			WORD c = mask[v*w + u];
+			if (c == 0)
+			{
+				u++;
+				continue;
+			}
+
+			// grow right, then down, as long as the color matches.
+			int qw = 1;
+			while (u + qw < w && mask[v*w + u + qw] == c) qw++;
+			int qh = 1;
+			while (v + qh < h)
+			{
+				bool same = true;
+				for (int k = 0; k < qw; k++)
+				{
+					if (mask[(v + qh)*w + u + k] != c)
+					{
+						same = false;
+						break;
+					}
+				}
+				if (!same) break;
+				qh++;
+			}
+			for (int j = 0; j < qh; j++)
+			{
+				for (int k = 0; k < qw; k++) mask[(v + j)*w + u + k] = 0;
+			}
+
+			FVoxelQuad q = { u, v, qw, qh, (BYTE)(c - 1) };
+			out.Push(q);
+			u += qw;
+		}
 	}
-	int z = ztop;
-	while (z < ztop+zleng)
-	{
-		int c = 0;
-		while (z+c < ztop+zleng && col[c] == col[0]) c++;
+}
 
-		if (cull & 1)
+void FVoxelModel::MakeGreedyMesh(FVoxelMap &check)
+{
+	FVoxelMipLevel *mip = &mVoxel->Mips[0];
+	const int sx = mip->SizeX, sy = mip->SizeY, sz = mip->SizeZ;
+
+	// Expand the slab data into dense color and cull bit grids. The side
+	// cull bits apply to the whole slab, the top and bottom ones only to
+	// the first and last voxel in it.
+	TArray<BYTE> cols, cull;
+	cols.Resize(sx*sy*sz);
+	cull.Resize(sx*sy*sz);
+	memset(&cull[0], 0, sx*sy*sz);
+
+	for (int x = 0; x < sx; x++)
+	{
+		BYTE *slabxoffs = &mip->SlabData[mip->OffsetX[x]];
+		short *xyoffs = &mip->OffsetXY[x * (sy + 1)];
+		for (int y = 0; y < sy; y++)
 		{
-			AddFace(x, y, z, x, y+1, z, x, y, z+c, x, y+1, z+c, *col, check);
+			kvxslab_t *voxptr = (kvxslab_t *)(slabxoffs + xyoffs[y]);
+			kvxslab_t *voxend = (kvxslab_t *)(slabxoffs + xyoffs[y+1]);
+			for (; voxptr < voxend; voxptr = (kvxslab_t *)((BYTE *)voxptr + voxptr->zleng + 3))
+			{
+				int base = (x*sy + y)*sz + voxptr->ztop;
+				for (int i = 0; i < voxptr->zleng; i++)
+				{
+					BYTE c = voxptr->backfacecull & 15;
+					if (i == 0) c |= voxptr->backfacecull & 16;
+					if (i == voxptr->zleng - 1) c |= voxptr->backfacecull & 32;
+					cols[base + i] = voxptr->col[i];
+					cull[base + i] = c;
+				}
+			}
 		}
-		if (cull & 2)
+	}
+
+	TArray<WORD> mask;
+	TArray<FVoxelQuad> quads;
+
+	// X facing sides, masks span (y, z)
+	mask.Resize(sy*sz);
+	for (int x = 0; x < sx; x++)
+	{
+		for (int side = 0; side < 2; side++)
 		{
-			AddFace(x+1, y+1, z, x+1, y, z, x+1, y+1, z+c, x+1, y, z+c, *col, check);
+			const BYTE bit = 1 << side;
+			for (int z = 0; z < sz; z++)
+			{
+				for (int y = 0; y < sy; y++)
+				{
+					int i = (x*sy + y)*sz + z;
+					mask[z*sy + y] = (cull[i] & bit) ? cols[i] + 1 : 0;
+				}
+			}
+			quads.Clear();
+			GreedyMesh2D(mask, sy, sz, quads);
+			for (unsigned i = 0; i < quads.Size(); i++)
+			{
+				const FVoxelQuad &q = quads[i];
+				int y0 = q.u, y1 = q.u + q.w, z0 = q.v, z1 = q.v + q.h;
+				if (side == 0) AddFace(x, y0, z0, x, y1, z0, x, y0, z1, x, y1, z1, q.col, check);
+				else AddFace(x+1, y1, z0, x+1, y0, z0, x+1, y1, z1, x+1, y0, z1, q.col, check);
+			}
 		}
-		if (cull & 4)
+	}
+
+	// Y facing sides, masks span (x, z)
+	mask.Resize(sx*sz);
+	for (int y = 0; y < sy; y++)
+	{
+		for (int side = 0; side < 2; side++)
 		{
-			AddFace(x+1, y, z, x, y, z, x+1, y, z+c, x, y, z+c, *col, check);
+			const BYTE bit = 4 << side;
+			for (int z = 0; z < sz; z++)
+			{
+				for (int x = 0; x < sx; x++)
+				{
+					int i = (x*sy + y)*sz + z;
+					mask[z*sx + x] = (cull[i] & bit) ? cols[i] + 1 : 0;
+				}
+			}
+			quads.Clear();
+			GreedyMesh2D(mask, sx, sz, quads);
+			for (unsigned i = 0; i < quads.Size(); i++)
+			{
+				const FVoxelQuad &q = quads[i];
+				int x0 = q.u, x1 = q.u + q.w, z0 = q.v, z1 = q.v + q.h;
+				if (side == 0) AddFace(x1, y, z0, x0, y, z0, x1, y, z1, x0, y, z1, q.col, check);
+				else AddFace(x0, y+1, z0, x1, y+1, z0, x0, y+1, z1, x1, y+1, z1, q.col, check);
+			}
 		}
-		if (cull & 8)
-		{
-			AddFace(x, y+1, z, x+1, y+1, z, x, y+1, z+c, x+1, y+1, z+c, *col, check);
-		}	
-		z+=c;
-		col+=c;
 	}
-	if (cull & 32)
+
+	// Z facing tops and bottoms, masks span (x, y)
+	mask.Resize(sx*sy);
+	for (int z = 0; z < sz; z++)
 	{
-		int z = ztop+zleng-1;
-		AddFace(x+1, y, z+1, x, y, z+1, x+1, y+1, z+1, x, y+1, z+1, voxptr->col[zleng-1], check);
+		for (int side = 0; side < 2; side++)
+		{
+			const BYTE bit = 16 << side;
+			for (int y = 0; y < sy; y++)
+			{
+				for (int x = 0; x < sx; x++)
+				{
+					int i = (x*sy + y)*sz + z;
+					mask[y*sx + x] = (cull[i] & bit) ? cols[i] + 1 : 0;
+				}
+			}
+			quads.Clear();
+			GreedyMesh2D(mask, sx, sy, quads);
+			for (unsigned i = 0; i < quads.Size(); i++)
+			{
+				const FVoxelQuad &q = quads[i];
+				int x0 = q.u, x1 = q.u + q.w, y0 = q.v, y1 = q.v + q.h;
+				if (side == 0) AddFace(x0, y0, z, x1, y0, z, x0, y1, z, x1, y1, z, q.col, check);
+				else AddFace(x1, y0, z+1, x0, y0, z+1, x1, y1, z+1, x0, y1, z+1, q.col, check);
+			}
+		}
 	}
 }
 
 //===========================================================================
 //
-// 
+//
 //
 //===========================================================================
 
 void FVoxelModel::Initialize()
 {
 	FVoxelMap check;
-	FVoxelMipLevel *mip = &mVoxel->Mips[0];
-	for (int x = 0; x < mip->SizeX; x++)
-	{
-		BYTE *slabxoffs = &mip->SlabData[mip->OffsetX[x]];
-		short *xyoffs = &mip->OffsetXY[x * (mip->SizeY + 1)];
-		for (int y = 0; y < mip->SizeY; y++)
-		{
-			kvxslab_t *voxptr = (kvxslab_t *)(slabxoffs + xyoffs[y]);
-			kvxslab_t *voxend = (kvxslab_t *)(slabxoffs + xyoffs[y+1]);
-			for (; voxptr < voxend; voxptr = (kvxslab_t *)((BYTE *)voxptr + voxptr->zleng + 3))
-			{
-				MakeSlabPolys(x, y, voxptr, check);
-			}
-		}
-	}
+	MakeGreedyMesh(check);
 }
 
 //===========================================================================
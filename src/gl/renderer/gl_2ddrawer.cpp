@@ -47,6 +47,7 @@ int F2DDrawer::AddData(const F2DDrawer::DataGeneric *data)
 	int addr = mData.Reserve(data->mLen);
 	memcpy(&mData[addr], data, data->mLen);
 	mLastLineCmd = -1;
+	mLastTextureCmd = -1;
 	return addr;
 }
 
@@ -85,7 +86,6 @@ void F2DDrawer::AddTexture(FTexture *img, DrawParms &parms)
 		light = 255 - APART(parms.colorOverlay);
 		parms.colorOverlay = 0;
 	}
-	dg.mVertIndex = (int)mVertices.Reserve(parms.colorOverlay == 0? 4 : 8);
 	dg.mColorOverlay = parms.colorOverlay;
 	dg.mTranslation = 0;
 
@@ -147,6 +147,35 @@ void F2DDrawer::AddTexture(FTexture *img, DrawParms &parms)
 	dg.mScissor[2] = GLRenderer->ScreenToWindowX(parms.rclip) - dg.mScissor[0];
 	dg.mScissor[3] = GLRenderer->ScreenToWindowY(parms.uclip) - dg.mScissor[1];
 
+	// Text output produces long runs of quads that only differ in position
+	// and texture coordinates, e.g. consecutive glyphs from the same font
+	// sheet or the bars around midprints. If everything else matches the
+	// previous command, join this quad to its triangle strip with two
+	// degenerate vertices instead of emitting another draw call.
+	if (mLastTextureCmd >= 0 && parms.colorOverlay == 0)
+	{
+		DataTexture *last = (DataTexture *)&mData[mLastTextureCmd];
+
+		if (last->mColorOverlay == 0 && last->mTexture == dg.mTexture &&
+			last->mTranslation == dg.mTranslation && last->mAlphaTexture == dg.mAlphaTexture &&
+			last->mMasked == dg.mMasked && last->mRenderStyle == dg.mRenderStyle &&
+			memcmp(last->mScissor, dg.mScissor, sizeof(dg.mScissor)) == 0 &&
+			last->mVertIndex + last->mVertCount == (int)mVertices.Size())
+		{
+			int addr = (int)mVertices.Reserve(6);
+			FSimpleVertex *ptr = &mVertices[addr];
+			*ptr = mVertices[addr - 1]; ptr++;
+			ptr->Set(x, y, 0, u1, v1, color); ptr++;
+			ptr->Set(x, y, 0, u1, v1, color); ptr++;
+			ptr->Set(x, y + h, 0, u1, v2, color); ptr++;
+			ptr->Set(x + w, y, 0, u2, v1, color); ptr++;
+			ptr->Set(x + w, y + h, 0, u2, v2, color); ptr++;
+			last->mVertCount += 6;
+			return;
+		}
+	}
+
+	dg.mVertIndex = (int)mVertices.Reserve(parms.colorOverlay == 0? 4 : 8);
 	FSimpleVertex *ptr = &mVertices[dg.mVertIndex];
 	ptr->Set(x, y, 0, u1, v1, color); ptr++;
 	ptr->Set(x, y + h, 0, u1, v2, color); ptr++;
@@ -162,7 +191,7 @@ void F2DDrawer::AddTexture(FTexture *img, DrawParms &parms)
 		ptr->Set(x + w, y + h, 0, u2, v2, color); ptr++;
 		dg.mVertCount = 8;
 	}
-	AddData(&dg);
+	mLastTextureCmd = AddData(&dg);
 }
 
 
@@ -362,7 +391,61 @@ void F2DDrawer::AddPixel(int x1, int y1, int palcolor, uint32 color)
 
 //==========================================================================
 //
+// SameState
 //
+// True if two commands can be drawn with one render state setup.
+//
+//==========================================================================
+
+bool F2DDrawer::SameState(const DataGeneric *a, const DataGeneric *b)
+{
+	if (a->mType != b->mType) return false;
+	switch (a->mType)
+	{
+	case DrawTypeTexture:
+	{
+		const DataTexture *ta = static_cast<const DataTexture*>(a);
+		const DataTexture *tb = static_cast<const DataTexture*>(b);
+		// Overlay commands switch blending mid-draw, so leave them alone.
+		if (ta->mColorOverlay != 0 || tb->mColorOverlay != 0) return false;
+		return ta->mTexture == tb->mTexture && ta->mTranslation == tb->mTranslation &&
+			ta->mAlphaTexture == tb->mAlphaTexture && ta->mMasked == tb->mMasked &&
+			ta->mRenderStyle == tb->mRenderStyle &&
+			memcmp(ta->mScissor, tb->mScissor, sizeof(ta->mScissor)) == 0;
+	}
+
+	case DrawTypePoly:
+	{
+		const DataSimplePoly *pa = static_cast<const DataSimplePoly*>(a);
+		const DataSimplePoly *pb = static_cast<const DataSimplePoly*>(b);
+		return pa->mTexture == pb->mTexture && pa->mColormap == pb->mColormap &&
+			pa->mLightLevel == pb->mLightLevel;
+	}
+
+	case DrawTypeFlatFill:
+		return static_cast<const DataFlatFill*>(a)->mTexture == static_cast<const DataFlatFill*>(b)->mTexture;
+
+	case DrawTypeDim:
+	case DrawTypeLine:
+	case DrawTypePixel:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+//==========================================================================
+//
+// Draw
+//
+// The commands are submitted in paint order and alpha blending makes that
+// order significant, so they cannot simply be sorted by render state. A
+// command may, however, be drawn earlier than submitted if it doesn't
+// overlap anything submitted in between. Group the commands into runs of
+// identical state under that constraint; a complex menu produces hundreds
+// of commands but only a handful of distinct states, and setting up the
+// state is what's expensive, not the draw calls.
 //
 //==========================================================================
 
@@ -376,10 +459,70 @@ void F2DDrawer::Draw()
 	// but We cannot use the software light mode here because it doesn't properly calculate the light for 2D rendering.
 	if (glset.lightmode == 8) glset.lightmode = 0;
 
-	set(&mVertices[0], mVertices.Size());
+	// Collect the commands and their screen bounds. Screen coordinates live
+	// in the x and z members of FSimpleVertex.
+	struct DrawRun
+	{
+		TArray<int> mCmds;
+		float mBounds[4];
+	};
+	TArray<DrawRun> runs;
+
 	for (unsigned i = 0; i < mData.Size();)
 	{
 		DataGeneric *dg = (DataGeneric *)&mData[i];
+
+		float bounds[4] = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+		int vcount = MIN(dg->mVertCount, (int)mVertices.Size() - dg->mVertIndex);
+		for (int v = 0; v < vcount; v++)
+		{
+			const FSimpleVertex &vtx = mVertices[dg->mVertIndex + v];
+			bounds[0] = MIN(bounds[0], vtx.x);
+			bounds[1] = MIN(bounds[1], vtx.z);
+			bounds[2] = MAX(bounds[2], vtx.x);
+			bounds[3] = MAX(bounds[3], vtx.z);
+		}
+
+		// Scan the runs from newest to oldest. Joining a run draws this
+		// command before everything in the runs behind it, which is only
+		// safe while none of those overlap it on screen.
+		int target = -1;
+		for (int r = (int)runs.Size() - 1; r >= 0; r--)
+		{
+			if (SameState(dg, (DataGeneric *)&mData[runs[r].mCmds[0]]))
+			{
+				target = r;
+				break;
+			}
+			if (bounds[0] < runs[r].mBounds[2] && bounds[2] > runs[r].mBounds[0] &&
+				bounds[1] < runs[r].mBounds[3] && bounds[3] > runs[r].mBounds[1])
+			{
+				break;
+			}
+		}
+		if (target == -1)
+		{
+			DrawRun run;
+			memcpy(run.mBounds, bounds, sizeof(bounds));
+			target = (int)runs.Push(run);
+		}
+		else
+		{
+			runs[target].mBounds[0] = MIN(runs[target].mBounds[0], bounds[0]);
+			runs[target].mBounds[1] = MIN(runs[target].mBounds[1], bounds[1]);
+			runs[target].mBounds[2] = MAX(runs[target].mBounds[2], bounds[2]);
+			runs[target].mBounds[3] = MAX(runs[target].mBounds[3], bounds[3]);
+		}
+		runs[target].mCmds.Push((int)i);
+		i += dg->mLen;
+	}
+
+	set(&mVertices[0], mVertices.Size());
+	for (unsigned r = 0; r < runs.Size(); r++)
+	{
+		const TArray<int> &cmds = runs[r].mCmds;
+		DataGeneric *dg = (DataGeneric *)&mData[cmds[0]];
+
 		// DrawTypePoly may not use the color part of the vertex buffer because it needs to use gl_SetColor to produce proper output.
 		if (lasttype == DrawTypePoly && dg->mType != DrawTypePoly)
 		{
@@ -411,11 +554,16 @@ void F2DDrawer::Draw()
 			gl_RenderState.AlphaFunc(GL_GEQUAL, 0.f);
 			gl_RenderState.Apply();
 
-			glDrawArrays(GL_TRIANGLE_STRIP, dt->mVertIndex, 4);
+			for (unsigned c = 0; c < cmds.Size(); c++)
+			{
+				DataTexture *dc = (DataTexture *)&mData[cmds[c]];
+				glDrawArrays(GL_TRIANGLE_STRIP, dc->mVertIndex, dc->mColorOverlay == 0 ? dc->mVertCount : 4);
+			}
 
 			gl_RenderState.BlendEquation(GL_FUNC_ADD);
-			if (dt->mVertCount > 4)
+			if (dt->mColorOverlay != 0)
 			{
+				// overlay commands are never batched (see SameState).
 				gl_RenderState.SetTextureMode(TM_MASK);
 				gl_RenderState.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 				gl_RenderState.Apply();
@@ -439,7 +587,11 @@ void F2DDrawer::Draw()
 			gl_SetColor(dsp->mLightLevel, 0, cm, 1.f);
 			gl_RenderState.SetMaterial(dsp->mTexture, CLAMP_NONE, 0, -1, false);
 			gl_RenderState.Apply();
-			glDrawArrays(GL_TRIANGLE_FAN, dsp->mVertIndex, dsp->mVertCount);
+			for (unsigned c = 0; c < cmds.Size(); c++)
+			{
+				DataSimplePoly *dc = (DataSimplePoly *)&mData[cmds[c]];
+				glDrawArrays(GL_TRIANGLE_FAN, dc->mVertIndex, dc->mVertCount);
+			}
 			break;
 		}
 
@@ -448,7 +600,11 @@ void F2DDrawer::Draw()
 			DataFlatFill *dff = static_cast<DataFlatFill*>(dg);
 			gl_RenderState.SetMaterial(dff->mTexture, CLAMP_NONE, 0, -1, false);
 			gl_RenderState.Apply();
-			glDrawArrays(GL_TRIANGLE_STRIP, dg->mVertIndex, dg->mVertCount);
+			for (unsigned c = 0; c < cmds.Size(); c++)
+			{
+				DataGeneric *dc = (DataGeneric *)&mData[cmds[c]];
+				glDrawArrays(GL_TRIANGLE_STRIP, dc->mVertIndex, dc->mVertCount);
+			}
 			break;
 		}
 
@@ -457,26 +613,37 @@ void F2DDrawer::Draw()
 			gl_RenderState.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 			gl_RenderState.AlphaFunc(GL_GREATER, 0);
 			gl_RenderState.Apply();
-			glDrawArrays(GL_TRIANGLE_FAN, dg->mVertIndex, dg->mVertCount);
+			for (unsigned c = 0; c < cmds.Size(); c++)
+			{
+				DataGeneric *dc = (DataGeneric *)&mData[cmds[c]];
+				glDrawArrays(GL_TRIANGLE_FAN, dc->mVertIndex, dc->mVertCount);
+			}
 			gl_RenderState.EnableTexture(true);
 			break;
 
 		case DrawTypeLine:
 			gl_RenderState.EnableTexture(false);
 			gl_RenderState.Apply();
-			glDrawArrays(GL_LINES, dg->mVertIndex, dg->mVertCount);
+			for (unsigned c = 0; c < cmds.Size(); c++)
+			{
+				DataGeneric *dc = (DataGeneric *)&mData[cmds[c]];
+				glDrawArrays(GL_LINES, dc->mVertIndex, dc->mVertCount);
+			}
 			gl_RenderState.EnableTexture(true);
 			break;
 
 		case DrawTypePixel:
 			gl_RenderState.EnableTexture(false);
 			gl_RenderState.Apply();
-			glDrawArrays(GL_POINTS, dg->mVertIndex, dg->mVertCount);
+			for (unsigned c = 0; c < cmds.Size(); c++)
+			{
+				DataGeneric *dc = (DataGeneric *)&mData[cmds[c]];
+				glDrawArrays(GL_POINTS, dc->mVertIndex, dc->mVertCount);
+			}
 			gl_RenderState.EnableTexture(true);
 			break;
 
 		}
-		i += dg->mLen;
 	}
 	gl_RenderState.SetVertexBuffer(GLRenderer->mVBO);
 	glset.lightmode = savedlightmode;
@@ -486,4 +653,6 @@ void F2DDrawer::Clear()
 {
 	mVertices.Clear();
 	mData.Clear();
+	mLastLineCmd = -1;
+	mLastTextureCmd = -1;
 }
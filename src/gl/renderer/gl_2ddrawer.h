@@ -50,8 +50,10 @@ class F2DDrawer : public FSimpleVertexBuffer
 	TArray<FSimpleVertex> mVertices;
 	TArray<uint8_t> mData;
 	int mLastLineCmd = -1;	// consecutive lines can be batched into a single draw call so keep this info around.
-	
+	int mLastTextureCmd = -1;	// the same goes for textured quads with identical state, e.g. glyph runs from one font texture.
+
 	int AddData(const DataGeneric *data);
+	static bool SameState(const DataGeneric *a, const DataGeneric *b);
 	
 public:
 	void AddTexture(FTexture *img, DrawParms &parms);
@@ -228,9 +228,16 @@ extern area_t			in_area;
 
 
 sector_t * gl_FakeFlat(sector_t * sec, sector_t * dest, area_t in_area, bool back);
-inline sector_t * gl_FakeFlat(sector_t * sec, sector_t * dest, bool back)
+
+// The cached variant. The returned copy is owned by the cache and must be
+// treated as read-only; it stays valid for the rest of the viewpoint.
+sector_t * gl_FakeFlat(sector_t * sec, area_t in_area, bool back);
+void gl_RecacheFakeFlats();
+void gl_DeleteFakeFlatCache();
+
+inline sector_t * gl_FakeFlat(sector_t * sec, bool back)
 {
-	return gl_FakeFlat(sec, dest, in_area, back);
+	return gl_FakeFlat(sec, in_area, back);
 }
 
 struct TexFilter_s
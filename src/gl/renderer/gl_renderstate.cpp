@@ -86,6 +86,10 @@ void FRenderState::Reset()
 	stBlendEquation = -1;
 	stAlphaThreshold = -1.f;
 	stAlphaTest = 0;
+	// set the attribute shadows to values no caller ever passes so that the
+	// first Apply after a reset always resubmits them.
+	stColor.Set(-1.f, -1.f, -1.f, -1.f);
+	stNormal.Set(-1000.f, -1000.f, -1000.f, -1000.f);
 	mLastDepthClamp = true;
 	mInterpolationFactor = 0.0f;
 
@@ -140,8 +144,19 @@ bool FRenderState::ApplyShader()
 		}
 	}
 
-	glVertexAttrib4fv(VATTR_COLOR, mColor.vec);
-	glVertexAttrib4fv(VATTR_NORMAL, mNormal.vec);
+	// The current attribute values are context state, not program state, so
+	// unlike the buffered uniforms below they only need a single shadow copy
+	// that survives shader switches.
+	if (memcmp(mColor.vec, stColor.vec, sizeof(stColor.vec)))
+	{
+		stColor = mColor;
+		glVertexAttrib4fv(VATTR_COLOR, mColor.vec);
+	}
+	if (memcmp(mNormal.vec, stNormal.vec, sizeof(stNormal.vec)))
+	{
+		stNormal = mNormal;
+		glVertexAttrib4fv(VATTR_NORMAL, mNormal.vec);
+	}
 
 	activeShader->muDesaturation.Set(mDesaturation / 255.f);
 	activeShader->muFogEnabled.Set(fogset);
@@ -293,6 +308,8 @@ bool FRenderState::ApplyShader()
 
 void FRenderState::Apply()
 {
+	scene_statechanges++;
+
 	if (!gl_direct_state_change)
 	{
 		if (mSrcBlend != stSrcBlend || mDstBlend != stDstBlend)
@@ -109,6 +109,7 @@ class FRenderState
 	int stSrcBlend, stDstBlend;
 	bool stAlphaTest;
 	int stBlendEquation;
+	FStateVec4 stColor, stNormal;	// last values submitted with glVertexAttrib4fv
 
 	FShader *activeShader;
 
@@ -95,7 +95,6 @@ static void AddLine (seg_t *seg, bool portalclip)
 
 	angle_t startAngle, endAngle;
 	sector_t * backsector = NULL;
-	sector_t bs;
 
 	if (portalclip)
 	{
@@ -157,7 +156,7 @@ static void AddLine (seg_t *seg, bool portalclip)
 			// clipping checks are only needed when the backsector is not the same as the front sector
 			gl_CheckViewArea(seg->v1, seg->v2, seg->frontsector, seg->backsector);
 
-			backsector = gl_FakeFlat(seg->backsector, &bs, true);
+			backsector = gl_FakeFlat(seg->backsector, true);
 
 			if (gl_CheckClip(seg->sidedef, currentsector, backsector))
 			{
@@ -412,7 +411,6 @@ static void DoSubsector(subsector_t * sub)
 	unsigned int i;
 	sector_t * sector;
 	sector_t * fakesector;
-	sector_t fake;
 	
 #ifdef _DEBUG
 	if (sub->sector-sectors==931)
@@ -437,7 +435,7 @@ static void DoSubsector(subsector_t * sub)
 	}
 	if (clipper.IsBlocked()) return;	// if we are inside a stacked sector portal which hasn't unclipped anything yet.
 
-	fakesector=gl_FakeFlat(sector, &fake, false);
+	fakesector=gl_FakeFlat(sector, false);
 
 	if (GLRenderer->mClipPortal)
 	{
@@ -503,7 +501,7 @@ static void DoSubsector(subsector_t * sub)
 					sector = sub->render_sector;
 					// the planes of this subsector are faked to belong to another sector
 					// This means we need the heightsec parts and light info of the render sector, not the actual one.
-					fakesector = gl_FakeFlat(sector, &fake, false);
+					fakesector = gl_FakeFlat(sector, false);
 				}
 
 				BYTE &srf = gl_drawinfo->sectorrenderflags[sub->render_sector->sectornum];
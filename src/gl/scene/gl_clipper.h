@@ -149,6 +149,7 @@ extern Clipper clipper;
 
 angle_t R_PointToPseudoAngle(double x, double y);
 void R_SetView();
+void gl_PrecalcVertexAngles();
 
 // Used to speed up angle calculations during clipping
 inline angle_t vertex_t::GetClipAngle()
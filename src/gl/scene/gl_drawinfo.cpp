@@ -915,8 +915,11 @@ static int diwcmp (const void *a, const void *b)
 	const GLDrawItem * di2 = (const GLDrawItem *)b;
 	GLWall * w2=&sortinfo->walls[di2->index];
 
-	if (w1->gltexture != w2->gltexture) return w1->gltexture - w2->gltexture;
-	return ((w1->flags & 3) - (w2->flags & 3));
+	// Note that a pointer difference does not fit in an int on 64 bit
+	// systems, so the textures have to be compared explicitly.
+	if (w1->gltexture != w2->gltexture) return w1->gltexture < w2->gltexture ? -1 : 1;
+	if ((w1->flags & 3) != (w2->flags & 3)) return (w1->flags & 3) - (w2->flags & 3);
+	return w1->lightlevel - w2->lightlevel;
 }
 
 static int difcmp (const void *a, const void *b)
@@ -927,7 +930,8 @@ static int difcmp (const void *a, const void *b)
 	const GLDrawItem * di2 = (const GLDrawItem *)b;
 	GLFlat* w2=&sortinfo->flats[di2->index];
 
-	return w1->gltexture - w2->gltexture;
+	if (w1->gltexture != w2->gltexture) return w1->gltexture < w2->gltexture ? -1 : 1;
+	return w1->lightlevel - w2->lightlevel;
 }
 
 
@@ -956,7 +960,7 @@ void GLDrawList::SortFlats()
 //==========================================================================
 void GLDrawList::AddWall(GLWall * wall)
 {
-	drawitems.Push(GLDrawItem(GLDIT_WALL,walls.Push(*wall)));
+	drawitems.Emplace(GLDIT_WALL,walls.Push(*wall));
 }
 
 //==========================================================================
@@ -966,7 +970,7 @@ void GLDrawList::AddWall(GLWall * wall)
 //==========================================================================
 void GLDrawList::AddFlat(GLFlat * flat)
 {
-	drawitems.Push(GLDrawItem(GLDIT_FLAT,flats.Push(*flat)));
+	drawitems.Emplace(GLDIT_FLAT,flats.Push(*flat));
 }
 
 //==========================================================================
@@ -976,7 +980,7 @@ void GLDrawList::AddFlat(GLFlat * flat)
 //==========================================================================
 void GLDrawList::AddSprite(GLSprite * sprite)
 {	
-	drawitems.Push(GLDrawItem(GLDIT_SPRITE,sprites.Push(*sprite)));
+	drawitems.Emplace(GLDIT_SPRITE,sprites.Push(*sprite));
 }
 
 
@@ -1226,9 +1230,8 @@ void FDrawInfo::DrawFloodedPlane(wallseg * ws, float planez, sector_t * sec, boo
 void FDrawInfo::FloodUpperGap(seg_t * seg)
 {
 	wallseg ws;
-	sector_t ffake, bfake;
-	sector_t * fakefsector = gl_FakeFlat(seg->frontsector, &ffake, true);
-	sector_t * fakebsector = gl_FakeFlat(seg->backsector, &bfake, false);
+	sector_t * fakefsector = gl_FakeFlat(seg->frontsector, true);
+	sector_t * fakebsector = gl_FakeFlat(seg->backsector, false);
 
 	vertex_t * v1, * v2;
 
@@ -1278,9 +1281,8 @@ void FDrawInfo::FloodUpperGap(seg_t * seg)
 void FDrawInfo::FloodLowerGap(seg_t * seg)
 {
 	wallseg ws;
-	sector_t ffake, bfake;
-	sector_t * fakefsector = gl_FakeFlat(seg->frontsector, &ffake, true);
-	sector_t * fakebsector = gl_FakeFlat(seg->backsector, &bfake, false);
+	sector_t * fakefsector = gl_FakeFlat(seg->frontsector, true);
+	sector_t * fakebsector = gl_FakeFlat(seg->backsector, false);
 
 	vertex_t * v1, * v2;
 
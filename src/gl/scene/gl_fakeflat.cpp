@@ -181,6 +181,77 @@ void gl_CheckViewArea(vertex_t *v1, vertex_t *v2, sector_t *frontsector, sector_
 }
 
 
+//==========================================================================
+//
+// Memoization of the results. The fake sector for a given (sector, area,
+// back) combination is rebuilt over and over while walking the BSP - once
+// per seg for back sectors - although its inputs cannot change within one
+// rendered viewpoint: the playsim does not run while rendering and the
+// interpolated plane heights are set before the frame starts. So each
+// result is kept in a lazily allocated per-sector cache and only computed
+// again when the view stamp changes. The entries also outlive the frame,
+// which makes the returned pointers safer than the stack buffers the
+// callers used to provide.
+//
+//==========================================================================
+
+struct FFakeFlatCache
+{
+	// in_area (with area_default folded into area_normal) times the
+	// back flag gives six distinct results per sector.
+	int stamp[6];
+	sector_t *result[6];
+	sector_t fake[6];
+};
+
+static TArray<FFakeFlatCache *> fakeflatcache;
+static int fakeflatstamp = 1;	// entries start out invalid
+
+void gl_RecacheFakeFlats()
+{
+	if (fakeflatcache.Size() != (unsigned)numsectors)
+	{
+		gl_DeleteFakeFlatCache();
+		fakeflatcache.Resize(numsectors);
+		if (numsectors > 0) memset(&fakeflatcache[0], 0, numsectors * sizeof(fakeflatcache[0]));
+	}
+	fakeflatstamp++;
+}
+
+void gl_DeleteFakeFlatCache()
+{
+	for (unsigned i = 0; i < fakeflatcache.Size(); i++)
+	{
+		if (fakeflatcache[i] != NULL) delete fakeflatcache[i];
+	}
+	fakeflatcache.Clear();
+}
+
+sector_t * gl_FakeFlat(sector_t * sec, area_t in_area, bool back)
+{
+	if ((!sec->heightsec || sec->heightsec->MoreFlags & SECF_IGNOREHEIGHTSEC || sec->heightsec == sec) &&
+		!(back && sec->planes[sector_t::floor].TexZ > sec->planes[sector_t::ceiling].TexZ))
+	{
+		// Nothing is faked here so don't waste a cache entry on it.
+		return sec;
+	}
+
+	FFakeFlatCache *cache = fakeflatcache[sec->sectornum];
+	if (cache == NULL)
+	{
+		cache = new FFakeFlatCache;
+		memset(cache->stamp, 0, sizeof(cache->stamp));
+		fakeflatcache[sec->sectornum] = cache;
+	}
+	int slot = ((in_area == area_above || in_area == area_below) ? in_area : area_normal) * 2 + back;
+	if (cache->stamp[slot] != fakeflatstamp)
+	{
+		cache->result[slot] = gl_FakeFlat(sec, &cache->fake[slot], in_area, back);
+		cache->stamp[slot] = fakeflatstamp;
+	}
+	return cache->result[slot];
+}
+
 //==========================================================================
 //
 // This is mostly like R_FakeFlat but with a few alterations necessitated
@@ -257,14 +257,57 @@ void GLFlat::DrawSubsectors(int pass, bool processlights, bool istrans)
 	if (vboindex >= 0)
 	{
 		int index = vboindex;
-		for (int i=0; i<sector->subsectorcount; i++)
+		if (!processlights)
+		{
+			// No per-subsector state changes here. If the entire sector
+			// is visible its pretriangulated fans form one contiguous
+			// range in the index buffer and can go out as a single
+			// glDrawElements; a partially visible sector still gets
+			// coalesced into one glMultiDrawArrays call.
+			static TArray<GLint> firsts;
+			static TArray<GLsizei> counts;
+			firsts.Clear();
+			counts.Clear();
+			int vertcount = 0;
+			for (int i=0; i<sector->subsectorcount; i++)
+			{
+				subsector_t * sub = sector->subsectors[i];
+
+				if (gl_drawinfo->ss_renderflags[sub-subsectors]&renderflags || istrans)
+				{
+					firsts.Push(index);
+					counts.Push(sub->numlines);
+					vertcount += sub->numlines;
+				}
+				index += sub->numlines;
+			}
+			int istart, icount;
+			if (firsts.Size() == (unsigned)sector->subsectorcount &&
+				GLRenderer->mVBO->GetIndexRange(vboindex, &istart, &icount))
+			{
+				GLRenderer->mVBO->RenderIndexed(GL_TRIANGLES, istart, icount);
+				flatvertices += vertcount;
+				flatprimitives++;
+			}
+			else if (firsts.Size() > 0)
+			{
+				drawcalls.Clock();
+				scene_drawcalls++;
+				glMultiDrawArrays(GL_TRIANGLE_FAN, &firsts[0], &counts[0], firsts.Size());
+				drawcalls.Unclock();
+				flatvertices += vertcount;
+				flatprimitives += firsts.Size();
+			}
+		}
+		else for (int i=0; i<sector->subsectorcount; i++)
 		{
 			subsector_t * sub = sector->subsectors[i];
-				
+
 			if (gl_drawinfo->ss_renderflags[sub-subsectors]&renderflags || istrans)
 			{
-				if (processlights) SetupSubsectorLights(GLPASS_ALL, sub, &dli);
+				SetupSubsectorLights(GLPASS_ALL, sub, &dli);
 				drawcalls.Clock();
+				scene_drawcalls++;
 				glDrawArrays(GL_TRIANGLE_FAN, index, sub->numlines);
 				drawcalls.Unclock();
 				flatvertices += sub->numlines;
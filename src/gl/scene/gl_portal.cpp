@@ -68,6 +68,7 @@
 
 EXTERN_CVAR(Bool, gl_portals)
 EXTERN_CVAR(Bool, gl_noquery)
+EXTERN_CVAR(Bool, gl_lazyquery)
 EXTERN_CVAR(Int, r_mirror_recursions)
 
 extern bool r_showviewer;
@@ -173,19 +174,135 @@ void GLPortal::DrawPortalStencil()
 //
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//
+// Sources of portals that already passed an occlusion query this frame.
+// The stereo eye passes render the same portals from barely different
+// viewpoints, so the second eye reuses the first eye's positive results
+// instead of stalling on a query of its own. Only positive results are
+// shared; a portal not seen by the first eye still gets its own query.
+//
+//-----------------------------------------------------------------------------
+
+static TArray<void *> queryseen;
+
+// With gl_lazyquery the result of a query is not read back until the next
+// frame begins, trading the pipeline stall of a synchronous readback for
+// portals appearing one frame late after being uncovered. Query objects
+// are pooled because every view issues its own each frame.
+struct FPendingQuery
+{
+	void *source;
+	GLuint queryobj;
+};
+
+static TArray<FPendingQuery> pendingqueries;	// queries issued this frame
+static TArray<void *> occludedsources;			// sources without any visible samples last frame
+static TArray<GLuint> freequeries;				// recycled query objects
+
+static bool ListContains(TArray<void *> &list, void *source)
+{
+	for (unsigned i = 0; i < list.Size(); i++)
+	{
+		if (list[i] == source) return true;
+	}
+	return false;
+}
+
+static GLuint AllocQueryObject()
+{
+	GLuint queryobj = 0;
+	if (freequeries.Size() > 0)
+	{
+		queryobj = freequeries.Last();
+		freequeries.Pop();
+	}
+	else
+	{
+		glGenQueries(1, &queryobj);
+	}
+	return queryobj;
+}
+
+void GLPortal::ClearQueryCache()
+{
+	queryseen.Clear();
+
+	// Harvest the queries issued last frame. Their results have been
+	// available for a long time by now so this does not stall. A source
+	// only counts as occluded if no view at all (eye, camera texture,
+	// mirror) saw a sample of it; otherwise a camera texture that cannot
+	// see a portal would blank it in the main view.
+	occludedsources.Clear();
+	static TArray<void *> visible, candidates;
+	visible.Clear();
+	candidates.Clear();
+	for (unsigned i = 0; i < pendingqueries.Size(); i++)
+	{
+		GLuint samples;
+		glGetQueryObjectuiv(pendingqueries[i].queryobj, GL_QUERY_RESULT, &samples);
+		freequeries.Push(pendingqueries[i].queryobj);
+		if (samples > 0) visible.Push(pendingqueries[i].source);
+		else candidates.Push(pendingqueries[i].source);
+	}
+	pendingqueries.Clear();
+	for (unsigned i = 0; i < candidates.Size(); i++)
+	{
+		if (!ListContains(visible, candidates[i]) && !ListContains(occludedsources, candidates[i]))
+		{
+			occludedsources.Push(candidates[i]);
+		}
+	}
+}
+
 bool GLPortal::Start(bool usestencil, bool doquery)
 {
 	rendered_portals++;
 //	PortalAll.Clock();
 	if (usestencil)
 	{
-		if (!gl_portals) 
+		if (!gl_portals)
 		{
 //			PortalAll.Unclock();
 			return false;
 		}
-	
-		// Create stencil 
+
+		if (doquery && gl_lazyquery && !gl_noquery && NeedDepthBuffer() &&
+			ListContains(occludedsources, GetSource()))
+		{
+			// Last frame not a single sample of this portal survived the
+			// depth test, so skip its contents outright. A counting pass
+			// that modifies neither stencil nor depth still issues a
+			// fresh query so the portal comes back - one frame late -
+			// once it is uncovered again.
+			GLuint queryobj = AllocQueryObject();
+			if (queryobj != 0)
+			{
+				ScopedColorMask colorMask(0, 0, 0, 0);
+				gl_RenderState.SetEffect(EFF_STENCIL);
+				gl_RenderState.EnableTexture(false);
+				gl_RenderState.ResetColor();
+				glStencilFunc(GL_EQUAL, recursion, ~0);
+				glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+				glDepthFunc(GL_LESS);
+				glDepthMask(false);
+				gl_RenderState.Apply();
+
+				glBeginQuery(GL_SAMPLES_PASSED, queryobj);
+				DrawPortalStencil();
+				glEndQuery(GL_SAMPLES_PASSED);
+
+				glDepthMask(true);
+				gl_RenderState.EnableTexture(true);
+				gl_RenderState.SetEffect(EFF_NONE);
+
+				FPendingQuery pq = { GetSource(), queryobj };
+				pendingqueries.Push(pq);
+				return false;
+			}
+		}
+
+		// Create stencil
 		glStencilFunc(GL_EQUAL,recursion,~0);		// create stencil
 		glStencilOp(GL_KEEP, GL_KEEP, GL_INCR);		// increment stencil of valid pixels
 		{
@@ -202,17 +319,36 @@ bool GLPortal::Start(bool usestencil, bool doquery)
 				if (!NeedDepthBuffer()) doquery = false;		// too much overhead and nothing to gain.
 				else if (gl_noquery) doquery = false;
 
+				if (doquery && !gl_lazyquery)
+				{
+					// Was this portal already found visible this frame (i.e. by the other eye)?
+					// Lazy queries never stall, so there each view issues its own.
+					if (ListContains(queryseen, GetSource())) doquery = false;
+				}
+
 				// If occlusion query is supported let's use it to avoid rendering portals that aren't visible
-				if (!QueryObject && doquery) glGenQueries(1, &QueryObject);
-				if (QueryObject)
+				GLuint queryobj = 0;
+				if (doquery)
 				{
-					glBeginQuery(GL_SAMPLES_PASSED, QueryObject);
+					if (gl_lazyquery)
+					{
+						queryobj = AllocQueryObject();
+					}
+					else
+					{
+						if (!QueryObject) glGenQueries(1, &QueryObject);
+						queryobj = QueryObject;
+					}
+				}
+				if (queryobj != 0)
+				{
+					glBeginQuery(GL_SAMPLES_PASSED, queryobj);
 				}
 				else doquery = false;	// some kind of error happened
 
 				DrawPortalStencil();
 
-				glEndQuery(GL_SAMPLES_PASSED);
+				if (doquery) glEndQuery(GL_SAMPLES_PASSED);
 
 				// Clear Z-buffer
 				glStencilFunc(GL_EQUAL, recursion + 1, ~0);		// draw sky into stencil
@@ -229,19 +365,31 @@ bool GLPortal::Start(bool usestencil, bool doquery)
 				gl_RenderState.SetEffect(EFF_NONE);
 				glDepthRange(0, 1);
 
-				GLuint sampleCount;
-
-				if (QueryObject)
+				if (doquery)
 				{
-					glGetQueryObjectuiv(QueryObject, GL_QUERY_RESULT, &sampleCount);
-
-					if (sampleCount == 0) 	// not visible
+					if (gl_lazyquery)
+					{
+						// The result is not needed before next frame starts,
+						// so defer the readback and render the contents on
+						// the strength of last frame's visibility.
+						FPendingQuery pq = { GetSource(), queryobj };
+						pendingqueries.Push(pq);
+					}
+					else
 					{
-						// restore default stencil op.
-						glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
-						glStencilFunc(GL_EQUAL, recursion, ~0);		// draw sky into stencil
-						PortalAll.Unclock();
-						return false;
+						GLuint sampleCount;
+
+						glGetQueryObjectuiv(QueryObject, GL_QUERY_RESULT, &sampleCount);
+
+						if (sampleCount == 0) 	// not visible
+						{
+							// restore default stencil op.
+							glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+							glStencilFunc(GL_EQUAL, recursion, ~0);		// draw sky into stencil
+							PortalAll.Unclock();
+							return false;
+						}
+						queryseen.Push(GetSource());
 					}
 				}
 				FDrawInfo::StartDrawInfo();
@@ -265,6 +413,7 @@ bool GLPortal::Start(bool usestencil, bool doquery)
 			}
 		}
 		recursion++;
+		if (recursion > scene_maxportaldepth) scene_maxportaldepth = recursion;
 
 
 	}
@@ -1056,7 +1205,7 @@ void GLLineToLinePortal::RenderAttached()
 // are 2 problems with it:
 //
 // 1. Setting this up completely negates any performance gains.
-// 2. It doesn't work with a 360� field of view (as when you are looking up.)
+// 2. It doesn't work with a 360� field of view (as when you are looking up.)
 //
 //
 // So the brute force mechanism is just as good.
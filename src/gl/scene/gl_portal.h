@@ -173,6 +173,7 @@ public:
 
 	static void BeginScene();
 	static void StartFrame();
+	static void ClearQueryCache();
 	static bool RenderFirstSkyPortal(int recursion);
 	static void EndFrame();
 	static GLPortal * FindPortal(const void * src);
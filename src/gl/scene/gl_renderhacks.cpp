@@ -50,7 +50,6 @@ static int totalupper, totallower;
 static int lowershcount, uppershcount;
 static glcycle_t totalms, showtotalms;
 static glcycle_t totalssms;
-static sector_t fakesec;
 
 void FDrawInfo::ClearBuffers()
 {
@@ -280,7 +279,7 @@ bool FDrawInfo::DoOneSectorUpper(subsector_t * subsec, float Planez)
 			// Note: if this is a real line between sectors
 			// we can be sure that render_sector is the real sector!
 
-			sector_t * sec = gl_FakeFlat(seg->backsector, &fakesec, true);
+			sector_t * sec = gl_FakeFlat(seg->backsector, true);
 
 			// Don't bother with slopes
 			if (sec->ceilingplane.isSlope())  return false;
@@ -338,7 +337,7 @@ bool FDrawInfo::DoOneSectorLower(subsector_t * subsec, float Planez)
 			// Note: if this is a real line between sectors
 			// we can be sure that render_sector is the real sector!
 
-			sector_t * sec = gl_FakeFlat(seg->backsector, &fakesec, true);
+			sector_t * sec = gl_FakeFlat(seg->backsector, true);
 
 			// Don't bother with slopes
 			if (sec->floorplane.isSlope())  return false;
@@ -397,7 +396,7 @@ bool FDrawInfo::DoFakeBridge(subsector_t * subsec, float Planez)
 			// Note: if this is a real line between sectors
 			// we can be sure that render_sector is the real sector!
 
-			sector_t * sec = gl_FakeFlat(seg->backsector, &fakesec, true);
+			sector_t * sec = gl_FakeFlat(seg->backsector, true);
 
 			// Don't bother with slopes
 			if (sec->floorplane.isSlope())  return false;
@@ -450,7 +449,7 @@ bool FDrawInfo::DoFakeCeilingBridge(subsector_t * subsec, float Planez)
 			// Note: if this is a real line between sectors
 			// we can be sure that render_sector is the real sector!
 
-			sector_t * sec = gl_FakeFlat(seg->backsector, &fakesec, true);
+			sector_t * sec = gl_FakeFlat(seg->backsector, true);
 
 			// Don't bother with slopes
 			if (sec->ceilingplane.isSlope())  return false;
@@ -482,7 +481,6 @@ bool FDrawInfo::DoFakeCeilingBridge(subsector_t * subsec, float Planez)
 //==========================================================================
 void FDrawInfo::HandleMissingTextures()
 {
-	sector_t fake;
 	totalms.Clock();
 	totalupper = MissingUpperTextures.Size();
 	totallower = MissingLowerTextures.Size();
@@ -539,7 +537,7 @@ void FDrawInfo::HandleMissingTextures()
 
 		{
 			// It isn't a hole. Now check whether it might be a fake bridge
-			sector_t * fakesector = gl_FakeFlat(MissingUpperTextures[i].seg->frontsector, &fake, false);
+			sector_t * fakesector = gl_FakeFlat(MissingUpperTextures[i].seg->frontsector, false);
 			float planez = (float)fakesector->GetPlaneTexZ(sector_t::ceiling);
 
 			backsub->validcount = validcount;
@@ -610,7 +608,7 @@ void FDrawInfo::HandleMissingTextures()
 
 		{
 			// It isn't a hole. Now check whether it might be a fake bridge
-			sector_t * fakesector = gl_FakeFlat(MissingLowerTextures[i].seg->frontsector, &fake, false);
+			sector_t * fakesector = gl_FakeFlat(MissingLowerTextures[i].seg->frontsector, false);
 			float planez = (float)fakesector->GetPlaneTexZ(sector_t::floor);
 
 			backsub->validcount = validcount;
@@ -1040,7 +1038,7 @@ void FDrawInfo::CollectSectorStacksCeiling(subsector_t * sub, sector_t * anchor)
 	if (sub->numlines>2 && !(ss_renderflags[DWORD(sub-subsectors)]&SSRF_PROCESSED)) return;
 
 	// Must be the exact same visplane
-	sector_t * me = gl_FakeFlat(sub->render_sector, &fakesec, false);
+	sector_t * me = gl_FakeFlat(sub->render_sector, false);
 	if (me->GetTexture(sector_t::ceiling) != anchor->GetTexture(sector_t::ceiling) ||
 		me->ceilingplane != anchor->ceilingplane ||
 		me->GetCeilingLight() != anchor->GetCeilingLight() ||
@@ -1083,7 +1081,7 @@ void FDrawInfo::CollectSectorStacksFloor(subsector_t * sub, sector_t * anchor)
 	if (sub->numlines>2 && !(ss_renderflags[DWORD(sub-subsectors)]&SSRF_PROCESSED)) return;
 
 	// Must be the exact same visplane
-	sector_t * me = gl_FakeFlat(sub->render_sector, &fakesec, false);
+	sector_t * me = gl_FakeFlat(sub->render_sector, false);
 	if (me->GetTexture(sector_t::floor) != anchor->GetTexture(sector_t::floor) ||
 		me->floorplane != anchor->floorplane ||
 		me->GetFloorLight() != anchor->GetFloorLight() ||
@@ -1117,12 +1115,11 @@ void FDrawInfo::CollectSectorStacksFloor(subsector_t * sub, sector_t * anchor)
 void FDrawInfo::ProcessSectorStacks()
 {
 	unsigned int i;
-	sector_t fake;
 
 	validcount++;
 	for (i=0;i<CeilingStacks.Size (); i++)
 	{
-		sector_t *sec = gl_FakeFlat(CeilingStacks[i], &fake, false);
+		sector_t *sec = gl_FakeFlat(CeilingStacks[i], false);
 		FPortal *portal = sec->GetGLPortal(sector_t::ceiling);
 		if (portal != NULL) for(int k=0;k<sec->subsectorcount;k++)
 		{
@@ -1166,7 +1163,7 @@ void FDrawInfo::ProcessSectorStacks()
 	validcount++;
 	for (i=0;i<FloorStacks.Size (); i++)
 	{
-		sector_t *sec = gl_FakeFlat(FloorStacks[i], &fake, false);
+		sector_t *sec = gl_FakeFlat(FloorStacks[i], false);
 		FPortal *portal = sec->GetGLPortal(sector_t::floor);
 		if (portal != NULL) for(int k=0;k<sec->subsectorcount;k++)
 		{
@@ -78,11 +78,12 @@ CVAR(Bool, gl_texture, true, 0)
 CVAR(Bool, gl_no_skyclear, false, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 CVAR(Float, gl_mask_threshold, 0.5f,CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 CVAR(Float, gl_mask_sprite_threshold, 0.5f,CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
-CVAR(Bool, gl_sort_textures, false, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
+CVAR(Bool, gl_sort_textures, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 
 EXTERN_CVAR (Bool, cl_capfps)
 EXTERN_CVAR (Bool, r_deathcamera)
 EXTERN_CVAR (Float, underwater_fade_scalar)
+EXTERN_CVAR (Int, png_savegame_level)
 
 
 extern int viewpitch;
@@ -275,6 +276,7 @@ void FGLRenderer::CreateScene()
 	Bsp.Clock();
 	GLRenderer->mVBO->Map();
 	R_SetView();
+	gl_PrecalcVertexAngles();
 	validcount++;	// used for processing sidedefs only once by the renderer.
 	gl_RenderBSPNode (nodes + numnodes - 1);
 	if (GLRenderer->mCurrentPortal != NULL) GLRenderer->mCurrentPortal->RenderAttached();
@@ -772,6 +774,7 @@ sector_t * FGLRenderer::RenderViewpoint (AActor * camera, GL_IRECT * bounds, flo
 	mSceneClearColor[2] = 0.0f;
 	R_SetupFrame (camera);
 	SetViewArea();
+	gl_RecacheFakeFlats();	// the interpolated plane heights may have changed
 
 	// We have to scale the pitch to account for the pixel stretching, because the playsim doesn't know about this and treats it as 1:1.
 	double radPitch = ViewPitch.Normalized180().Radians();
@@ -878,6 +881,7 @@ void FGLRenderer::RenderView (player_t* player)
 
 	gl_RenderState.SetVertexBuffer(mVBO);
 	GLRenderer->mVBO->Reset();
+	GLPortal::ClearQueryCache();
 
 	// reset statistics counters
 	ResetProfilingData();
@@ -940,6 +944,7 @@ void FGLRenderer::WriteSavePic (player_t *player, FileWriter *file, int width, i
 	SetFixedColormap(player);
 	gl_RenderState.SetVertexBuffer(mVBO);
 	GLRenderer->mVBO->Reset();
+	GLPortal::ClearQueryCache();
 	if (!gl.legacyMode) GLRenderer->mLights->Clear();
 
 	// Check if there's some lights. If not some code can be skipped.
@@ -961,7 +966,7 @@ void FGLRenderer::WriteSavePic (player_t *player, FileWriter *file, int width, i
 
 	byte * scr = (byte *)M_Malloc(width * height * 3);
 	glReadPixels(0,0,width, height,GL_RGB,GL_UNSIGNED_BYTE,scr);
-	M_CreatePNG (file, scr + ((height-1) * width * 3), NULL, SS_RGB, width, height, -width*3);
+	M_CreatePNG (file, scr + ((height-1) * width * 3), NULL, SS_RGB, width, height, -width*3, png_savegame_level);
 	M_Free(scr);
 }
 
@@ -1020,6 +1025,14 @@ void FGLInterface::PrecacheTexture(FTexture *tex, int cache)
 		FMaterial * gltex = FMaterial::ValidateTexture(tex, false);
 		if (gltex) gltex->Precache();
 	}
+	if (cache & FTextureManager::HIT_Sky)
+	{
+		// Scan the sky cap colors while still behind the load screen. This
+		// decodes the whole texture, so deferring it to the first drawn sky
+		// would cause a noticeable hitch. The result sticks to the texture
+		// and is reused by later levels with the same sky.
+		tex->GetSkyCapColor(false);
+	}
 }
 
 //==========================================================================
@@ -1158,6 +1171,11 @@ void FGLInterface::Precache(BYTE *texhitlist, TMap<PClassActor*, bool> &actorhit
 	if (gl_precache)
 	{
 		// cache all used textures
+		// Note: the texture creation below must stay on this thread. Besides
+		// the GL context affinity of the uploads, the decode step reads lumps
+		// through shared file handles and caches without any locking, so only
+		// per-texture work that is already pooled (e.g. upscaling) runs
+		// concurrently here.
 		for (int i = cnt - 1; i >= 0; i--)
 		{
 			FTexture *tex = TexMan.ByIndex(i);
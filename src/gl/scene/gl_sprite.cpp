@@ -633,7 +633,6 @@ void GLSprite::PerformSpriteClipAdjustment(AActor *thing, const DVector2 &thingp
 
 void GLSprite::Process(AActor* thing, sector_t * sector, int thruportal)
 {
-	sector_t rs;
 	sector_t * rendersector;
 
 	// Don't waste time projecting sprites that are definitely not visible.
@@ -699,12 +698,11 @@ void GLSprite::Process(AActor* thing, sector_t * sector, int thruportal)
 		if (clipres == GLPortal::PClip_InFront) return;
 	}
 
-	player_t *player = &players[consoleplayer];
 	FloatRect r;
 
 	if (sector->sectornum != thing->Sector->sectornum && !thruportal)
 	{
-		rendersector = gl_FakeFlat(thing->Sector, &rs, false);
+		rendersector = gl_FakeFlat(thing->Sector, false);
 	}
 	else
 	{
@@ -747,8 +745,7 @@ void GLSprite::Process(AActor* thing, sector_t * sector, int thruportal)
 		}
 
 		if (!patch.isValid()) return;
-		int type = thing->renderflags & RF_SPRITETYPEMASK;
-		gltexture = FMaterial::ValidateTexture(patch, (type == RF_FACESPRITE), false);
+		gltexture = FMaterial::ValidateTexture(patch, (spritetype == RF_FACESPRITE), false);
 		if (!gltexture) return;
 
 		vt = gltexture->GetSpriteVT();
@@ -778,7 +775,7 @@ void GLSprite::Process(AActor* thing, sector_t * sector, int thruportal)
 		float spriteheight = sprscale.Y * r.height;
 
 		// Tests show that this doesn't look good for many decorations and corpses
-		if (spriteheight > 0 && gl_spriteclip > 0 && (thing->renderflags & RF_SPRITETYPEMASK) == RF_FACESPRITE)
+		if (spriteheight > 0 && gl_spriteclip > 0 && spritetype == RF_FACESPRITE)
 		{
 			PerformSpriteClipAdjustment(thing, thingpos, spriteheight);
 		}
@@ -1033,8 +1030,6 @@ void GLSprite::ProcessParticle (particle_t *particle, sector_t *sector)//, int s
 		if (clipres == GLPortal::PClip_InFront) return;
 	}
 
-	player_t *player=&players[consoleplayer];
-	
 	if (particle->trans==0) return;
 
 	lightlevel = gl_ClampLight(sector->GetTexture(sector_t::ceiling) == skyflatnum ? 
@@ -1185,7 +1180,6 @@ void gl_RenderActorsInPortal(FGLLinePortal *glport)
 					DAngle savedangle = th->Angles.Yaw;
 					DVector3 savedpos = th->Pos();
 					DVector3 newpos = savedpos;
-					sector_t fakesector;
 
 					P_TranslatePortalXY(line, newpos.X, newpos.Y);
 					P_TranslatePortalZ(line, newpos.Z);
@@ -1195,7 +1189,7 @@ void gl_RenderActorsInPortal(FGLLinePortal *glport)
 
 					GLSprite spr;
 					th->fillcolor = 0xff0000ff;
-					spr.Process(th, gl_FakeFlat(th->Sector, &fakesector, false), 2);
+					spr.Process(th, gl_FakeFlat(th->Sector, false), 2);
 					th->fillcolor = 0xffffffff;
 					th->Angles.Yaw = savedangle;
 					th->SetXYZ(savedpos);
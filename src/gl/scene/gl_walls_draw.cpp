@@ -23,6 +23,7 @@
 #include "gl/system/gl_system.h"
 #include "p_local.h"
 #include "p_lnspec.h"
+#include "r_state.h"
 #include "a_sharedglobal.h"
 #include "gl/gl_functions.h"
 
@@ -53,6 +54,12 @@ EXTERN_CVAR(Bool, gl_seamless)
 //==========================================================================
 FDynLightData lightdata;
 
+// Per-frame cache of the uploaded light list for each sidedef. The upper,
+// middle and lower parts of a wall share the same touching-light list, so
+// without this they traverse and upload it up to three times per frame.
+static TArray<int> sidelightindex;
+static TArray<unsigned int> sidelightgen;
+
 
 void GLWall::SetupLights()
 {
@@ -73,17 +80,20 @@ void GLWall::SetupLights()
 	lightdata.Clear();
 	p.Init(vtx,4);
 
-	if (!p.ValidNormal()) 
+	if (!p.ValidNormal())
 	{
 		return;
 	}
+
 	FLightNode *node;
+	side_t *cacheside = NULL;
 	if (seg->sidedef == NULL)
 	{
 		node = NULL;
 	}
 	else if (!(seg->sidedef->Flags & WALLF_POLYOBJ))
 	{
+		cacheside = seg->sidedef;
 		node = seg->sidedef->lighthead;
 	}
 	else if (sub)
@@ -93,6 +103,54 @@ void GLWall::SetupLights()
 	}
 	else node = NULL;
 
+	if (cacheside != NULL)
+	{
+		unsigned int gen = GLRenderer->mLights->GetClearGen();
+		unsigned int sidenum = (unsigned int)(cacheside - sides);
+
+		if (sidelightindex.Size() != (unsigned)numsides)
+		{
+			// mClearGen starts at 1 so zero filling invalidates everything.
+			sidelightindex.Resize(numsides);
+			sidelightgen.Resize(numsides);
+			memset(&sidelightgen[0], 0, numsides * sizeof(unsigned int));
+		}
+		if (sidelightgen[sidenum] == gen)
+		{
+			dynlightindex = sidelightindex[sidenum];
+			return;
+		}
+
+		// Build a list that is valid for every part of this sidedef. The
+		// plane is the same for all of them, only the quad footprints
+		// differ, so skip the per-quad rejection test; lights beyond a
+		// part's footprint are attenuated to nothing by the shader.
+		while (node)
+		{
+			if (!(node->lightsource->flags2&MF2_DORMANT))
+			{
+				iter_dlight++;
+
+				float x = node->lightsource->X();
+				float y = node->lightsource->Y();
+				float z = node->lightsource->Z();
+				float dist = fabsf(p.DistToPoint(x, z, y));
+				float radius = node->lightsource->GetRadius();
+
+				if (radius > 0.f && dist < radius)
+				{
+					gl_GetLight(seg->frontsector->PortalGroup, p, node->lightsource, true, lightdata);
+				}
+			}
+			node = node->nextLight;
+		}
+
+		dynlightindex = GLRenderer->mLights->UploadLights(lightdata);
+		sidelightindex[sidenum] = dynlightindex;
+		sidelightgen[sidenum] = gen;
+		return;
+	}
+
 	// Iterate through all dynamic lights which touch this wall and render them
 	while (node)
 	{
@@ -138,7 +196,7 @@ void GLWall::SetupLights()
 					if (tcs[i].v>1) outcnt[3]++;
 
 				}
-				if (outcnt[0]!=4 && outcnt[1]!=4 && outcnt[2]!=4 && outcnt[3]!=4) 
+				if (outcnt[0]!=4 && outcnt[1]!=4 && outcnt[2]!=4 && outcnt[3]!=4)
 				{
 					gl_GetLight(seg->frontsector->PortalGroup, p, node->lightsource, true, lightdata);
 				}
@@ -196,7 +196,7 @@ void FGLRenderer::DrawPlayerSprites(sector_t * viewsector, bool hudModelStep)
 	unsigned int i;
 	int lightlevel=0;
 	FColormap cm;
-	sector_t * fakesec, fs;
+	sector_t * fakesec;
 	AActor * playermo=players[consoleplayer].camera;
 	player_t * player=playermo->player;
 	
@@ -243,7 +243,7 @@ void FGLRenderer::DrawPlayerSprites(sector_t * viewsector, bool hudModelStep)
 	}
 	else
 	{
-		fakesec    = gl_FakeFlat(viewsector, &fs, false);
+		fakesec    = gl_FakeFlat(viewsector, false);
 
 		// calculate light level for weapon sprites
 		lightlevel = gl_ClampLight(fakesec->lightlevel);
@@ -379,6 +379,13 @@ void FGLRenderer::DrawPlayerSprites(sector_t * viewsector, bool hudModelStep)
 	int oldlightmode = glset.lightmode;
 	if (glset.lightmode == 8) glset.lightmode = 2;
 
+	// The dynamic light contribution only depends on the player's position,
+	// so it is the same for every layer and can be set up once for all of them.
+	if (vis.RenderStyle.BlendOp != STYLEOP_Shadow && gl_lights && GLRenderer->mLightCount && !gl_fixedcolormap && gl_light_sprites)
+	{
+		gl_SetDynSpriteLight(playermo, NULL);
+	}
+
 	for(DPSprite *psp = player->psprites; psp != nullptr && psp->GetID() < PSP_TARGETCENTER; psp = psp->GetNext())
 	{
 		if (psp->GetState() != nullptr) 
@@ -409,10 +416,6 @@ void FGLRenderer::DrawPlayerSprites(sector_t * viewsector, bool hudModelStep)
 			}
 			else
 			{
-				if (gl_lights && GLRenderer->mLightCount && !gl_fixedcolormap && gl_light_sprites)
-				{
-					gl_SetDynSpriteLight(playermo, NULL);
-				}
 				gl_SetColor(ll, 0, cmc, trans, true);
 			}
 
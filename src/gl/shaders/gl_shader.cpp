@@ -36,6 +36,8 @@
 #include "v_palette.h"
 #include "sc_man.h"
 #include "cmdlib.h"
+#include "md5.h"
+#include "startupcache.h"
 
 #include "gl/system/gl_interface.h"
 #include "gl/system/gl_debug.h"
@@ -151,60 +153,127 @@ bool FShader::Load(const char * name, const char * vert_prog_lump, const char *
 		vp_comb.Substitute("gl_ClipDistance", "//");
 	}
 
-	hVertProg = glCreateShader(GL_VERTEX_SHADER);
-	hFragProg = glCreateShader(GL_FRAGMENT_SHADER);	
+	// With the sources fully assembled, look for a program binary kept from
+	// an earlier run. Compiling the full set of material shaders takes
+	// several seconds on some drivers; loading binaries is nearly free.
+	// The driver identification is part of the key because binaries do not
+	// survive driver updates or GPU changes, and stale entries are simply
+	// never requested again.
+	FString binarykey;
+	TArray<BYTE> binary;
 
-	FGLDebug::LabelObject(GL_SHADER, hVertProg, vert_prog_lump);
-	FGLDebug::LabelObject(GL_SHADER, hFragProg, frag_prog_lump);
-
-	int vp_size = (int)vp_comb.Len();
-	int fp_size = (int)fp_comb.Len();
-
-	const char *vp_ptr = vp_comb.GetChars();
-	const char *fp_ptr = fp_comb.GetChars();
+	if (gl.flags & RFL_PROGRAM_BINARY)
+	{
+		MD5Context md5;
+		BYTE digest[16];
 
-	glShaderSource(hVertProg, 1, &vp_ptr, &vp_size);
-	glShaderSource(hFragProg, 1, &fp_ptr, &fp_size);
+		md5.Update((const BYTE *)vp_comb.GetChars(), (unsigned)vp_comb.Len());
+		md5.Update((const BYTE *)fp_comb.GetChars(), (unsigned)fp_comb.Len());
+		md5.Final(digest);
 
-	glCompileShader(hVertProg);
-	glCompileShader(hFragProg);
+		binarykey.Format("glprogbin %s|%s|%s|", glGetString(GL_VENDOR),
+			glGetString(GL_RENDERER), glGetString(GL_VERSION));
+		for (int i = 0; i < 16; i++)
+		{
+			binarykey.AppendFormat("%02x", digest[i]);
+		}
+	}
 
 	hShader = glCreateProgram();
 	FGLDebug::LabelObject(GL_PROGRAM, hShader, name);
 
-	glAttachShader(hShader, hVertProg);
-	glAttachShader(hShader, hFragProg);
-
-	glBindAttribLocation(hShader, VATTR_VERTEX, "aPosition");
-	glBindAttribLocation(hShader, VATTR_TEXCOORD, "aTexCoord");
-	glBindAttribLocation(hShader, VATTR_COLOR, "aColor");
-	glBindAttribLocation(hShader, VATTR_VERTEX2, "aVertex2");
-	glBindAttribLocation(hShader, VATTR_NORMAL, "aNormal");
-
-	glLinkProgram(hShader);
+	int linked = 0;
 
-	glGetShaderInfoLog(hVertProg, 10000, NULL, buffer);
-	if (*buffer) 
+	if (binarykey.IsNotEmpty() && StartupCache.GetBlock(binarykey, binary) &&
+		binary.Size() > sizeof(DWORD))
 	{
-		error << "Vertex shader:\n" << buffer << "\n";
-	}
-	glGetShaderInfoLog(hFragProg, 10000, NULL, buffer);
-	if (*buffer) 
-	{
-		error << "Fragment shader:\n" << buffer << "\n";
+		// The first DWORD of the block holds the driver's format id. The
+		// cache never leaves this machine, so it is stored in native order.
+		glProgramBinary(hShader, *(DWORD *)&binary[0],
+			&binary[sizeof(DWORD)], binary.Size() - sizeof(DWORD));
+		glGetProgramiv(hShader, GL_LINK_STATUS, &linked);
 	}
 
-	glGetProgramInfoLog(hShader, 10000, NULL, buffer);
-	if (*buffer) 
-	{
-		error << "Linking:\n" << buffer << "\n";
-	}
-	int linked;
-	glGetProgramiv(hShader, GL_LINK_STATUS, &linked);
-	if (linked == 0)
+	if (!linked)
 	{
-		// only print message if there's an error.
-		I_Error("Init Shader '%s':\n%s\n", name, error.GetChars());
+		hVertProg = glCreateShader(GL_VERTEX_SHADER);
+		hFragProg = glCreateShader(GL_FRAGMENT_SHADER);	
+
+		FGLDebug::LabelObject(GL_SHADER, hVertProg, vert_prog_lump);
+		FGLDebug::LabelObject(GL_SHADER, hFragProg, frag_prog_lump);
+
+		int vp_size = (int)vp_comb.Len();
+		int fp_size = (int)fp_comb.Len();
+
+		const char *vp_ptr = vp_comb.GetChars();
+		const char *fp_ptr = fp_comb.GetChars();
+
+		glShaderSource(hVertProg, 1, &vp_ptr, &vp_size);
+		glShaderSource(hFragProg, 1, &fp_ptr, &fp_size);
+
+		glCompileShader(hVertProg);
+		glCompileShader(hFragProg);
+
+		glAttachShader(hShader, hVertProg);
+		glAttachShader(hShader, hFragProg);
+
+		glBindAttribLocation(hShader, VATTR_VERTEX, "aPosition");
+		glBindAttribLocation(hShader, VATTR_TEXCOORD, "aTexCoord");
+		glBindAttribLocation(hShader, VATTR_COLOR, "aColor");
+		glBindAttribLocation(hShader, VATTR_VERTEX2, "aVertex2");
+		glBindAttribLocation(hShader, VATTR_NORMAL, "aNormal");
+
+		if (binarykey.IsNotEmpty())
+		{
+			// must be set before linking or some drivers refuse to
+			// hand the binary out afterwards.
+			glProgramParameteri(hShader, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+
+		glLinkProgram(hShader);
+
+		glGetShaderInfoLog(hVertProg, 10000, NULL, buffer);
+		if (*buffer) 
+		{
+			error << "Vertex shader:\n" << buffer << "\n";
+		}
+		glGetShaderInfoLog(hFragProg, 10000, NULL, buffer);
+		if (*buffer) 
+		{
+			error << "Fragment shader:\n" << buffer << "\n";
+		}
+
+		glGetProgramInfoLog(hShader, 10000, NULL, buffer);
+		if (*buffer) 
+		{
+			error << "Linking:\n" << buffer << "\n";
+		}
+		glGetProgramiv(hShader, GL_LINK_STATUS, &linked);
+		if (linked == 0)
+		{
+			// only print message if there's an error.
+			I_Error("Init Shader '%s':\n%s\n", name, error.GetChars());
+		}
+
+		if (binarykey.IsNotEmpty())
+		{
+			int binlen = 0;
+
+			glGetProgramiv(hShader, GL_PROGRAM_BINARY_LENGTH, &binlen);
+			if (binlen > 0)
+			{
+				GLsizei gotlen = 0;
+				GLenum format = 0;
+
+				binary.Resize(binlen + sizeof(DWORD));
+				glGetProgramBinary(hShader, binlen, &gotlen, &format, &binary[sizeof(DWORD)]);
+				if (gotlen > 0)
+				{
+					*(DWORD *)&binary[0] = format;
+					StartupCache.AddBlock(binarykey, &binary[0], gotlen + sizeof(DWORD));
+				}
+			}
+		}
 	}
 
 
@@ -236,13 +305,10 @@ bool FShader::Load(const char * name, const char * vert_prog_lump, const char *
 
 	lights_index = glGetUniformLocation(hShader, "lights");
 	fakevb_index = glGetUniformLocation(hShader, "fakeVB");
-	projectionmatrix_index = glGetUniformLocation(hShader, "ProjectionMatrix");
-	viewmatrix_index = glGetUniformLocation(hShader, "ViewMatrix");
 	modelmatrix_index = glGetUniformLocation(hShader, "ModelMatrix");
 	texturematrix_index = glGetUniformLocation(hShader, "TextureMatrix");
 	vertexmatrix_index = glGetUniformLocation(hShader, "uQuadVertices");
 	texcoordmatrix_index = glGetUniformLocation(hShader, "uQuadTexCoords");
-	normalviewmatrix_index = glGetUniformLocation(hShader, "NormalViewMatrix");
 	normalmodelmatrix_index = glGetUniformLocation(hShader, "NormalModelMatrix");
 	quadmode_index = glGetUniformLocation(hShader, "uQuadMode");
 
@@ -252,6 +318,9 @@ bool FShader::Load(const char * name, const char * vert_prog_lump, const char *
 		if (tempindex != -1) glUniformBlockBinding(hShader, tempindex, LIGHTBUF_BINDINGPOINT);
 	}
 
+	int viewpointindex = glGetUniformBlockIndex(hShader, "ViewpointUBO");
+	if (viewpointindex != -1) glUniformBlockBinding(hShader, viewpointindex, VIEWPOINT_BINDINGPOINT);
+
 	glUseProgram(hShader);
 	if (quadmode_index > 0) glUniform1i(quadmode_index, 0);
 
@@ -325,20 +394,6 @@ FShader *FShaderManager::Compile (const char *ShaderName, const char *ShaderPath
 	return shader;
 }
 
-//==========================================================================
-//
-//
-//
-//==========================================================================
-
-void FShader::ApplyMatrices(VSMatrix *proj, VSMatrix *view, VSMatrix *norm)
-{
-	Bind();
-	glUniformMatrix4fv(projectionmatrix_index, 1, false, proj->get());
-	glUniformMatrix4fv(viewmatrix_index, 1, false, view->get());
-	glUniformMatrix4fv(normalviewmatrix_index, 1, false, norm->get());
-}
-
 //==========================================================================
 //
 //
@@ -397,7 +452,14 @@ static const FEffectShader effectshaders[]=
 
 FShaderManager::FShaderManager()
 {
-	if (!gl.legacyMode) CompileShaders();
+	if (!gl.legacyMode)
+	{
+		// All programs read their viewpoint matrices from this buffer; it
+		// stays bound for the lifetime of the shader set.
+		glGenBuffers(1, &mViewpointBuffer);
+		glBindBufferBase(GL_UNIFORM_BUFFER, VIEWPOINT_BINDINGPOINT, mViewpointBuffer);
+		CompileShaders();
+	}
 }
 
 //==========================================================================
@@ -408,7 +470,11 @@ FShaderManager::FShaderManager()
 
 FShaderManager::~FShaderManager()
 {
-	if (!gl.legacyMode) Clean();
+	if (!gl.legacyMode)
+	{
+		Clean();
+		glDeleteBuffers(1, &mViewpointBuffer);
+	}
 }
 
 //==========================================================================
@@ -562,25 +628,16 @@ void FShaderManager::ApplyMatrices(VSMatrix *proj, VSMatrix *view)
 		VSMatrix norm;
 		norm.computeNormalMatrix(*view);
 
-		for (int i = 0; i < 4; i++)
-		{
-			mTextureEffects[i]->ApplyMatrices(proj, view, &norm);
-			mTextureEffectsNAT[i]->ApplyMatrices(proj, view, &norm);
-		}
-		mTextureEffects[4]->ApplyMatrices(proj, view, &norm);
-		if (gl_fuzztype != 0)
-		{
-			mTextureEffects[4 + gl_fuzztype]->ApplyMatrices(proj, view, &norm);
-		}
-		for (unsigned i = 12; i < mTextureEffects.Size(); i++)
-		{
-			mTextureEffects[i]->ApplyMatrices(proj, view, &norm);
-		}
-		for (int i = 0; i < MAX_EFFECTS; i++)
-		{
-			mEffectShaders[i]->ApplyMatrices(proj, view, &norm);
-		}
-		if (mActiveShader != NULL) mActiveShader->Bind();
+		// The shaders share the viewpoint uniform block, so instead of a
+		// round of glUniform calls through every program this is a single
+		// buffer upload. Respecifying the store orphans the old buffer,
+		// so draws still reading the previous viewpoint do not stall it.
+		float matrices[48];
+		memcpy(&matrices[0], proj->get(), 16 * sizeof(float));
+		memcpy(&matrices[16], view->get(), 16 * sizeof(float));
+		memcpy(&matrices[32], norm.get(), 16 * sizeof(float));
+		glBindBuffer(GL_UNIFORM_BUFFER, mViewpointBuffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(matrices), matrices, GL_STREAM_DRAW);
 	}
 }
 
@@ -283,9 +283,6 @@ class FShader
 	FBufferedUniform1f muTimer;
 	
 	int lights_index;
-	int projectionmatrix_index;
-	int viewmatrix_index;
-	int normalviewmatrix_index;
 	int modelmatrix_index;
 	int normalmodelmatrix_index;
 	int texturematrix_index;
@@ -320,8 +317,6 @@ public:
 	bool Bind();
 	unsigned int GetHandle() const { return hShader; }
 
-	void ApplyMatrices(VSMatrix *proj, VSMatrix *view, VSMatrix *norm);
-
 };
 
 
@@ -336,6 +331,7 @@ class FShaderManager
 	TArray<FShader*> mTextureEffectsNAT;
 	FShader *mActiveShader;
 	FShader *mEffectShaders[MAX_EFFECTS];
+	unsigned int mViewpointBuffer = 0;	// uniform block shared by all shaders
 
 	void Clean();
 	void CompileShaders();
@@ -384,7 +380,8 @@ public:
 
 enum
 {
-	LIGHTBUF_BINDINGPOINT = 1
+	LIGHTBUF_BINDINGPOINT = 1,
+	VIEWPOINT_BINDINGPOINT = 2
 };
 
 #endif
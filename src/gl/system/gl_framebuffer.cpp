@@ -60,6 +60,12 @@ EXTERN_CVAR (Bool, vid_vsync)
 
 CVAR(Bool, gl_aalines, false, CVAR_ARCHIVE)
 
+// The hard sync after the swap keeps the driver from queueing up several
+// frames of work, which is what keeps input latency low with vsync on.
+// It can be turned off for throughput on machines where the block in
+// glFinish costs more than the latency is worth.
+CVAR(Bool, gl_finish, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
+
 FGLRenderer *GLRenderer;
 
 void gl_LoadExtensions();
@@ -217,7 +223,7 @@ void OpenGLFrameBuffer::Swap()
 		needsetgamma = false;
 	}
 	SwapBuffers();
-	glFinish();
+	if (gl_finish) glFinish();
 	Finish.Unclock();
 	swapped = true;
 	FHardwareTexture::UnbindAll();
@@ -166,6 +166,15 @@ void gl_LoadExtensions()
 	{
 		gl.flags |= RFL_SAMPLER_OBJECTS;
 	}
+
+	if (CheckExtension("GL_ARB_get_program_binary"))
+	{
+		// Some drivers advertise the extension but support no formats,
+		// in which case retrieving binaries can never succeed.
+		int formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		if (formats > 0) gl.flags |= RFL_PROGRAM_BINARY;
+	}
 	
 	// The minimum requirement for the modern render path are GL 3.0 + uniform buffers
 	if (gl_version < 3.0f || (gl_version < 3.1f && !CheckExtension("GL_ARB_uniform_buffer_object")))
@@ -24,7 +24,9 @@ enum RenderFlags
 	RFL_NO_CLIP_PLANES = 32,
 
 	RFL_INVALIDATE_BUFFER = 64,
-	RFL_DEBUG = 128
+	RFL_DEBUG = 128,
+
+	RFL_PROGRAM_BINARY = 256
 };
 
 enum TexMode
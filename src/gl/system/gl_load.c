@@ -89,6 +89,7 @@ static PROC WinGetProcAddress(const char *name)
 
 int ogl_ext_APPLE_client_storage = ogl_LOAD_FAILED;
 int ogl_ext_ARB_buffer_storage = ogl_LOAD_FAILED;
+int ogl_ext_ARB_get_program_binary = ogl_LOAD_FAILED;
 int ogl_ext_ARB_shader_storage_buffer_object = ogl_LOAD_FAILED;
 int ogl_ext_ARB_texture_compression = ogl_LOAD_FAILED;
 int ogl_ext_ARB_texture_rectangle = ogl_LOAD_FAILED;
@@ -109,6 +110,22 @@ static int Load_ARB_buffer_storage(void)
 	return numFailed;
 }
 
+void (CODEGEN_FUNCPTR *_ptrc_glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary) = NULL;
+void (CODEGEN_FUNCPTR *_ptrc_glProgramBinary)(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length) = NULL;
+void (CODEGEN_FUNCPTR *_ptrc_glProgramParameteri)(GLuint program, GLenum pname, GLint value) = NULL;
+
+static int Load_ARB_get_program_binary(void)
+{
+	int numFailed = 0;
+	_ptrc_glGetProgramBinary = (void (CODEGEN_FUNCPTR *)(GLuint, GLsizei, GLsizei *, GLenum *, void *))IntGetProcAddress("glGetProgramBinary");
+	if(!_ptrc_glGetProgramBinary) numFailed++;
+	_ptrc_glProgramBinary = (void (CODEGEN_FUNCPTR *)(GLuint, GLenum, const void *, GLsizei))IntGetProcAddress("glProgramBinary");
+	if(!_ptrc_glProgramBinary) numFailed++;
+	_ptrc_glProgramParameteri = (void (CODEGEN_FUNCPTR *)(GLuint, GLenum, GLint))IntGetProcAddress("glProgramParameteri");
+	if(!_ptrc_glProgramParameteri) numFailed++;
+	return numFailed;
+}
+
 void (CODEGEN_FUNCPTR *_ptrc_glShaderStorageBlockBinding)(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) = NULL;
 
 static int Load_ARB_shader_storage_buffer_object(void)
@@ -2377,9 +2394,10 @@ typedef struct ogl_StrToExtMap_s
 	PFN_LOADFUNCPOINTERS LoadExtension;
 } ogl_StrToExtMap;
 
-static ogl_StrToExtMap ExtensionMap[11] = {
+static ogl_StrToExtMap ExtensionMap[12] = {
 	{"GL_APPLE_client_storage", &ogl_ext_APPLE_client_storage, NULL},
 	{"GL_ARB_buffer_storage", &ogl_ext_ARB_buffer_storage, Load_ARB_buffer_storage},
+	{"GL_ARB_get_program_binary", &ogl_ext_ARB_get_program_binary, Load_ARB_get_program_binary},
 	{"GL_ARB_shader_storage_buffer_object", &ogl_ext_ARB_shader_storage_buffer_object, Load_ARB_shader_storage_buffer_object},
 	{"GL_ARB_texture_compression", &ogl_ext_ARB_texture_compression, Load_ARB_texture_compression},
 	{"GL_ARB_texture_rectangle", &ogl_ext_ARB_texture_rectangle, NULL},
@@ -2391,7 +2409,7 @@ static ogl_StrToExtMap ExtensionMap[11] = {
 	{"GL_ARB_invalidate_subdata", &ogl_ext_ARB_invalidate_subdata, Load_ARB_invalidate_subdata},
 };
 
-static int g_extensionMapSize = 11;
+static int g_extensionMapSize = 12;
 
 static ogl_StrToExtMap *FindExtEntry(const char *extensionName)
 {
@@ -2410,6 +2428,7 @@ static void ClearExtensionVars(void)
 {
 	ogl_ext_APPLE_client_storage = ogl_LOAD_FAILED;
 	ogl_ext_ARB_buffer_storage = ogl_LOAD_FAILED;
+	ogl_ext_ARB_get_program_binary = ogl_LOAD_FAILED;
 	ogl_ext_ARB_shader_storage_buffer_object = ogl_LOAD_FAILED;
 	ogl_ext_ARB_texture_compression = ogl_LOAD_FAILED;
 	ogl_ext_ARB_texture_rectangle = ogl_LOAD_FAILED;
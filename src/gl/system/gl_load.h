@@ -155,6 +155,7 @@ extern "C" {
 
 extern int ogl_ext_APPLE_client_storage;
 extern int ogl_ext_ARB_buffer_storage;
+extern int ogl_ext_ARB_get_program_binary;
 extern int ogl_ext_ARB_shader_storage_buffer_object;
 extern int ogl_ext_ARB_texture_compression;
 extern int ogl_ext_ARB_texture_rectangle;
@@ -167,6 +168,11 @@ extern int ogl_ext_ARB_invalidate_subdata;
 
 #define GL_UNPACK_CLIENT_STORAGE_APPLE 0x85B2
 
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+
 #define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
 #define GL_BUFFER_STORAGE_FLAGS 0x8220
 #define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
@@ -1595,6 +1601,16 @@ extern void (CODEGEN_FUNCPTR *_ptrc_glBufferStorage)(GLenum target, GLsizeiptr s
 #define glBufferStorage _ptrc_glBufferStorage
 #endif /*GL_ARB_buffer_storage*/ 
 
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary 1
+extern void (CODEGEN_FUNCPTR *_ptrc_glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary);
+#define glGetProgramBinary _ptrc_glGetProgramBinary
+extern void (CODEGEN_FUNCPTR *_ptrc_glProgramBinary)(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length);
+#define glProgramBinary _ptrc_glProgramBinary
+extern void (CODEGEN_FUNCPTR *_ptrc_glProgramParameteri)(GLuint program, GLenum pname, GLint value);
+#define glProgramParameteri _ptrc_glProgramParameteri
+#endif /*GL_ARB_get_program_binary*/ 
+
 #ifndef GL_ARB_shader_storage_buffer_object
 #define GL_ARB_shader_storage_buffer_object 1
 extern void (CODEGEN_FUNCPTR *_ptrc_glShaderStorageBlockBinding)(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding);
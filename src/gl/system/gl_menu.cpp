@@ -37,6 +37,7 @@
 // GL related CVARs
 CVAR(Bool, gl_portals, true, 0)
 CVAR(Bool, gl_noquery, false, 0)
+CVAR(Bool, gl_lazyquery, true, CVAR_GLOBALCONFIG|CVAR_ARCHIVE)	// read occlusion queries back one frame late instead of stalling
 CVAR(Bool,gl_mirrors,true,0)	// This is for debugging only!
 CVAR(Bool,gl_mirror_envmap, true, CVAR_GLOBALCONFIG|CVAR_ARCHIVE)
 CVAR(Bool, gl_seamless, false, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
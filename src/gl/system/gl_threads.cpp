@@ -0,0 +1,79 @@
+//
+//---------------------------------------------------------------------------
+//
+// Copyright(C) 2017 GZDoom contributors
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see http://www.gnu.org/licenses/
+//
+//--------------------------------------------------------------------------
+//
+/*
+** gl_threads.cpp
+** Worker thread helpers for the GL scene setup
+**
+** The BSP walk itself cannot be split across threads: the angle clipper
+** depends on strict front-to-back traversal order for occlusion, and the
+** subsector processing mutates shared playsim state (validcount, sector
+** flags) and issues GL calls. What can be farmed out is the per-view
+** preparation work that is independent per element, starting with the
+** pseudo angle calculation for the map vertices which the clipper
+** otherwise performs lazily, one cache miss at a time, in the middle of
+** the walk.
+*/
+
+#include "doomtype.h"
+#include "r_defs.h"
+#include "r_state.h"
+#include "c_cvars.h"
+#include "threadpool.h"
+
+#include "gl/scene/gl_clipper.h"
+
+CVAR(Bool, gl_multithread, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
+
+//==========================================================================
+//
+// Calculates the clip angles of all map vertices for the current view
+// point on the thread pool so that the BSP walk only hits warm caches.
+// Small maps are left to the lazy path because the fixed fork/join cost
+// would eat the gain.
+//
+//==========================================================================
+
+void gl_PrecalcVertexAngles()
+{
+	const int MIN_VERTS_PER_THREAD = 2048;
+
+	FThreadPool &pool = FThreadPool::Instance();
+	if (!gl_multithread || pool.NumThreads() <= 1 || numvertexes < MIN_VERTS_PER_THREAD * 2)
+	{
+		return;
+	}
+
+	int numchunks = pool.NumThreads() * 4;
+	int chunksize = (numvertexes + numchunks - 1) / numchunks;
+
+	pool.ParallelFor(numchunks, [=](int chunk)
+	{
+		int start = chunk * chunksize;
+		int end = MIN(start + chunksize, numvertexes);
+
+		for (int i = start; i < end; i++)
+		{
+			vertexes[i].viewangle = R_PointToPseudoAngle(vertexes[i].fX(), vertexes[i].fY());
+			vertexes[i].angletime = Clipper::anglecache;
+		}
+	});
+}
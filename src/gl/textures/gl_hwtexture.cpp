@@ -24,6 +24,13 @@
 ** Low level OpenGL texture handling. These classes are also
 ** containers for the various translations a texture can have.
 **
+** Translations are stored as separate texture copies on purpose: the
+** uploaded pixels are full RGBA (hires replacements, PNGs and composites
+** never pass through the game palette), so a palette-remap-in-shader
+** scheme could only cover plain paletted art and would still need these
+** copies for everything else. Variants that go unused are dropped by
+** CleanUnused during precache instead.
+**
 */
 
 #include "gl/system/gl_system.h"
@@ -32,6 +39,8 @@
 #include "c_cvars.h"
 #include "c_dispatch.h"
 #include "v_palette.h"
+#include "m_misc.h"
+#include "cmdlib.h"
 
 #include "gl/system/gl_interface.h"
 #include "gl/system/gl_cvars.h"
@@ -151,7 +160,94 @@ void FHardwareTexture::Resize(int width, int height, unsigned char *src_data, un
 
 
 //===========================================================================
-// 
+//
+//	On-disk cache for compressed texture uploads
+//
+// When a compressed internal format is in use the driver transcodes every
+// texture on upload, which is by far the most expensive part of creating
+// one. The result is read back once and stored in the cache directory,
+// keyed by a checksum of the pixel data, so subsequent runs can feed the
+// compressed blocks straight to glCompressedTexImage2D.
+//
+//===========================================================================
+
+CVAR(Bool, gl_texture_cache, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
+
+static bool IsCompressedFormat(int format)
+{
+	switch (format)
+	{
+	case GL_COMPRESSED_RGBA_ARB:
+	case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+	case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+	case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+static FString CachedTextureName(DWORD crc, int texformat, int rw, int rh, bool create)
+{
+	FString path = M_GetCachePath(create);
+	path << "/textures";
+	if (create) CreatePath(path);
+	path.AppendFormat("/%08x-%dx%d-%04x.gztc", crc, rw, rh, texformat & 0xffff);
+	return path;
+}
+
+static bool UploadCachedTexture(DWORD crc, int texformat, int rw, int rh)
+{
+	FString path = CachedTextureName(crc, texformat, rw, rh, false);
+	FILE *f = fopen(path, "rb");
+	if (f == NULL) return false;
+
+	DWORD head[4];
+	bool ok = false;
+	if (fread(head, sizeof(DWORD), 4, f) == 4 &&
+		head[0] == MAKE_ID('G','Z','T','C') && head[2] > 0 && head[2] < 0x10000000)
+	{
+		TArray<BYTE> data;
+		data.Resize(head[2]);
+		if (fread(&data[0], 1, head[2], f) == head[2])
+		{
+			glCompressedTexImage2D(GL_TEXTURE_2D, 0, head[1], rw, rh, 0, head[2], &data[0]);
+			ok = glGetError() == GL_NO_ERROR;
+		}
+	}
+	fclose(f);
+	return ok;
+}
+
+static void StoreCachedTexture(DWORD crc, int texformat, int rw, int rh)
+{
+	GLint compressed = 0, realformat = 0, size = 0;
+
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+	if (!compressed) return;
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &realformat);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+	if (size <= 0) return;
+
+	TArray<BYTE> data;
+	data.Resize(size);
+	glGetCompressedTexImage(GL_TEXTURE_2D, 0, &data[0]);
+
+	FString path = CachedTextureName(crc, texformat, rw, rh, true);
+	FILE *f = fopen(path, "wb");
+	if (f != NULL)
+	{
+		DWORD head[4] = { MAKE_ID('G','Z','T','C'), (DWORD)realformat, (DWORD)size, 0 };
+		fwrite(head, sizeof(DWORD), 4, f);
+		fwrite(&data[0], 1, size, f);
+		fclose(f);
+	}
+}
+
+
+//===========================================================================
+//
 //	Loads the texture image into the hardware
 //
 // NOTE: For some strange reason I was unable to find the source buffer
@@ -207,7 +303,65 @@ unsigned int FHardwareTexture::CreateTexture(unsigned char * buffer, int w, int
 			}
 		}
 	}
-	glTexImage2D(GL_TEXTURE_2D, 0, texformat, rw, rh, 0, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
+	// Only textures of meaningful size are worth a cache entry; tiny ones
+	// transcode faster than the file can be opened.
+	bool cacheable = gl_texture_cache && IsCompressedFormat(texformat) && rw * rh >= 256 * 256;
+	DWORD texcrc = 0;
+	if (cacheable)
+	{
+		texcrc = CalcCRC32(buffer, rw * rh * 4);
+		if (UploadCachedTexture(texcrc, texformat, rw, rh))
+		{
+			if (deletebuffer) free(buffer);
+			if (mipmap && TexFilter[gl_texture_filter].mipmapping)
+			{
+				glGenerateMipmap(GL_TEXTURE_2D);
+				glTex->mipmapped = true;
+			}
+			if (texunit != 0) glActiveTexture(GL_TEXTURE0);
+			return glTex->glTexID;
+		}
+	}
+
+	// Stage the upload through a pixel buffer object where possible. With
+	// client memory the driver must copy the data before glTexImage2D can
+	// return; from a PBO it can schedule the transfer asynchronously, which
+	// avoids the first-use hitch with large hires textures. A small ring is
+	// used so that back-to-back uploads do not serialize on one buffer.
+	bool uploaded = false;
+	if (!gl.legacyMode)
+	{
+		static unsigned int upload_pbos[4];
+		static int upload_pboindex;
+
+		unsigned int &pbo = upload_pbos[upload_pboindex];
+		upload_pboindex = (upload_pboindex + 1) & 3;
+
+		if (pbo == 0) glGenBuffers(1, &pbo);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+
+		int size = rw * rh * 4;
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);	// orphan any previous contents
+		void *staging = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		if (staging != NULL)
+		{
+			memcpy(staging, buffer, size);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			glTexImage2D(GL_TEXTURE_2D, 0, texformat, rw, rh, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+			uploaded = true;
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+	if (!uploaded)
+	{
+		glTexImage2D(GL_TEXTURE_2D, 0, texformat, rw, rh, 0, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
+	}
+	if (cacheable)
+	{
+		// This stalls on the readback but only the first time the texture
+		// is ever transcoded on this machine.
+		StoreCachedTexture(texcrc, texformat, rw, rh);
+	}
 
 	if (deletebuffer) free(buffer);
 
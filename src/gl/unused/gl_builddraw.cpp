@@ -217,7 +217,6 @@ class BunchDrawer
 	int StartTime;
 	TArray<FBunch> Bunches;
 	TArray<int> CompareData;
-	sector_t fakebacksec;
 
 	//==========================================================================
 	//
@@ -347,7 +346,7 @@ private:
 				// clipping checks are only needed when the backsector is not the same as the front sector
 				gl_CheckViewArea(line->start, line->end, line->refseg->frontsector, line->refseg->backsector);
 
-				*pbacksector = backsector = gl_FakeFlat(line->refseg->backsector, &fakebacksec, true);
+				*pbacksector = backsector = gl_FakeFlat(line->refseg->backsector, true);
 
 				blocking = gl_CheckClip(line->sidedef, sector, backsector);
 				if (blocking)
@@ -375,7 +374,6 @@ private:
 	{
 		FBunch *bunch = &Bunches[bnch];
 
-		sector_t fake;
 		sector_t *sec;
 		sector_t *backsector;
 
@@ -387,7 +385,7 @@ private:
 
 
 			// Draw this line. todo: optimize
-			sec = gl_FakeFlat(ln->refseg->frontsector, &fake, false);
+			sec = gl_FakeFlat(ln->refseg->frontsector, false);
 
 			int clipped = ClipLine(ln, sec, &backsector);
 
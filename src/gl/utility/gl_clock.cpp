@@ -47,6 +47,7 @@
 #include "c_console.h"
 #include "c_dispatch.h"
 #include "r_utility.h"
+#include "r_main.h"
 #include "v_video.h"
 #include "gl/utility/gl_clock.h"
 #include "gl/utility/gl_convert.h"
@@ -64,6 +65,7 @@ int vertexcount, flatvertices, flatprimitives;
 
 int rendered_lines,rendered_flats,rendered_sprites,render_vertexsplit,render_texsplit,rendered_decals, rendered_portals;
 int iter_dlightf, iter_dlight, draw_dlight, draw_dlightf;
+int scene_drawcalls, scene_statechanges, scene_maxportaldepth;
 
 double		gl_SecondsPerCycle = 1e-8;
 double		gl_MillisecPerCycle = 1e-5;		// 100 MHz
@@ -136,6 +138,7 @@ void ResetProfilingData()
 
 	flatvertices=flatprimitives=vertexcount=0;
 	render_texsplit=render_vertexsplit=rendered_lines=rendered_flats=rendered_sprites=rendered_decals=rendered_portals = 0;
+	scene_drawcalls=scene_statechanges=scene_maxportaldepth = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -167,6 +170,33 @@ static void AppendRenderStats(FString &out)
 		rendered_lines, render_vertexsplit, render_texsplit, vertexcount, rendered_flats, flatprimitives, flatvertices, rendered_sprites,rendered_decals, rendered_portals );
 }
 
+//-----------------------------------------------------------------------------
+//
+// Renderer-agnostic scene complexity. This reports the counters of
+// whichever renderer is currently active in a common format, so mappers
+// can compare the same viewpoint across both backends.
+//
+//-----------------------------------------------------------------------------
+
+EXTERN_CVAR(Int, vid_renderer)
+
+static void AppendSceneStats(FString &out)
+{
+	if (vid_renderer == 1)
+	{
+		out.AppendFormat("Scene: %d segs, %d flats, %d sprites, %d portals (max depth %d)\n"
+			"%d draw calls, %d state changes\n",
+			rendered_lines, rendered_flats, rendered_sprites, rendered_portals,
+			scene_maxportaldepth, scene_drawcalls, scene_statechanges);
+	}
+	else
+	{
+		out.AppendFormat("Scene: %d segs, %d visplanes, %d sprites (%d drawn), %d portals\n",
+			sw_walked_segs, sw_created_visplanes, sw_added_sprites, sw_drawn_sprites,
+			sw_rendered_portals);
+	}
+}
+
 static void AppendLightStats(FString &out)
 {
 	out.AppendFormat("DLight - Walls: %d processed, %d rendered - Flats: %d processed, %d rendered\n", 
@@ -201,6 +231,13 @@ ADD_STAT(lightstats)
 	return out;
 }
 
+ADD_STAT(scene)
+{
+	FString out;
+	AppendSceneStats(out);
+	return out;
+}
+
 void AppendMissingTextureStats(FString &out);
 
 
@@ -223,6 +260,7 @@ void CheckBench()
 			level.MapName.GetChars(), level.LevelName.GetChars(), ViewPos.X, ViewPos.Y, ViewPos.Z, ViewAngle.Degrees, ViewPitch.Degrees);
 		
 		AppendRenderStats(compose);
+		AppendSceneStats(compose);
 		AppendRenderTimes(compose);
 		AppendLightStats(compose);
 		AppendMissingTextureStats(compose);
@@ -117,6 +117,8 @@ extern int rendered_portals;
 
 extern int vertexcount, flatvertices, flatprimitives;
 
+extern int scene_drawcalls, scene_statechanges, scene_maxportaldepth;
+
 void ResetProfilingData();
 void CheckBench();
 void  checkBenchActive();
@@ -128,6 +128,12 @@ bool SB_ForceActive = false;
 //
 // HU_DrawScores
 //
+// Redrawing this from scratch every frame is fine at this engine's scale:
+// the player limit is MAXPLAYERS (8), so it is a handful of rows of text.
+// Caching pre-rendered rows would also need somewhere to render them to,
+// and the 2D layer has no offscreen target in either the software canvas
+// or the GL path - so no retained-mode cache here.
+//
 //==========================================================================
 
 void HU_DrawScores (player_t *player)
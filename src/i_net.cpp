@@ -31,6 +31,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <thread>
+#include <atomic>
 
 /* [Petteri] Use Winsock for Win32: */
 #ifdef __WIN32__
@@ -144,6 +146,26 @@ struct PreGamePacket
 
 BYTE TransmitBuffer[TRANSMIT_SIZE];
 
+// Once the game is running, datagrams are pulled off the socket by a
+// dedicated thread and handed to PacketGet through a single-producer,
+// single-consumer ring, so packets are drained from the OS buffer as soon
+// as they arrive instead of waiting for the next NetUpdate.
+#define RECV_RING_SIZE 32		// must be a power of 2
+
+struct FRecvSlot
+{
+	sockaddr_in from;
+	int len;				// SOCKET_ERROR if err holds an error code
+	int err;
+	BYTE data[TRANSMIT_SIZE];
+};
+
+static FRecvSlot RecvRing[RECV_RING_SIZE];
+static std::atomic<unsigned> RecvRingHead, RecvRingTail;
+static std::thread RecvThread;
+static std::atomic<bool> RecvThreadExit;
+static bool RecvThreadActive;
+
 //
 // UDPsocket
 //
@@ -195,6 +217,86 @@ int FindNode (const sockaddr_in *address)
 	return i;
 }
 
+//
+// RecvThreadMain
+//
+// Waits on the socket and pushes complete datagrams into the ring. The
+// main thread is the only consumer, so publishing a slot is just a release
+// store of the head index.
+//
+static void RecvThreadMain (void)
+{
+	while (!RecvThreadExit.load(std::memory_order_relaxed))
+	{
+		fd_set readset;
+		timeval timeout;
+
+		FD_ZERO (&readset);
+		FD_SET (mysocket, &readset);
+		timeout.tv_sec = 0;
+		timeout.tv_usec = 100000;	// wake up regularly to check for exit
+		if (select ((int)mysocket + 1, &readset, NULL, NULL, &timeout) <= 0)
+		{
+			continue;
+		}
+		for (;;)
+		{
+			unsigned head = RecvRingHead.load(std::memory_order_relaxed);
+
+			if (head - RecvRingTail.load(std::memory_order_acquire) >= RECV_RING_SIZE)
+			{
+				// The ring is full. Drop the datagram, the same as any
+				// other overflowing UDP queue would.
+				BYTE scratch[TRANSMIT_SIZE];
+				recvfrom (mysocket, (char *)scratch, TRANSMIT_SIZE, 0, NULL, NULL);
+				continue;
+			}
+
+			FRecvSlot &slot = RecvRing[head & (RECV_RING_SIZE - 1)];
+			socklen_t fromlen = sizeof(slot.from);
+			int c = recvfrom (mysocket, (char *)slot.data, TRANSMIT_SIZE, 0,
+				(sockaddr *)&slot.from, &fromlen);
+
+			slot.err = 0;
+			if (c == SOCKET_ERROR)
+			{
+				int err = WSAGetLastError ();
+				if (err == WSAEWOULDBLOCK)
+				{
+					break;		// socket drained; wait in select again
+				}
+				if (RecvThreadExit.load(std::memory_order_relaxed))
+				{
+					return;		// the socket is probably being torn down
+				}
+				slot.err = err;
+			}
+			slot.len = c;
+			RecvRingHead.store(head + 1, std::memory_order_release);
+		}
+	}
+}
+
+static void StopRecvThread (void)
+{
+	if (RecvThread.joinable())
+	{
+		RecvThreadExit.store(true);
+		RecvThread.join();
+		RecvThreadActive = false;
+	}
+}
+
+static void StartRecvThread (void)
+{
+	if (!RecvThreadActive && mysocket != INVALID_SOCKET)
+	{
+		RecvThreadExit.store(false);
+		RecvThread = std::thread (RecvThreadMain);
+		RecvThreadActive = true;
+	}
+}
+
 //
 // PacketSend
 //
@@ -257,16 +359,42 @@ void PacketGet (void)
 	socklen_t fromlen;
 	sockaddr_in fromaddress;
 	int node;
+	int err = 0;
 
-	fromlen = sizeof(fromaddress);
-	c = recvfrom (mysocket, (char*)TransmitBuffer, TRANSMIT_SIZE, 0,
-				  (sockaddr *)&fromaddress, &fromlen);
+	if (RecvThreadActive)
+	{
+		unsigned tail = RecvRingTail.load(std::memory_order_relaxed);
+
+		if (tail == RecvRingHead.load(std::memory_order_acquire))
+		{
+			doomcom.remotenode = -1;		// no packet
+			return;
+		}
+
+		FRecvSlot &slot = RecvRing[tail & (RECV_RING_SIZE - 1)];
+		fromaddress = slot.from;
+		c = slot.len;
+		err = slot.err;
+		if (c > 0)
+		{
+			memcpy (TransmitBuffer, slot.data, c);
+		}
+		RecvRingTail.store(tail + 1, std::memory_order_release);
+	}
+	else
+	{
+		fromlen = sizeof(fromaddress);
+		c = recvfrom (mysocket, (char*)TransmitBuffer, TRANSMIT_SIZE, 0,
+					  (sockaddr *)&fromaddress, &fromlen);
+		if (c == SOCKET_ERROR)
+		{
+			err = WSAGetLastError();
+		}
+	}
 	node = FindNode (&fromaddress);
 
 	if (node >= 0 && c == SOCKET_ERROR)
 	{
-		int err = WSAGetLastError();
-
 		if (err == WSAECONNRESET)
 		{ // The remote node aborted unexpectedly, so pretend it sent an exit packet
 
@@ -286,7 +414,9 @@ void PacketGet (void)
 		}
 		else if (err != WSAEWOULDBLOCK)
 		{
-			I_Error ("GetPacket: %s", neterror ());
+			// The error may have been picked up on the receive thread, so
+			// report the saved code instead of the current thread's last one.
+			I_Error ("GetPacket: error %d", err);
 		}
 		else
 		{
@@ -357,6 +487,41 @@ void PreSend (const void *buffer, int bufferlen, const sockaddr_in *to)
 	sendto (mysocket, (const char *)buffer, bufferlen, 0, (const sockaddr *)to, sizeof(*to));
 }
 
+//
+// Host name resolution runs on a worker thread so that a slow DNS server
+// cannot freeze startup; the startup screen keeps pumping while we wait.
+// The job is heap allocated because an aborting user exits the game while
+// gethostbyname may still be running.
+//
+struct FResolveJob
+{
+	FResolveJob (const char *name) : Address(INADDR_NONE), Done(false)
+	{
+		strncpy (Name, name, sizeof(Name) - 1);
+		Name[sizeof(Name) - 1] = '\0';
+	}
+
+	char Name[256];
+	DWORD Address;
+	std::atomic<bool> Done;
+};
+
+static void ResolveWorker (FResolveJob *job)
+{
+	hostent *hostentry = gethostbyname (job->Name);
+
+	if (hostentry != NULL)
+	{
+		job->Address = *(DWORD *)hostentry->h_addr_list[0];
+	}
+	job->Done.store(true, std::memory_order_release);
+}
+
+static bool CheckForResolve (void *userdata)
+{
+	return static_cast<FResolveJob *>(userdata)->Done.load(std::memory_order_acquire);
+}
+
 void BuildAddress (sockaddr_in *address, const char *name)
 {
 	hostent *hostentry;		// host information entry
@@ -400,6 +565,28 @@ void BuildAddress (sockaddr_in *address, const char *name)
 		address->sin_addr.s_addr = inet_addr (target);
 		Printf ("Node number %d, address %s\n", doomcom.numnodes, target.GetChars());
 	}
+	else if (StartScreen != NULL)
+	{
+		FResolveJob *job = new FResolveJob (target.GetChars());
+		std::thread worker (ResolveWorker, job);
+
+		StartScreen->NetInit ("Resolving host name", 0);
+		if (!StartScreen->NetLoop (CheckForResolve, job))
+		{
+			// gethostbyname cannot be interrupted, so let the worker run
+			// out on its own; the job leaks, but we are exiting anyway.
+			worker.detach ();
+			exit (0);
+		}
+		worker.join ();
+
+		DWORD addr = job->Address;
+		delete job;
+		if (addr == INADDR_NONE)
+			I_FatalError ("gethostbyname: couldn't find %s", target.GetChars());
+		address->sin_addr.s_addr = addr;
+		Printf ("Node number %d, hostname %s\n", doomcom.numnodes, target.GetChars());
+	}
 	else
 	{
 		hostentry = gethostbyname (target);
@@ -413,6 +600,7 @@ void BuildAddress (sockaddr_in *address, const char *name)
 
 void CloseNetwork (void)
 {
+	StopRecvThread ();
 	if (mysocket != INVALID_SOCKET)
 	{
 		closesocket (mysocket);
@@ -985,6 +1173,10 @@ bool I_InitNetwork (void)
 		doomcom.consoleplayer = 0;
 		return false;
 	}
+	// The pregame setup polls the socket directly, so the receive thread
+	// only gets started once the game is actually going.
+	StartRecvThread ();
+
 	if (doomcom.numnodes < 3)
 	{ // Packet server mode with only two players is effectively the same as
 	  // peer-to-peer but with some slightly larger packets.
@@ -69,13 +69,17 @@ void FState::SetAction(const char *name)
 	ActionFunc = FindGlobalActionFunction(name)->Variants[0].Implementation;
 }
 
+// The stack state action functions are executed on. This is file scope so
+// that calling an action does not have to pass the initialization guard of
+// a function local static on every single call.
+static VMFrameStack ActionCallStack;
+
 bool FState::CallAction(AActor *self, AActor *stateowner, FStateParamInfo *info, FState **stateret)
 {
 	if (ActionFunc != NULL)
 	{
 		ActionCycles.Clock();
 
-		static VMFrameStack stack;
 		VMValue params[3] = { self, stateowner, VMValue(info, ATAG_STATEINFO) };
 		// If the function returns a state, store it at *stateret.
 		// If it doesn't return a state but stateret is non-NULL, we need
@@ -92,13 +96,13 @@ bool FState::CallAction(AActor *self, AActor *stateowner, FStateParamInfo *info,
 		}
 		if (stateret == NULL)
 		{
-			stack.Call(ActionFunc, params, countof(params), NULL, 0, NULL);
+			ActionCallStack.Call(ActionFunc, params, countof(params), NULL, 0, NULL);
 		}
 		else
 		{
 			VMReturn ret;
 			ret.PointerAt((void **)stateret);
-			stack.Call(ActionFunc, params, countof(params), &ret, 1, NULL);
+			ActionCallStack.Call(ActionFunc, params, countof(params), &ret, 1, NULL);
 		}
 		ActionCycles.Unclock();
 		return true;
@@ -668,9 +672,13 @@ void DamageTypeDefinition::Apply(FName type)
 	GlobalDamageDefinitions[type] = *this; 
 }
 
-DamageTypeDefinition *DamageTypeDefinition::Get(FName type) 
-{ 
-	return GlobalDamageDefinitions.CheckKey(type); 
+DamageTypeDefinition *DamageTypeDefinition::Get(FName type)
+{
+	// This runs for every point of damage dealt, but most games never
+	// define any global damage types, so skip the hash lookup when the
+	// table is known to be empty.
+	if (GlobalDamageDefinitions.CountUsed() == 0) return NULL;
+	return GlobalDamageDefinitions.CheckKey(type);
 }
 
 bool DamageTypeDefinition::IgnoreArmor(FName type)
@@ -76,6 +76,12 @@ inline SDWORD SafeDivScale32 (SDWORD a, SDWORD b)
 	return DivScale32 (a, b);
 }
 
+// Fixed point math is no longer on any hot path: the playsim and the wall
+// texturing interpolators have been converted to doubles, and the few
+// remaining users (ACS arithmetic, the voxel rasterizer, plane stepping)
+// call these a handful of times per primitive. Batch/SIMD variants were
+// considered and rejected for lack of any loop that would feed them four
+// independent multiplications at a time.
 #define FixedMul MulScale16
 #define FixedDiv SafeDivScale16
 
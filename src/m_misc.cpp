@@ -31,6 +31,7 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <time.h>
+#include <thread>
 
 #include "doomtype.h"
 #include "version.h"
@@ -80,6 +81,7 @@ FGameConfigFile *GameConfig;
 CVAR(Bool, screenshot_quiet, false, CVAR_ARCHIVE|CVAR_GLOBALCONFIG);
 CVAR(String, screenshot_type, "png", CVAR_ARCHIVE|CVAR_GLOBALCONFIG);
 CVAR(String, screenshot_dir, "", CVAR_ARCHIVE|CVAR_GLOBALCONFIG);
+CVAR(Bool, screenshot_async, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG);
 EXTERN_CVAR(Bool, longsavemessages);
 
 static long ParseCommandLine (const char *args, int *argc, char **argv);
@@ -597,6 +599,56 @@ void WritePCXfile (FileWriter *file, const BYTE *buffer, const PalEntry *palette
 	}
 }
 
+//
+// Asynchronous PNG writing
+//
+// The deflate pass for a high resolution screenshot takes long enough to
+// freeze the game for a noticeable moment, so the encode runs on a
+// background thread working on a copy of the frame. Only one write is in
+// flight at a time; the next screenshot (or exit) joins the previous one
+// and reports its result.
+//
+
+struct FScreenshotJob
+{
+	FileWriter *file;
+	BYTE *data;			// owned copy of the frame, freed by the worker
+	const BYTE *pixels;	// start pointer honoring the pitch sign
+	PalEntry palette[256];
+	ESSType color_type;
+	int width, height, pitch;
+	char software[100];
+};
+
+static std::thread ScreenshotThread;
+static bool ScreenshotFailed;
+
+static void M_FinishScreenShot()
+{
+	if (ScreenshotThread.joinable())
+	{
+		ScreenshotThread.join();
+		if (ScreenshotFailed)
+		{
+			Printf("Could not create screenshot.\n");
+			ScreenshotFailed = false;
+		}
+	}
+}
+
+static void M_ScreenShotWorker(FScreenshotJob *job)
+{
+	if (!M_CreatePNG(job->file, job->pixels, job->palette, job->color_type, job->width, job->height, job->pitch) ||
+		!M_AppendPNGText(job->file, "Software", job->software) ||
+		!M_FinishPNG(job->file))
+	{
+		ScreenshotFailed = true;
+	}
+	delete job->file;
+	delete[] job->data;
+	delete job;
+}
+
 //
 // WritePNGfile
 //
@@ -716,6 +768,7 @@ void M_ScreenShot (const char *filename)
 		{
 			screen->GetFlashedPalette(palette);
 		}
+		M_FinishScreenShot();	// only one write may be in flight
 		file = FileWriter::Open(autoname);
 		if (file == NULL)
 		{
@@ -727,13 +780,40 @@ void M_ScreenShot (const char *filename)
 		{
 			WritePCXfile(file, buffer, palette, color_type,
 				screen->GetWidth(), screen->GetHeight(), pitch);
+			delete file;
 		}
-		else
+		else if (!screenshot_async)
 		{
 			WritePNGfile(file, buffer, palette, color_type,
 				screen->GetWidth(), screen->GetHeight(), pitch);
+			delete file;
+		}
+		else
+		{
+			FScreenshotJob *job = new FScreenshotJob;
+			int height = screen->GetHeight();
+			int rowbytes = abs(pitch);
+
+			job->file = file;
+			job->data = new BYTE[rowbytes * height];
+			const BYTE *lowest = pitch >= 0 ? buffer : buffer + (height - 1) * pitch;
+			memcpy(job->data, lowest, rowbytes * height);
+			job->pixels = pitch >= 0 ? job->data : job->data + (height - 1) * rowbytes;
+			memcpy(job->palette, palette, sizeof(job->palette));
+			job->color_type = color_type;
+			job->width = screen->GetWidth();
+			job->height = height;
+			job->pitch = pitch;
+			mysnprintf(job->software, countof(job->software), GAMENAME " %s", GetVersionString());
+
+			static bool attermset;
+			if (!attermset)
+			{
+				atterm(M_FinishScreenShot);
+				attermset = true;
+			}
+			ScreenshotThread = std::thread(M_ScreenShotWorker, job);
 		}
-		delete file;
 		screen->ReleaseScreenshotBuffer();
 
 		if (!screenshot_quiet)
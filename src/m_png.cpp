@@ -116,6 +116,15 @@ CUSTOM_CVAR(Int, png_level, 5, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 	else if (self > 9)
 		self = 9;
 }
+// Savegame pics are written while the player waits, so they default to a
+// fast compression level; size matters less than latency there.
+CUSTOM_CVAR(Int, png_savegame_level, 1, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
+{
+	if (self < 0)
+		self = 0;
+	else if (self > 9)
+		self = 9;
+}
 CVAR(Float, png_gamma, 0.f, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 
 // PRIVATE DATA DEFINITIONS ------------------------------------------------
@@ -132,7 +141,7 @@ CVAR(Float, png_gamma, 0.f, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 //==========================================================================
 
 bool M_CreatePNG (FileWriter *file, const BYTE *buffer, const PalEntry *palette,
-				  ESSType color_type, int width, int height, int pitch)
+				  ESSType color_type, int width, int height, int pitch, int level)
 {
 	BYTE work[8 +				// signature
 			  12+2*4+5 +		// IHDR
@@ -174,7 +183,7 @@ bool M_CreatePNG (FileWriter *file, const BYTE *buffer, const PalEntry *palette,
 	if (file->Write (work, work_len) != work_len)
 		return false;
 
-	return M_SaveBitmap (buffer, color_type, width, height, pitch, file);
+	return M_SaveBitmap (buffer, color_type, width, height, pitch, file, level);
 }
 
 //==========================================================================
@@ -904,7 +913,7 @@ static int SelectFilter(Byte row[5][1 + MAXWIDTH*3], Byte prior[MAXWIDTH*3], int
 //
 //==========================================================================
 
-bool M_SaveBitmap(const BYTE *from, ESSType color_type, int width, int height, int pitch, FileWriter *file)
+bool M_SaveBitmap(const BYTE *from, ESSType color_type, int width, int height, int pitch, FileWriter *file, int level)
 {
 #if USE_FILTER_HEURISTIC
 	Byte prior[MAXWIDTH*3];
@@ -921,7 +930,9 @@ bool M_SaveBitmap(const BYTE *from, ESSType color_type, int width, int height, i
 	stream.avail_in = 0;
 	stream.zalloc = Z_NULL;
 	stream.zfree = Z_NULL;
-	err = deflateInit (&stream, png_level);
+	if (level < 0) level = png_level;
+	else if (level > 9) level = 9;
+	err = deflateInit (&stream, level);
 
 	if (err != Z_OK)
 	{
@@ -43,9 +43,10 @@
 // Start writing an 8-bit palettized PNG file.
 // The passed file should be a newly created file.
 // This function writes the PNG signature and the IHDR, gAMA, PLTE, and IDAT
-// chunks.
+// chunks. A level of -1 compresses with the png_level CVAR's setting;
+// latency-sensitive writers (e.g. savegame pics) can pass a low level.
 bool M_CreatePNG (FileWriter *file, const BYTE *buffer, const PalEntry *pal,
-				  ESSType color_type, int width, int height, int pitch);
+				  ESSType color_type, int width, int height, int pitch, int level = -1);
 
 // Creates a grayscale 1x1 PNG file. Used for savegames without savepics.
 bool M_CreateDummyPNG (FileWriter *file);
@@ -59,7 +60,7 @@ bool M_AppendPNGText (FileWriter *file, const char *keyword, const char *text);
 // Appends the IEND chunk to a PNG file.
 bool M_FinishPNG (FileWriter *file);
 
-bool M_SaveBitmap(const BYTE *from, ESSType color_type, int width, int height, int pitch, FileWriter *file);
+bool M_SaveBitmap(const BYTE *from, ESSType color_type, int width, int height, int pitch, FileWriter *file, int level = -1);
 
 // PNG Reading --------------------------------------------------------------
 
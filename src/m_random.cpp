@@ -53,6 +53,14 @@
 **   type below for each block of code which calls P_Random. If two calls to
 **   P_Random are not in "control-equivalent blocks", i.e. there are any cases
 **   where one is executed, and the other is not, put them in separate classes.
+**
+** Note that these named generators already are per-subsystem streams; what
+** keeps them globally ordered is not their design but the playsim itself,
+** which defines the call sequence. Splitting them further (e.g. one stream
+** per actor keyed on spawn order) would not unlock concurrent ticking -
+** actors mutate shared state far beyond the RNGs - and any change to which
+** stream a call draws from desyncs every existing demo and netgame peer,
+** so the current streams and their consumption order are load-bearing.
 */
 
 // HEADER FILES ------------------------------------------------------------
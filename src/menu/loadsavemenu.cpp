@@ -49,6 +49,8 @@
 #include "serializer.h"
 #include "resourcefiles/resourcefile.h"
 
+#include <sys/stat.h>
+
 
 
 
@@ -127,6 +129,158 @@ int DLoadSaveMenu::LastAccessed = -1;
 
 FSaveGameNode *quickSaveSlot;
 
+//=============================================================================
+//
+// Savegame directory index
+//
+// Opening every *.zds in the save directory just to read its title gets
+// slow once autosaves pile up, so the outcome of the last full scan is kept
+// in a small index file next to the saves. Entries are keyed by file name,
+// size and modification time; files that don't match their entry are parsed
+// again the normal way. How a file is listed also depends on the engine
+// version and on which WADs are loaded, so both go into the file header and
+// the whole index is discarded when either changes.
+//
+//=============================================================================
+
+struct FSaveIndexEntry
+{
+	FString Key;		// file name, size and modification time
+	FString Title;
+	BYTE Status;
+};
+
+enum
+{
+	INDEX_NotASave,		// parsed before and found to be none of our business
+	INDEX_Good,
+	INDEX_OldVersion,
+	INDEX_MissingWads
+};
+
+static const DWORD SAVEINDEX_VERSION = 1;
+
+static FString SaveIndexHeaderString ()
+{
+	FString header;
+
+	header << VERSIONSTR << '|';
+	for (int i = 0; i < Wads.GetNumWads(); i++)
+	{
+		header << Wads.GetWadName (i) << ';';
+	}
+	return header;
+}
+
+static FString BuildSaveIndexKey (const char *fname, const char *filepath)
+{
+	FString key;
+	struct stat info;
+
+	if (stat (filepath, &info) == 0)
+	{
+		key.Format ("%s:%llu:%llu", fname,
+			(unsigned long long)info.st_size, (unsigned long long)info.st_mtime);
+	}
+	return key;
+}
+
+static void AddSaveIndexEntry (TArray<FSaveIndexEntry> &newindex, const FString &key, BYTE status, const char *title)
+{
+	if (key.IsNotEmpty())
+	{
+		FSaveIndexEntry e;
+		e.Key = key;
+		e.Title = title;
+		e.Status = status;
+		newindex.Push (e);
+	}
+}
+
+static unsigned ReadSaveIndex (TMap<FString, FSaveIndexEntry> &index)
+{
+	FILE *f = fopen (G_BuildSaveName ("save.index", -1), "rb");
+	if (f == NULL) return 0;
+
+	char magic[4];
+	DWORD version, len, count;
+	FString header = SaveIndexHeaderString ();
+	if (fread (magic, 1, 4, f) != 4 || memcmp (magic, "ZDSX", 4) ||
+		fread (&version, 4, 1, f) != 1 || LittleLong(version) != SAVEINDEX_VERSION ||
+		fread (&len, 4, 1, f) != 1 || LittleLong(len) != (DWORD)header.Len())
+	{
+		fclose (f);
+		return 0;
+	}
+	TArray<char> buf(header.Len() + 1);
+	buf.Resize(header.Len() + 1);
+	if (fread (&buf[0], 1, header.Len(), f) != header.Len() ||
+		memcmp (&buf[0], header.GetChars(), header.Len()) ||
+		fread (&count, 4, 1, f) != 1)
+	{
+		fclose (f);
+		return 0;
+	}
+
+	unsigned read;
+	count = LittleLong(count);
+	for (read = 0; read < count; read++)
+	{
+		DWORD keylen, titlelen;
+		BYTE status;
+		if (fread (&keylen, 4, 1, f) != 1 || fread (&titlelen, 4, 1, f) != 1 ||
+			fread (&status, 1, 1, f) != 1)
+		{
+			break;
+		}
+		keylen = LittleLong(keylen);
+		titlelen = LittleLong(titlelen);
+
+		FSaveIndexEntry e;
+		TArray<char> text(MAX(keylen, titlelen) + 1);
+		text.Resize(MAX(keylen, titlelen) + 1);
+		if (fread (&text[0], 1, keylen, f) != keylen) break;
+		text[keylen] = '\0';
+		e.Key = &text[0];
+		if (fread (&text[0], 1, titlelen, f) != titlelen) break;
+		text[titlelen] = '\0';
+		e.Title = &text[0];
+		e.Status = status;
+		index.Insert (e.Key, e);
+	}
+	fclose (f);
+	return read;
+}
+
+static void WriteSaveIndex (const TArray<FSaveIndexEntry> &entries)
+{
+	FILE *f = fopen (G_BuildSaveName ("save.index", -1), "wb");
+	if (f == NULL) return;
+
+	FString header = SaveIndexHeaderString ();
+	DWORD val;
+
+	fwrite ("ZDSX", 1, 4, f);
+	val = LittleLong(SAVEINDEX_VERSION);
+	fwrite (&val, 4, 1, f);
+	val = LittleLong((DWORD)header.Len());
+	fwrite (&val, 4, 1, f);
+	fwrite (header.GetChars(), 1, header.Len(), f);
+	val = LittleLong(entries.Size());
+	fwrite (&val, 4, 1, f);
+	for (unsigned i = 0; i < entries.Size(); i++)
+	{
+		val = LittleLong((DWORD)entries[i].Key.Len());
+		fwrite (&val, 4, 1, f);
+		val = LittleLong((DWORD)entries[i].Title.Len());
+		fwrite (&val, 4, 1, f);
+		fwrite (&entries[i].Status, 1, 1, f);
+		fwrite (entries[i].Key.GetChars(), 1, entries[i].Key.Len(), f);
+		fwrite (entries[i].Title.GetChars(), 1, entries[i].Title.Len(), f);
+	}
+	fclose (f);
+}
+
 //=============================================================================
 //
 // Save data maintenance (stored statically)
@@ -213,9 +367,15 @@ void DLoadSaveMenu::ReadSaveStrings ()
 {
 	if (SaveGames.Size() == 0)
 	{
+		G_FinishAsyncSave ();
+
 		void *filefirst;
 		findstate_t c_file;
 		FString filter;
+		TMap<FString, FSaveIndexEntry> index;
+		TArray<FSaveIndexEntry> newindex;
+		bool reparsed = false;
+		unsigned oldcount = ReadSaveIndex (index);
 
 		LastSaved = LastAccessed = -1;
 		quickSaveSlot = NULL;
@@ -228,6 +388,26 @@ void DLoadSaveMenu::ReadSaveStrings ()
 				// I_FindName only returns the file's name and not its full path
 				FString filepath = G_BuildSaveName (I_FindName(&c_file), -1);
 
+				// If the file is unchanged since the index was written, the
+				// result of parsing it is already known.
+				FString key = BuildSaveIndexKey (I_FindName(&c_file), filepath);
+				FSaveIndexEntry *cached = key.IsNotEmpty() ? index.CheckKey (key) : NULL;
+				if (cached != NULL)
+				{
+					if (cached->Status != INDEX_NotASave)
+					{
+						FSaveGameNode *node = new FSaveGameNode;
+						node->Filename = filepath;
+						node->bOldVersion = cached->Status == INDEX_OldVersion;
+						node->bMissingWads = cached->Status == INDEX_MissingWads;
+						strncpy (node->Title, cached->Title, SAVESTRINGSIZE);
+						InsertSaveNode (node);
+					}
+					newindex.Push (*cached);
+					continue;
+				}
+				reparsed = true;
+
 				FResourceFile *savegame = FResourceFile::OpenResourceFile(filepath, nullptr, true, true);
 				if (savegame != nullptr)
 				{
@@ -237,6 +417,7 @@ void DLoadSaveMenu::ReadSaveStrings ()
 					if (info == nullptr)
 					{
 						// savegame info not found. This is not a savegame so leave it alone.
+						AddSaveIndexEntry (newindex, key, INDEX_NotASave, "");
 						delete savegame;
 						continue;
 					}
@@ -258,6 +439,7 @@ void DLoadSaveMenu::ReadSaveStrings ()
 						{
 							// different engine or newer version:
 							// not our business. Leave it alone.
+							AddSaveIndexEntry (newindex, key, INDEX_NotASave, "");
 							delete savegame;
 							continue;
 						}
@@ -274,6 +456,7 @@ void DLoadSaveMenu::ReadSaveStrings ()
 						else
 						{
 							// different game. Skip this.
+							AddSaveIndexEntry (newindex, key, INDEX_NotASave, "");
 							delete savegame;
 							continue;
 						}
@@ -284,6 +467,14 @@ void DLoadSaveMenu::ReadSaveStrings ()
 						node->bMissingWads = missing;
 						strncpy(node->Title, title.GetChars(), SAVESTRINGSIZE);
 						InsertSaveNode(node);
+						AddSaveIndexEntry (newindex, key,
+							oldVer ? INDEX_OldVersion : missing ? INDEX_MissingWads : INDEX_Good, title);
+						delete savegame;
+					}
+					else
+					{
+						// unreadable info lump; don't keep trying every time.
+						AddSaveIndexEntry (newindex, key, INDEX_NotASave, "");
 						delete savegame;
 					}
 
@@ -360,11 +551,18 @@ void DLoadSaveMenu::ReadSaveStrings ()
 							memcpy (node->Title, title, SAVESTRINGSIZE);
 							InsertSaveNode (node);
 						}
+						AddSaveIndexEntry (newindex, key, addIt ? INDEX_OldVersion : INDEX_NotASave, addIt ? title : "");
 						fclose (file);
 					}
 				}
 			} while (I_FindNext (filefirst, &c_file) == 0);
 			I_FindClose (filefirst);
+
+			// Rewrite the index when files had to be parsed or have gone away.
+			if (reparsed || newindex.Size() != oldcount)
+			{
+				WriteSaveIndex (newindex);
+			}
 		}
 	}
 }
@@ -523,6 +721,9 @@ void DLoadSaveMenu::ExtractSaveData (int index)
 
 	UnloadSaveData ();
 
+	// The file may still be in the process of being written.
+	G_FinishAsyncSave ();
+
 	if ((unsigned)index < SaveGames.Size() &&
 		(node = SaveGames[index]) &&
 		!node->Filename.IsEmpty() &&
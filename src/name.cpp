@@ -44,9 +44,6 @@
 // that is just large enough to hold it.
 #define BLOCK_SIZE			4096
 
-// How many entries to grow the NameArray by when it needs to grow.
-#define NAME_GROW_AMOUNT	256
-
 // TYPES -------------------------------------------------------------------
 
 // Name text is stored in a linked list of NameBlock structures. This
@@ -107,11 +104,12 @@ int FName::NameManager::FindName (const char *text, bool noCreate)
 	// See if the name already exists.
 	while (scanner >= 0)
 	{
-		if (NameArray[scanner].Hash == hash && stricmp (NameArray[scanner].Text, text) == 0)
+		const NameEntry &entry = Entry (scanner);
+		if (entry.Hash == hash && stricmp (entry.Text, text) == 0)
 		{
 			return scanner;
 		}
-		scanner = NameArray[scanner].NextHash;
+		scanner = entry.NextHash;
 	}
 
 	// If we get here, then the name does not exist.
@@ -149,13 +147,14 @@ int FName::NameManager::FindName (const char *text, size_t textLen, bool noCreat
 	// See if the name already exists.
 	while (scanner >= 0)
 	{
-		if (NameArray[scanner].Hash == hash &&
-			strnicmp (NameArray[scanner].Text, text, textLen) == 0 &&
-			NameArray[scanner].Text[textLen] == '\0')
+		const NameEntry &entry = Entry (scanner);
+		if (entry.Hash == hash &&
+			strnicmp (entry.Text, text, textLen) == 0 &&
+			entry.Text[textLen] == '\0')
 		{
 			return scanner;
 		}
-		scanner = NameArray[scanner].NextHash;
+		scanner = entry.NextHash;
 	}
 
 	// If we get here, then the name does not exist.
@@ -214,19 +213,21 @@ int FName::NameManager::AddName (const char *text, unsigned int hash, unsigned i
 	strcpy (textstore, text);
 	block->NextAlloc += len;
 
-	// Add an entry for the name to the NameArray
-	if (NumNames >= MaxNames)
+	// Add an entry for the name. Chunks are fixed-size and never move, so
+	// existing entries keep their addresses while the table grows and
+	// concurrent lookups never chase a stale pointer.
+	assert (NumNames < MAX_CHUNKS << ENTRY_SHIFT);
+	if (NameChunks[NumNames >> ENTRY_SHIFT] == NULL)
 	{
-		// If no names have been defined yet, make the first allocation
-		// large enough to hold all the predefined names.
-		MaxNames += MaxNames == 0 ? countof(PredefinedNames) + NAME_GROW_AMOUNT : NAME_GROW_AMOUNT;
-
-		NameArray = (NameEntry *)M_Realloc (NameArray, MaxNames * sizeof(NameEntry));
+		NameChunks[NumNames >> ENTRY_SHIFT] = (NameEntry *)M_Malloc (ENTRIES_PER_CHUNK * sizeof(NameEntry));
 	}
 
-	NameArray[NumNames].Text = textstore;
-	NameArray[NumNames].Hash = hash;
-	NameArray[NumNames].NextHash = Buckets[bucket];
+	NameEntry &entry = Entry (NumNames);
+	entry.Text = textstore;
+	entry.Hash = hash;
+	// Fill the entry completely before linking it into its bucket; the
+	// bucket head is what publishes the index to lookups.
+	entry.NextHash = Buckets[bucket];
 	Buckets[bucket] = NumNames;
 
 	return NumNames++;
@@ -278,11 +279,14 @@ FName::NameManager::~NameManager()
 	}
 	Blocks = NULL;
 
-	if (NameArray != NULL)
+	for (size_t i = 0; i < countof(NameChunks); ++i)
 	{
-		M_Free (NameArray);
-		NameArray = NULL;
+		if (NameChunks[i] != NULL)
+		{
+			M_Free (NameChunks[i]);
+			NameChunks[i] = NULL;
+		}
 	}
-	NumNames = MaxNames = 0;
+	NumNames = 0;
 	memset (Buckets, -1, sizeof(Buckets));
 }
@@ -58,8 +58,8 @@ public:
 
 	int GetIndex() const { return Index; }
 	operator int() const { return Index; }
-	const char *GetChars() const { return NameData.NameArray[Index].Text; }
-	operator const char *() const { return NameData.NameArray[Index].Text; }
+	const char *GetChars() const { return NameData.Entry(Index).Text; }
+	operator const char *() const { return NameData.Entry(Index).Text; }
 
 	FName &operator = (const char *text) { Index = NameData.FindName (text, false); return *this; }
 	FName &operator = (const FString &text);
@@ -104,13 +104,23 @@ protected:
 		~NameManager();
 
 		enum { HASH_SIZE = 1024 };
+		// Entries live in fixed-size chunks that are never reallocated, so a
+		// NameEntry keeps its address for the lifetime of the program and
+		// lookups running concurrently with name creation on the main thread
+		// can never observe a relocation. Indices are stable as before.
+		enum { ENTRY_SHIFT = 11, ENTRIES_PER_CHUNK = 1 << ENTRY_SHIFT, MAX_CHUNKS = 2048 };
 		struct NameBlock;
 
 		NameBlock *Blocks;
-		NameEntry *NameArray;
-		int NumNames, MaxNames;
+		NameEntry *NameChunks[MAX_CHUNKS];
+		int NumNames;
 		int Buckets[HASH_SIZE];
 
+		NameEntry &Entry(int index) const
+		{
+			return NameChunks[index >> ENTRY_SHIFT][index & (ENTRIES_PER_CHUNK - 1)];
+		}
+
 		int FindName (const char *text, bool noCreate);
 		int FindName (const char *text, size_t textlen, bool noCreate);
 		int AddName (const char *text, unsigned int hash, unsigned int bucket);
@@ -51,6 +51,7 @@
 #include "m_bbox.h"
 #include "c_console.h"
 #include "r_state.h"
+#include "threadpool.h"
 
 const int MaxSegs = 64;
 const int SplitCost = 8;
@@ -112,8 +113,6 @@ void FNodeBuilder::Clear()
 	SegList.Clear();
 	PlaneChecked.Clear();
 	Planes.Clear();
-	Touched.Clear();
-	Colinear.Clear();
 	SplitSharers.Clear();
 	if (VertexMap == NULL)
 	{
@@ -464,6 +463,10 @@ int FNodeBuilder::SelectSplitter (DWORD set, node_t &node, DWORD &splitseg, int
 
 	D(Printf (PRINT_LOG, "Processing set %d\n", set));
 
+	// Collect one candidate splitter per unique plane first. Scoring the
+	// candidates dominates build time on big maps and is independent work,
+	// so large sets are farmed out to the worker pool.
+	TArray<DWORD> candidates;
 	while (seg != DWORD_MAX)
 	{
 		FPrivSeg *pseg = &Segs[seg];
@@ -481,26 +484,58 @@ int FNodeBuilder::SelectSplitter (DWORD set, node_t &node, DWORD &splitseg, int
 				}
 
 				stepleft = step;
-				SetNodeFromSeg (node, pseg);
+				candidates.Push (seg);
+			}
+		}
 
-				int value = Heuristic (node, set, nosplit);
+		seg = pseg->next;
+	}
 
-				D(Printf (PRINT_LOG, "Seg %5d, ld %d (%5d,%5d)-(%5d,%5d) scores %d\n", seg, Segs[seg].linedef, node.x>>16, node.y>>16,
-					(node.x+node.dx)>>16, (node.y+node.dy)>>16, value));
+	TArray<int> values;
+	values.Resize (candidates.Size());
 
-				if (value > bestvalue)
-				{
-					bestvalue = value;
-					bestseg = seg;
-				}
-				else if (value < 0)
-				{
-					nosplitters = true;
-				}
-			}
+	FThreadPool &pool = FThreadPool::Instance();
+	if (candidates.Size() < 16 || pool.NumThreads() == 1)
+	{
+		for (unsigned int c = 0; c < candidates.Size(); ++c)
+		{
+			SetNodeFromSeg (node, &Segs[candidates[c]]);
+			values[c] = Heuristic (node, set, nosplit);
 		}
+	}
+	else
+	{
+		// Score the first candidate on this thread before going wide: on
+		// 32-bit x86 the first ClassifyLine call backpatches its call site,
+		// and that must not happen concurrently.
+		SetNodeFromSeg (node, &Segs[candidates[0]]);
+		values[0] = Heuristic (node, set, nosplit);
 
-		seg = pseg->next;
+		pool.ParallelFor ((int)candidates.Size() - 1, [&](int c)
+		{
+			node_t eval;
+			SetNodeFromSeg (eval, &Segs[candidates[c + 1]]);
+			values[c + 1] = Heuristic (eval, set, nosplit);
+		});
+	}
+
+	// The reduction stays in candidate order, so the chosen splitter is the
+	// same one the serial loop would have picked.
+	for (unsigned int c = 0; c < candidates.Size(); ++c)
+	{
+		int value = values[c];
+
+		D(Printf (PRINT_LOG, "Seg %5d scores %d\n", candidates[c], value));
+
+		if (value > bestvalue)
+		{
+			bestvalue = value;
+			bestseg = candidates[c];
+		}
+		else if (value < 0)
+		{
+			nosplitters = true;
+		}
 	}
 
 	if (bestseg == DWORD_MAX)
@@ -537,8 +572,10 @@ int FNodeBuilder::Heuristic (node_t &node, DWORD set, bool honorNoSplit)
 	unsigned int max, m2, p, q;
 	double frac;
 
-	Touched.Clear ();
-	Colinear.Clear ();
+	// These must be locals: candidate splitters are scored on worker
+	// threads, so Heuristic has to stay re-entrant.
+	TArray<int> Touched;	// Loops a splitter touches on a vertex
+	TArray<int> Colinear;	// Loops with edges colinear to a splitter
 
 	while (i != DWORD_MAX)
 	{
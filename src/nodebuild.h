@@ -243,8 +243,6 @@ private:
 	TArray<BYTE> PlaneChecked;
 	TArray<FSimpleLine> Planes;
 
-	TArray<int> Touched;	// Loops a splitter touches on a vertex
-	TArray<int> Colinear;	// Loops with edges colinear to a splitter
 	FEventTree Events;		// Vertices intersected by the current splitter
 
 	TArray<FSplitSharer> SplitSharers;	// Segs colinear with the current splitter
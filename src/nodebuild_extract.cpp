@@ -43,6 +43,7 @@
 
 #include "nodebuild.h"
 #include "templates.h"
+#include "p_setup.h"
 
 #if 0
 #define D(x) x
@@ -60,7 +61,7 @@ void FNodeBuilder::Extract (node_t *&outNodes, int &nodeCount,
 	int i;
 
 	vertCount = Vertices.Size ();
-	outVerts = new vertex_t[vertCount];
+	outVerts = AllocMapArray<vertex_t> (vertCount);
 
 	for (i = 0; i < vertCount; ++i)
 	{
@@ -68,11 +69,11 @@ void FNodeBuilder::Extract (node_t *&outNodes, int &nodeCount,
 	}
 
 	subCount = Subsectors.Size();
-	outSubs = new subsector_t[subCount];
+	outSubs = AllocMapArray<subsector_t> (subCount);
 	memset(outSubs, 0, subCount * sizeof(subsector_t));
 
 	nodeCount = Nodes.Size ();
-	outNodes = new node_t[nodeCount];
+	outNodes = AllocMapArray<node_t> (nodeCount);
 
 	memcpy (outNodes, &Nodes[0], nodeCount*sizeof(node_t));
 	for (i = 0; i < nodeCount; ++i)
@@ -115,8 +116,8 @@ void FNodeBuilder::Extract (node_t *&outNodes, int &nodeCount,
 		}
 
 		segCount = segs.Size ();
-		outSegs = new seg_t[segCount];
-		outSegExtras = new glsegextra_t[segCount];
+		outSegs = AllocMapArray<seg_t> (segCount);
+		outSegExtras = AllocMapArray<glsegextra_t> (segCount);
 
 		for (i = 0; i < segCount; ++i)
 		{
@@ -136,7 +137,7 @@ void FNodeBuilder::Extract (node_t *&outNodes, int &nodeCount,
 	{
 		memcpy (outSubs, &Subsectors[0], subCount*sizeof(subsector_t));
 		segCount = Segs.Size ();
-		outSegs = new seg_t[segCount];
+		outSegs = AllocMapArray<seg_t> (segCount);
 		outSegExtras = NULL;
 		for (i = 0; i < segCount; ++i)
 		{
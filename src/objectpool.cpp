@@ -0,0 +1,233 @@
+/*
+** objectpool.cpp
+**
+** lock-free size-class pool allocator for DObject-derived classes
+**
+**---------------------------------------------------------------------------
+** Copyright 2017 GZDoom contributors
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+** Allocations are rounded up to 16 byte size classes. Each class keeps a
+** freelist of recycled blocks; popping and pushing a block is a single
+** compare-and-swap, so actor spawn/destroy churn never touches the C
+** heap once a class is warm. The freelist head is one machine word: the
+** block pointer with a small generation tag packed into its alignment
+** bits. The tag changes with every update to guard the CAS against ABA,
+** and keeping the head pointer-sized means the CAS is natively lock-free
+** everywhere instead of needing double-width atomics. When a
+** freelist runs dry, a batch of fresh blocks is carved from a per-class
+** FMemArena under a mutex; that path is hit once per high-water mark and
+** then never again. Arena memory is only returned to the system at exit.
+*/
+
+#include <assert.h>
+#include <atomic>
+#include <mutex>
+
+#include "objectpool.h"
+#include "doomtype.h"
+#include "m_alloc.h"
+#include "memarena.h"
+
+// Every block is preceded by a 16 byte header whose first word holds the
+// block's size class, so Obj_Free can find the right freelist without
+// being told the size. The full 16 bytes keep the payload as aligned as
+// M_Malloc would.
+enum
+{
+	POOL_GRANULARITY = 16,
+	POOL_MAX_SIZE = 2048,			// larger blocks use M_Malloc
+	NUM_POOL_CLASSES = POOL_MAX_SIZE / POOL_GRANULARITY,
+	POOL_HEADER_SIZE = 16,
+	POOL_REFILL_COUNT = 64,			// blocks carved per arena refill
+};
+
+#define OVERSIZE_CLASS	(~(size_t)0)
+
+struct FFreeNode
+{
+	FFreeNode *Next;
+};
+
+// Blocks are at least 16 byte aligned, so the low four bits of the head
+// pointer are free to hold the ABA generation tag. A four bit tag wraps
+// quickly, but a stale pop must be preempted by exactly a multiple of 16
+// freelist updates between its load and its CAS to slip through, which
+// closes the realistic ABA window while keeping the head one word wide.
+typedef uintptr_t FPoolHead;
+
+enum : uintptr_t
+{
+	POOL_TAG_MASK = POOL_GRANULARITY - 1,
+};
+
+inline FFreeNode *PoolHeadNode (FPoolHead head)
+{
+	return (FFreeNode *)(head & ~POOL_TAG_MASK);
+}
+
+inline FPoolHead MakePoolHead (FFreeNode *node, FPoolHead oldhead)
+{
+	return (uintptr_t)node | ((oldhead + 1) & POOL_TAG_MASK);
+}
+
+struct FSizeClass
+{
+	FSizeClass()
+	{
+		Head.store(0, std::memory_order_relaxed);
+	}
+
+	std::atomic<FPoolHead> Head;
+	std::mutex RefillMutex;
+	FMemArena Arena;
+};
+
+static FSizeClass PoolClasses[NUM_POOL_CLASSES];
+
+//==========================================================================
+//
+// PushBlocks
+//
+// Links a chain of blocks onto a class's freelist.
+//
+//==========================================================================
+
+static void PushBlocks (FSizeClass &cls, FFreeNode *first, FFreeNode *last)
+{
+	FPoolHead head = cls.Head.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		last->Next = PoolHeadNode(head);
+		if (cls.Head.compare_exchange_weak(head, MakePoolHead(first, head),
+			std::memory_order_release, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+}
+
+//==========================================================================
+//
+// RefillClass
+//
+// Carves a batch of blocks from the class's arena and pushes them onto
+// the freelist. Only one thread refills at a time; latecomers find the
+// list populated and return without touching the arena.
+//
+//==========================================================================
+
+static void RefillClass (FSizeClass &cls, size_t blocksize)
+{
+	std::lock_guard<std::mutex> lock(cls.RefillMutex);
+
+	if (PoolHeadNode(cls.Head.load(std::memory_order_acquire)) != NULL)
+	{
+		return;
+	}
+
+	// The arena only promises pointer alignment, so round the batch up to
+	// the pool granularity; block addresses must have their low four bits
+	// clear for the freelist head's tag packing.
+	BYTE *mem = (BYTE *)cls.Arena.Alloc(blocksize * POOL_REFILL_COUNT + POOL_GRANULARITY - 1);
+	mem = (BYTE *)(((uintptr_t)mem + POOL_GRANULARITY - 1) & ~POOL_TAG_MASK);
+	for (int i = 0; i < POOL_REFILL_COUNT - 1; ++i)
+	{
+		((FFreeNode *)(mem + i * blocksize))->Next = (FFreeNode *)(mem + (i + 1) * blocksize);
+	}
+	PushBlocks(cls, (FFreeNode *)mem, (FFreeNode *)(mem + (POOL_REFILL_COUNT - 1) * blocksize));
+}
+
+//==========================================================================
+//
+// Obj_Malloc
+//
+//==========================================================================
+
+void *Obj_Malloc (size_t size)
+{
+	size_t need = size + POOL_HEADER_SIZE;
+
+	if (need > POOL_MAX_SIZE)
+	{
+		BYTE *mem = (BYTE *)M_Malloc(need);
+		((size_t *)mem)[0] = OVERSIZE_CLASS;
+		return mem + POOL_HEADER_SIZE;
+	}
+
+	size_t index = (need + POOL_GRANULARITY - 1) / POOL_GRANULARITY - 1;
+	FSizeClass &cls = PoolClasses[index];
+
+	FPoolHead head = cls.Head.load(std::memory_order_acquire);
+	for (;;)
+	{
+		FFreeNode *node = PoolHeadNode(head);
+		if (node == NULL)
+		{
+			RefillClass(cls, (index + 1) * POOL_GRANULARITY);
+			head = cls.Head.load(std::memory_order_acquire);
+			continue;
+		}
+		// node may have been handed out and scribbled on by another
+		// thread between the load and the CAS; the stale Next read below
+		// is then discarded because the tag makes the CAS fail.
+		if (cls.Head.compare_exchange_weak(head, MakePoolHead(node->Next, head),
+			std::memory_order_acquire, std::memory_order_acquire))
+		{
+			BYTE *mem = (BYTE *)node;
+			((size_t *)mem)[0] = index;
+			return mem + POOL_HEADER_SIZE;
+		}
+	}
+}
+
+//==========================================================================
+//
+// Obj_Free
+//
+//==========================================================================
+
+void Obj_Free (void *block)
+{
+	if (block == NULL)
+	{
+		return;
+	}
+
+	BYTE *mem = (BYTE *)block - POOL_HEADER_SIZE;
+	size_t index = ((size_t *)mem)[0];
+
+	if (index == OVERSIZE_CLASS)
+	{
+		M_Free(mem);
+		return;
+	}
+
+	assert(index < NUM_POOL_CLASSES);
+	FFreeNode *node = (FFreeNode *)mem;
+	PushBlocks(PoolClasses[index], node, node);
+}
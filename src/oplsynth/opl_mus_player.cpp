@@ -18,6 +18,9 @@
 
 EXTERN_CVAR (Int, opl_numchips)
 
+// Render dual-chip music with a helper thread, one chip per thread.
+CVAR (Bool, opl_parallel, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
+
 OPLmusicBlock::OPLmusicBlock()
 {
 	scoredata = NULL;
@@ -32,9 +35,90 @@ OPLmusicBlock::OPLmusicBlock()
 
 OPLmusicBlock::~OPLmusicBlock()
 {
+	if (ChipThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(ChipMutex);
+			ChipThreadExit = true;
+		}
+		ChipWake.notify_one();
+		ChipThread.join();
+	}
 	delete io;
 }
 
+//==========================================================================
+//
+// Renders one block on every chip. With exactly two chips and
+// opl_parallel enabled, the second chip runs on a helper thread into a
+// scratch buffer which is then added onto the output; since each chip
+// contributes exactly one addition per sample either way, the result is
+// bit-identical to the serial loop. Only called with ChipAccess held.
+//
+//==========================================================================
+
+void OPLmusicBlock::UpdateChips(float *buff, int numsamples, int stereoshift)
+{
+	size_t i;
+
+	if (io->NumChips == 2 && opl_parallel)
+	{
+		unsigned int count = numsamples << stereoshift;
+
+		if (!ChipThread.joinable())
+		{
+			ChipThread = std::thread(&OPLmusicBlock::ChipThreadMain, this);
+		}
+		ChipScratch.Resize(count);
+		memset(&ChipScratch[0], 0, count * sizeof(float));
+		{
+			std::lock_guard<std::mutex> lock(ChipMutex);
+			ChipJobBuffer = &ChipScratch[0];
+			ChipJobSamples = numsamples;
+			ChipJobPending = true;
+		}
+		ChipWake.notify_one();
+
+		io->chips[0]->Update(buff, numsamples);
+
+		{
+			std::unique_lock<std::mutex> lock(ChipMutex);
+			ChipDone.wait(lock, [this]() { return !ChipJobPending; });
+		}
+		for (unsigned int j = 0; j < count; ++j)
+		{
+			buff[j] += ChipScratch[j];
+		}
+	}
+	else
+	{
+		for (i = 0; i < io->NumChips; ++i)
+		{
+			io->chips[i]->Update(buff, numsamples);
+		}
+	}
+}
+
+void OPLmusicBlock::ChipThreadMain()
+{
+	std::unique_lock<std::mutex> lock(ChipMutex);
+	for (;;)
+	{
+		ChipWake.wait(lock, [this]() { return ChipJobPending || ChipThreadExit; });
+		if (ChipThreadExit)
+		{
+			return;
+		}
+		float *buffer = ChipJobBuffer;
+		int samples = ChipJobSamples;
+		lock.unlock();
+		io->chips[1]->Update(buffer, samples);
+		lock.lock();
+		ChipJobPending = false;
+		ChipDone.notify_one();
+	}
+}
+
 void OPLmusicBlock::ResetChips ()
 {
 	ChipAccess.Enter();
@@ -232,14 +316,10 @@ bool OPLmusicBlock::ServiceStream (void *buff, int numbytes)
 		double ticky = NextTickIn;
 		int tick_in = int(NextTickIn);
 		int samplesleft = MIN(numsamples, tick_in);
-		size_t i;
 
 		if (samplesleft > 0)
 		{
-			for (i = 0; i < io->NumChips; ++i)
-			{
-				io->chips[i]->Update(samples1, samplesleft);
-			}
+			UpdateChips(samples1, samplesleft, stereoshift);
 			OffsetSamples(samples1, samplesleft << stereoshift);
 			assert(NextTickIn == ticky);
 			NextTickIn -= samplesleft;
@@ -258,10 +338,7 @@ bool OPLmusicBlock::ServiceStream (void *buff, int numbytes)
 				{
 					if (numsamples > 0)
 					{
-						for (i = 0; i < io->NumChips; ++i)
-						{
-							io->chips[i]->Update(samples1, numsamples);
-						}
+						UpdateChips(samples1, numsamples, stereoshift);
 						OffsetSamples(samples1, numsamples << stereoshift);
 					}
 					res = false;
@@ -1,5 +1,9 @@
 #include "critsec.h"
 #include "muslib.h"
+#include "tarray.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 class OPLmusicBlock : public musicBlock
 {
@@ -15,6 +19,7 @@ public:
 protected:
 	virtual int PlayTick() = 0;
 	void OffsetSamples(float *buff, int count);
+	void UpdateChips(float *buff, int numsamples, int stereoshift);
 
 	double NextTickIn;
 	double SamplesPerTick;
@@ -24,6 +29,22 @@ protected:
 	bool FullPan;
 
 	FCriticalSection ChipAccess;
+
+private:
+	void ChipThreadMain();
+
+	// Helper thread that renders the second chip while the stream thread
+	// renders the first. Started on demand, only ever used while
+	// ChipAccess is held by the caller.
+	std::thread ChipThread;
+	std::mutex ChipMutex;
+	std::condition_variable ChipWake;
+	std::condition_variable ChipDone;
+	TArray<float> ChipScratch;
+	float *ChipJobBuffer = nullptr;
+	int ChipJobSamples = 0;
+	bool ChipJobPending = false;
+	bool ChipThreadExit = false;
 };
 
 class OPLmusicFile : public OPLmusicBlock
@@ -345,8 +345,8 @@ ACSStringPool GlobalACSStrings;
 
 ACSStringPool::ACSStringPool()
 {
-	memset(PoolBuckets, 0xFF, sizeof(PoolBuckets));
-	FirstFreeEntry = 0;
+	Rehash(MIN_BUCKETS);
+	FirstFreeEntry = NO_ENTRY;
 }
 
 //============================================================================
@@ -360,8 +360,8 @@ ACSStringPool::ACSStringPool()
 void ACSStringPool::Clear()
 {
 	Pool.Clear();
-	memset(PoolBuckets, 0xFF, sizeof(PoolBuckets));
-	FirstFreeEntry = 0;
+	Rehash(MIN_BUCKETS);
+	FirstFreeEntry = NO_ENTRY;
 }
 
 //============================================================================
@@ -378,7 +378,7 @@ int ACSStringPool::AddString(const char *str)
 	if (str == nullptr) str = "";
 	size_t len = strlen(str);
 	unsigned int h = SuperFastHash(str, len);
-	unsigned int bucketnum = h % NUM_BUCKETS;
+	unsigned int bucketnum = h % NumBuckets;
 	int i = FindString(str, len, h, bucketnum);
 	if (i >= 0)
 	{
@@ -391,7 +391,7 @@ int ACSStringPool::AddString(const char *str)
 int ACSStringPool::AddString(FString &str)
 {
 	unsigned int h = SuperFastHash(str.GetChars(), str.Len());
-	unsigned int bucketnum = h % NUM_BUCKETS;
+	unsigned int bucketnum = h % NumBuckets;
 	int i = FindString(str, str.Len(), h, bucketnum);
 	if (i >= 0)
 	{
@@ -599,36 +599,30 @@ void ACSStringPool::UnlockAll()
 void ACSStringPool::PurgeStrings()
 {
 	// Clear the hash buckets. We'll rebuild them as we decide what strings
-	// to keep and which to toss.
-	memset(PoolBuckets, 0xFF, sizeof(PoolBuckets));
-	size_t usedcount = 0, freedcount = 0;
-	for (unsigned int i = 0; i < Pool.Size(); ++i)
+	// to keep and which to toss. The free list is also rebuilt from scratch;
+	// iterating backwards leaves it ordered lowest index first.
+	memset(&PoolBuckets[0], 0xFF, NumBuckets * sizeof(unsigned int));
+	FirstFreeEntry = NO_ENTRY;
+	for (unsigned int i = Pool.Size(); i-- > 0; )
 	{
 		PoolEntry *entry = &Pool[i];
-		if (entry->Next != FREE_ENTRY)
+		if (entry->Next == FREE_ENTRY || entry->LockCount == 0)
 		{
-			if (entry->LockCount == 0)
-			{
-				freedcount++;
-				// Mark this entry as free.
-				entry->Next = FREE_ENTRY;
-				if (i < FirstFreeEntry)
-				{
-					FirstFreeEntry = i;
-				}
-				// And free the string.
-				entry->Str = "";
-			}
-			else
-			{
-				usedcount++;
-				// Rehash this entry.
-				unsigned int h = entry->Hash % NUM_BUCKETS;
-				entry->Next = PoolBuckets[h];
-				PoolBuckets[h] = i;
-				// Remove MarkString's mark.
-				entry->LockCount &= 0x7FFFFFFF;
-			}
+			// Mark this entry as free and chain it into the free list.
+			// The Hash field does double duty as the free list link.
+			entry->Next = FREE_ENTRY;
+			entry->Str = "";
+			entry->Hash = FirstFreeEntry;
+			FirstFreeEntry = i;
+		}
+		else
+		{
+			// Rehash this entry.
+			unsigned int h = entry->Hash % NumBuckets;
+			entry->Next = PoolBuckets[h];
+			PoolBuckets[h] = i;
+			// Remove MarkString's mark.
+			entry->LockCount &= 0x7FFFFFFF;
 		}
 	}
 }
@@ -670,23 +664,29 @@ int ACSStringPool::FindString(const char *str, size_t len, unsigned int h, unsig
 int ACSStringPool::InsertString(FString &str, unsigned int h, unsigned int bucketnum)
 {
 	unsigned int index = FirstFreeEntry;
-	if (index >= MIN_GC_SIZE && index == Pool.Max())
+	if (index == NO_ENTRY && Pool.Size() >= MIN_GC_SIZE && Pool.Size() == Pool.Max())
 	{ // We will need to grow the array. Try a garbage collection first.
 		P_CollectACSGlobalStrings();
 		index = FirstFreeEntry;
 	}
-	if (FirstFreeEntry >= STRPOOL_LIBRARYID_OR)
-	{ // If we go any higher, we'll collide with the library ID marker.
-		return -1;
-	}
-	if (index == Pool.Size())
+	if (index == NO_ENTRY)
 	{ // There were no free entries; make a new one.
+		if (Pool.Size() >= STRPOOL_LIBRARYID_OR)
+		{ // If we go any higher, we'll collide with the library ID marker.
+			return -1;
+		}
+		if (Pool.Size() >= NumBuckets * 2)
+		{ // Grow the bucket table along with the pool so lookup chains
+		  // stay short no matter how many strings a mod creates.
+			Rehash(NumBuckets * 4 + 1);
+			bucketnum = h % NumBuckets;
+		}
+		index = Pool.Size();
 		Pool.Reserve(1);
-		FirstFreeEntry++;
 	}
 	else
-	{ // Scan for the next free entry
-		FindFirstFreeEntry(FirstFreeEntry + 1);
+	{ // Pop the head of the free list.
+		FirstFreeEntry = Pool[index].Hash;
 	}
 	PoolEntry *entry = &Pool[index];
 	entry->Str = str;
@@ -699,19 +699,26 @@ int ACSStringPool::InsertString(FString &str, unsigned int h, unsigned int bucke
 
 //============================================================================
 //
-// ACSStringPool :: FindFirstFreeEntry
+// ACSStringPool :: Rehash
 //
-// Finds the first free entry, starting at base.
+// Resizes the bucket table and relinks every live entry into it.
 //
 //============================================================================
 
-void ACSStringPool::FindFirstFreeEntry(unsigned base)
+void ACSStringPool::Rehash(unsigned int newbuckets)
 {
-	while (base < Pool.Size() && Pool[base].Next != FREE_ENTRY)
+	NumBuckets = newbuckets;
+	PoolBuckets.Resize(newbuckets);
+	memset(&PoolBuckets[0], 0xFF, newbuckets * sizeof(unsigned int));
+	for (unsigned int i = 0; i < Pool.Size(); ++i)
 	{
-		base++;
+		if (Pool[i].Next != FREE_ENTRY)
+		{
+			unsigned int h = Pool[i].Hash % NumBuckets;
+			Pool[i].Next = PoolBuckets[h];
+			PoolBuckets[h] = i;
+		}
 	}
-	FirstFreeEntry = base;
 }
 
 //============================================================================
@@ -737,6 +744,10 @@ void ACSStringPool::ReadStrings(FSerializer &file, const char *key)
 			p.Next = FREE_ENTRY;
 			p.LockCount = 0;
 		}
+		if ((unsigned)poolsize >= NumBuckets * 2)
+		{
+			Rehash((unsigned)poolsize * 2 + 1);
+		}
 		if (file.BeginArray("pool"))
 		{
 			int j = file.ArraySize();
@@ -752,7 +763,7 @@ void ACSStringPool::ReadStrings(FSerializer &file, const char *key)
 							("lockcount", Pool[ii].LockCount);
 
 						unsigned h = SuperFastHash(Pool[ii].Str, Pool[ii].Str.Len());
-						unsigned bucketnum = h % NUM_BUCKETS;
+						unsigned bucketnum = h % NumBuckets;
 						Pool[ii].Hash = h;
 						Pool[ii].Next = PoolBuckets[bucketnum];
 						PoolBuckets[bucketnum] = ii;
@@ -761,6 +772,17 @@ void ACSStringPool::ReadStrings(FSerializer &file, const char *key)
 				}
 			}
 		}
+		// Rebuild the free list from whatever entries did not load,
+		// lowest index first.
+		FirstFreeEntry = NO_ENTRY;
+		for (unsigned int i = Pool.Size(); i-- > 0; )
+		{
+			if (Pool[i].Next == FREE_ENTRY)
+			{
+				Pool[i].Hash = FirstFreeEntry;
+				FirstFreeEntry = i;
+			}
+		}
 	}
 }
 
@@ -1093,6 +1115,13 @@ void P_ReadACSVars(FSerializer &arc)
 //
 //============================================================================
 
+// This only runs for full savegames (hub snapshots do not contain the
+// global ACS state), and the output is already proportional to the used
+// state, not the declared one: the world/global arrays are sparse maps
+// that store only their used keys, and the scalar blocks are trimmed to
+// the last non-zero entry. Writing deltas against a previous save was
+// considered and rejected because every savegame has to be loadable on
+// its own - a journal would tie saves to each other.
 void P_WriteACSVars(FSerializer &arc)
 {
 	WriteVars (arc, ACS_WorldVars, NUM_WORLDVARS, "acsworldvars");
@@ -3042,6 +3071,8 @@ void DLevelScript::Serialize(FSerializer &arc)
 DLevelScript::DLevelScript ()
 {
 	next = prev = NULL;
+	cachedtid = 0;
+	cachedactor = NULL;
 	if (DACSThinker::ActiveThinker == NULL)
 		new DACSThinker;
 	activefont = SmallFont;
@@ -3604,6 +3635,37 @@ AActor *SingleActorFromTID (int tid, AActor *defactor)
 	}
 }
 
+//============================================================================
+//
+// DLevelScript :: ActorFromTID
+//
+// Same as SingleActorFromTID, with a one entry memo in front of the hash
+// walk. Scripts commonly query several properties of the same TID in a
+// row, and this makes all but the first resolution free. The memo is reset
+// on entering RunScript and only trusted while it is running: an actor
+// destroyed mid-script has not been swept yet, so checking its flags and
+// TID is safe there. With several actors sharing a TID the result is an
+// arbitrary one of them, just as it always has been.
+//
+//============================================================================
+
+AActor *DLevelScript::ActorFromTID (int tid, AActor *defactor)
+{
+	if (tid == 0)
+	{
+		return defactor;
+	}
+	if (cachedactor != NULL && cachedtid == tid &&
+		!(cachedactor->ObjectFlags & OF_EuthanizeMe) && cachedactor->tid == tid)
+	{
+		return cachedactor;
+	}
+	FActorIterator iterator (tid);
+	cachedactor = iterator.Next ();
+	cachedtid = tid;
+	return cachedactor;
+}
+
 enum
 {
 	APROP_Health		= 0,
@@ -3848,7 +3910,7 @@ void DLevelScript::DoSetActorProperty (AActor *actor, int property, int value)
 
 	case APROP_MasterTID:
 		AActor *other;
-		other = SingleActorFromTID (value, NULL);
+		other = ActorFromTID (value, NULL);
 		DoSetMaster (actor, other);
 		break;
 
@@ -3924,7 +3986,7 @@ void DLevelScript::DoSetActorProperty (AActor *actor, int property, int value)
 
 int DLevelScript::GetActorProperty (int tid, int property)
 {
-	AActor *actor = SingleActorFromTID (tid, activator);
+	AActor *actor = ActorFromTID (tid, activator);
 
 	if (actor == NULL)
 	{
@@ -4028,7 +4090,7 @@ int DLevelScript::GetActorProperty (int tid, int property)
 
 int DLevelScript::CheckActorProperty (int tid, int property, int value)
 {
-	AActor *actor = SingleActorFromTID (tid, activator);
+	AActor *actor = ActorFromTID (tid, activator);
 	const char *string = NULL;
 	if (actor == NULL)
 	{
@@ -4793,21 +4855,21 @@ int DLevelScript::CallFunction(int argCount, int funcIndex, SDWORD *args)
 			return DoubleToACS(GetUDMFFloat(UDMF_Side, SideFromID(args[0], args[1]), FBehavior::StaticLookupString(args[2])));
 
 		case ACSF_GetActorVelX:
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			return actor != NULL? DoubleToACS(actor->Vel.X) : 0;
 
 		case ACSF_GetActorVelY:
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			return actor != NULL? DoubleToACS(actor->Vel.Y) : 0;
 
 		case ACSF_GetActorVelZ:
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			return actor != NULL? DoubleToACS(actor->Vel.Z) : 0;
 
 		case ACSF_SetPointer:
 			if (activator)
 			{
-				AActor *ptr = SingleActorFromTID(args[1], activator);
+				AActor *ptr = ActorFromTID(args[1], activator);
 				if (argCount > 2)
 				{
 					ptr = COPY_AAPTR(ptr, args[2]);
@@ -4821,17 +4883,17 @@ int DLevelScript::CallFunction(int argCount, int funcIndex, SDWORD *args)
 		case ACSF_SetActivator:
 			if (argCount > 1 && args[1] != AAPTR_DEFAULT) // condition (x != AAPTR_DEFAULT) is essentially condition (x).
 			{
-				activator = COPY_AAPTR(SingleActorFromTID(args[0], activator), args[1]);
+				activator = COPY_AAPTR(ActorFromTID(args[0], activator), args[1]);
 			}
 			else
 			{
-				activator = SingleActorFromTID(args[0], NULL);
+				activator = ActorFromTID(args[0], NULL);
 			}
 			return activator != NULL;
 		
 		case ACSF_SetActivatorToTarget:
 			// [KS] I revised this a little bit
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			if (actor != NULL)
 			{
 				if (actor->player != NULL && actor->player->playerstate == PST_LIVE)
@@ -4853,7 +4915,7 @@ int DLevelScript::CallFunction(int argCount, int funcIndex, SDWORD *args)
 			return 0;
 
 		case ACSF_GetActorViewHeight:
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			if (actor != NULL)
 			{
 				if (actor->player != NULL)
@@ -5023,7 +5085,7 @@ int DLevelScript::CallFunction(int argCount, int funcIndex, SDWORD *args)
 			FName varname(FBehavior::StaticLookupString(args[1]), true);
 			if (varname != NAME_None)
 			{
-				AActor *a = SingleActorFromTID(args[0], activator); 
+				AActor *a = ActorFromTID(args[0], activator); 
 				return a != NULL ? GetUserVariable(a, varname, 0) : 0;
 			}
 			return 0;
@@ -5062,7 +5124,7 @@ int DLevelScript::CallFunction(int argCount, int funcIndex, SDWORD *args)
 			FName varname(FBehavior::StaticLookupString(args[1]), true);
 			if (varname != NAME_None)
 			{
-				AActor *a = SingleActorFromTID(args[0], activator); 
+				AActor *a = ActorFromTID(args[0], activator); 
 				return a != NULL ? GetUserVariable(a, varname, args[2]) : 0;
 			}
 			return 0;
@@ -5074,13 +5136,13 @@ int DLevelScript::CallFunction(int argCount, int funcIndex, SDWORD *args)
 
 		case ACSF_CheckActorClass:
 		{
-			AActor *a = SingleActorFromTID(args[0], activator);
+			AActor *a = ActorFromTID(args[0], activator);
 			return a == NULL ? false : a->GetClass()->TypeName == FName(FBehavior::StaticLookupString(args[1]));
 		}
 
 		case ACSF_GetActorClass:
 		{
-			AActor *a = SingleActorFromTID(args[0], activator);
+			AActor *a = ActorFromTID(args[0], activator);
 			return GlobalACSStrings.AddString(a == NULL ? "None" : a->GetClass()->TypeName.GetChars());
 		}
 
@@ -5639,7 +5701,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 
 		case ACSF_CheckFlag:
 		{
-			AActor *actor = SingleActorFromTID(args[0], activator);
+			AActor *actor = ActorFromTID(args[0], activator);
 			if (actor != NULL)
 			{
 				return !!CheckActorFlag(actor, FBehavior::StaticLookupString(args[1]));
@@ -5690,7 +5752,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 					return 0;
 				}
 
-				AActor *actor = SingleActorFromTID(args[0], activator);
+				AActor *actor = ActorFromTID(args[0], activator);
 				if (actor != NULL)
 				{
 					APowerup* powerup = (APowerup*)actor->FindInventory(powerupclass);
@@ -5729,7 +5791,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 		case ACSF_PickActor:
 			if (argCount >= 5)
 			{
-				actor = SingleActorFromTID(args[0], activator);
+				actor = ActorFromTID(args[0], activator);
 				if (actor == NULL)
 				{
 					return 0;
@@ -5782,8 +5844,8 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 				case 3: tid1 = args[2];
 				}
 
-				actor = SingleActorFromTID(tid1, activator);
-				AActor * actor2 = tid2 == tid1 ? actor : SingleActorFromTID(tid2, activator);
+				actor = ActorFromTID(tid1, activator);
+				AActor * actor2 = tid2 == tid1 ? actor : ActorFromTID(tid2, activator);
 
 				return COPY_AAPTR(actor, args[0]) == COPY_AAPTR(actor2, args[1]);
 			}
@@ -5792,7 +5854,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 		case ACSF_CanRaiseActor:
 			if (argCount >= 1) {
 				if (args[0] == 0) {
-					actor = SingleActorFromTID(args[0], activator);
+					actor = ActorFromTID(args[0], activator);
 					if (actor != NULL) {
 						return P_Thing_CanRaise(actor);
 					}
@@ -5822,7 +5884,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 			break;
 
 		case ACSF_GetActorRoll:
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			return actor != NULL? AngleToACS(actor->Angles.Roll) : 0;
 		
 		// [ZK] A_Warp in ACS
@@ -5838,7 +5900,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 			
 			AActor* const reference = ((flags & WARPF_USEPTR) && (AAPTR_DEFAULT != dest))
 				? COPY_AAPTR(activator, dest)
-				: SingleActorFromTID(dest, activator);
+				: ActorFromTID(dest, activator);
 
 			if (nullptr == reference)
 			{
@@ -5878,7 +5940,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 			return true;
 		}
 		case ACSF_GetMaxInventory:
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			if (actor != NULL)
 			{
 				return CheckInventory(actor, FBehavior::StaticLookupString(args[1]), true);
@@ -5957,7 +6019,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 		case ACSF_CheckProximity:
 		{
 			// [zombie] ACS version of A_CheckProximity
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			PClass *classname = PClass::FindClass(FBehavior::StaticLookupString(args[1]));
 			double distance = ACSToDouble(args[2]);
 			int count = argCount >= 4 ? args[3] : 1;
@@ -5968,7 +6030,7 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 
 		case ACSF_CheckActorState:
 		{
-			actor = SingleActorFromTID(args[0], activator);
+			actor = ActorFromTID(args[0], activator);
 			const char *statename = FBehavior::StaticLookupString(args[1]);
 			bool exact = (argCount > 2) ? !!args[2] : false;
 			if (actor && statename)
@@ -5987,8 +6049,8 @@ doplaysound:			if (funcIndex == ACSF_PlayActorSound)
 		case ACSF_DamageActor: // [arookas] wrapper around P_DamageMobj
 		{
 			// (target, ptr_select1, inflictor, ptr_select2, amount, damagetype)
-			AActor* target = COPY_AAPTR(SingleActorFromTID(args[0], activator), args[1]);
-			AActor* inflictor = COPY_AAPTR(SingleActorFromTID(args[2], activator), args[3]);
+			AActor* target = COPY_AAPTR(ActorFromTID(args[0], activator), args[1]);
+			AActor* inflictor = COPY_AAPTR(ActorFromTID(args[2], activator), args[3]);
 			FName damagetype(FBehavior::StaticLookupString(args[5]));
 			return P_DamageMobj(target, inflictor, inflictor, args[4], damagetype);
 		}
@@ -6113,6 +6175,10 @@ int DLevelScript::RunScript ()
 	FRemapTable *translation = 0;
 	int resultValue = 1;
 
+	// The TID memo of ActorFromTID must not carry over from a previous
+	// invocation; the actor it points to may have been swept in between.
+	cachedactor = NULL;
+
 	if (InModuleScriptNumber >= 0)
 	{
 		ScriptPtr *ptr = activeBehavior->GetScriptPtr(InModuleScriptNumber);
@@ -6215,6 +6281,178 @@ int DLevelScript::RunScript ()
 			pcd = NEXTWORD;
 		}
 
+		// Fast dispatch loop for the stack, arithmetic, comparison and
+		// branch opcodes that dominate scripted mods. These run entirely
+		// inside this small, densely packed switch and never touch the big
+		// dispatcher below; its first miss drops out with pcd already
+		// decoded. The bodies must stay exact copies of their counterparts
+		// in the main switch.
+		for (;;)
+		{
+			switch (pcd)
+			{
+			case PCD_PUSHNUMBER:
+				PushToStack (uallong(pc[0]));
+				pc++;
+				break;
+
+			case PCD_PUSHBYTE:
+				PushToStack (*(BYTE *)pc);
+				pc = (int *)((BYTE *)pc + 1);
+				break;
+
+			case PCD_PUSHSCRIPTVAR:
+				PushToStack (locals[NEXTBYTE]);
+				break;
+
+			case PCD_ASSIGNSCRIPTVAR:
+				locals[NEXTBYTE] = STACK(1);
+				sp--;
+				break;
+
+			case PCD_DUP:
+				Stack[sp] = Stack[sp-1];
+				sp++;
+				break;
+
+			case PCD_DROP:
+				sp--;
+				break;
+
+			case PCD_ADD:
+				STACK(2) = STACK(2) + STACK(1);
+				sp--;
+				break;
+
+			case PCD_SUBTRACT:
+				STACK(2) = STACK(2) - STACK(1);
+				sp--;
+				break;
+
+			case PCD_MULTIPLY:
+				STACK(2) = STACK(2) * STACK(1);
+				sp--;
+				break;
+
+			case PCD_EQ:
+				STACK(2) = (STACK(2) == STACK(1));
+				sp--;
+				break;
+
+			case PCD_NE:
+				STACK(2) = (STACK(2) != STACK(1));
+				sp--;
+				break;
+
+			case PCD_LT:
+				STACK(2) = (STACK(2) < STACK(1));
+				sp--;
+				break;
+
+			case PCD_GT:
+				STACK(2) = (STACK(2) > STACK(1));
+				sp--;
+				break;
+
+			case PCD_LE:
+				STACK(2) = (STACK(2) <= STACK(1));
+				sp--;
+				break;
+
+			case PCD_GE:
+				STACK(2) = (STACK(2) >= STACK(1));
+				sp--;
+				break;
+
+			case PCD_ANDLOGICAL:
+				STACK(2) = (STACK(2) && STACK(1));
+				sp--;
+				break;
+
+			case PCD_ORLOGICAL:
+				STACK(2) = (STACK(2) || STACK(1));
+				sp--;
+				break;
+
+			case PCD_ANDBITWISE:
+				STACK(2) = (STACK(2) & STACK(1));
+				sp--;
+				break;
+
+			case PCD_ORBITWISE:
+				STACK(2) = (STACK(2) | STACK(1));
+				sp--;
+				break;
+
+			case PCD_EORBITWISE:
+				STACK(2) = (STACK(2) ^ STACK(1));
+				sp--;
+				break;
+
+			case PCD_LSHIFT:
+				STACK(2) = (STACK(2) << STACK(1));
+				sp--;
+				break;
+
+			case PCD_RSHIFT:
+				STACK(2) = (STACK(2) >> STACK(1));
+				sp--;
+				break;
+
+			case PCD_NEGATELOGICAL:
+				STACK(1) = !STACK(1);
+				break;
+
+			case PCD_UNARYMINUS:
+				STACK(1) = -STACK(1);
+				break;
+
+			case PCD_GOTO:
+				pc = activeBehavior->Ofs2PC (LittleLong(*pc));
+				break;
+
+			case PCD_IFGOTO:
+				if (STACK(1))
+					pc = activeBehavior->Ofs2PC (LittleLong(*pc));
+				else
+					pc++;
+				sp--;
+				break;
+
+			case PCD_IFNOTGOTO:
+				if (!STACK(1))
+					pc = activeBehavior->Ofs2PC (LittleLong(*pc));
+				else
+					pc++;
+				sp--;
+				break;
+
+			default:
+				goto dispatch;
+			}
+
+			if (++runaway > 2000000)
+			{
+				Printf ("Runaway %s terminated\n", ScriptPresentation(script).GetChars());
+				state = SCRIPT_PleaseRemove;
+				pcd = PCD_NOP;	// let the main dispatcher fall out of the loop
+				goto dispatch;
+			}
+
+			if (fmt == ACS_LittleEnhanced)
+			{
+				pcd = getbyte(pc);
+				if (pcd >= 256-16)
+				{
+					pcd = (256-16) + ((pcd - (256-16)) << 8) + getbyte(pc);
+				}
+			}
+			else
+			{
+				pcd = NEXTWORD;
+			}
+		}
+dispatch:
 		switch (pcd)
 		{
 		default:
@@ -8505,7 +8743,7 @@ scriptwait:
 			break;
 
 		case PCD_CHECKACTORINVENTORY:
-			STACK(2) = CheckInventory (SingleActorFromTID(STACK(2), NULL),
+			STACK(2) = CheckInventory (ActorFromTID(STACK(2), NULL),
 										FBehavior::StaticLookupString (STACK(1)), false);
 			sp--;
 			break;
@@ -8671,7 +8909,7 @@ scriptwait:
 		case PCD_SETACTORPOSITION:
 			{
 				bool result = false;
-				AActor *actor = SingleActorFromTID (STACK(5), activator);
+				AActor *actor = ActorFromTID (STACK(5), activator);
 				if (actor != NULL)
 					result = P_MoveThing(actor, DVector3(ACSToDouble(STACK(4)), ACSToDouble(STACK(3)), ACSToDouble(STACK(2))), !!STACK(1));
 				sp -= 4;
@@ -8683,7 +8921,7 @@ scriptwait:
 		case PCD_GETACTORY:
 		case PCD_GETACTORZ:
 			{
-				AActor *actor = SingleActorFromTID(STACK(1), activator);
+				AActor *actor = ActorFromTID(STACK(1), activator);
 				if (actor == NULL)
 				{
 					STACK(1) = 0;
@@ -8701,28 +8939,28 @@ scriptwait:
 
 		case PCD_GETACTORFLOORZ:
 			{
-				AActor *actor = SingleActorFromTID(STACK(1), activator);
+				AActor *actor = ActorFromTID(STACK(1), activator);
 				STACK(1) = actor == NULL ? 0 : DoubleToACS(actor->floorz);
 			}
 			break;
 
 		case PCD_GETACTORCEILINGZ:
 			{
-				AActor *actor = SingleActorFromTID(STACK(1), activator);
+				AActor *actor = ActorFromTID(STACK(1), activator);
 				STACK(1) = actor == NULL ? 0 : DoubleToACS(actor->ceilingz);
 			}
 			break;
 
 		case PCD_GETACTORANGLE:
 			{
-				AActor *actor = SingleActorFromTID(STACK(1), activator);
+				AActor *actor = ActorFromTID(STACK(1), activator);
 				STACK(1) = actor == NULL ? 0 : AngleToACS(actor->Angles.Yaw);
 			}
 			break;
 
 		case PCD_GETACTORPITCH:
 			{
-				AActor *actor = SingleActorFromTID(STACK(1), activator);
+				AActor *actor = ActorFromTID(STACK(1), activator);
 				STACK(1) = actor == NULL ? 0 : PitchToACS(actor->Angles.Pitch);
 			}
 			break;
@@ -9301,7 +9539,7 @@ scriptwait:
 
 		case PCD_GETACTORLIGHTLEVEL:
 		{
-			AActor *actor = SingleActorFromTID(STACK(1), activator);
+			AActor *actor = ActorFromTID(STACK(1), activator);
 			if (actor != NULL)
 			{
 				sector_t *sector = actor->Sector;
@@ -9651,6 +9889,8 @@ DLevelScript::DLevelScript (AActor *who, line_t *where, int num, const ScriptPtr
 	pc = module->GetScriptAddress(code);
 	InModuleScriptNumber = module->GetScriptIndex(code);
 	activator = who;
+	cachedtid = 0;
+	cachedactor = NULL;
 	activationline = where;
 	backSide = flags & ACS_BACKSIDE;
 	activefont = SmallFont;
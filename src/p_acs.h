@@ -60,7 +60,119 @@ struct InitIntToZero
 		v = 0;
 	}
 };
-typedef TMap<SDWORD, SDWORD, THashTraits<SDWORD>, InitIntToZero> FWorldGlobalArray;
+typedef TMap<SDWORD, SDWORD, THashTraits<SDWORD>, InitIntToZero> FACSSparseArray;
+
+// World and global ACS arrays take arbitrary 32 bit indices, so they cannot
+// simply be flat arrays. Most scripts use them as plain arrays though,
+// filling small non-negative indices, and paying a hash lookup on every
+// element access for those is wasteful. The contiguous run of elements
+// starting at index 0 is therefore kept in flat storage with direct
+// indexing, and only indices beyond it go through the hash. When an append
+// closes a gap, entries that have become contiguous move out of the hash.
+class FWorldGlobalArray
+{
+public:
+	struct Pair
+	{
+		SDWORD Key, Value;
+	};
+	typedef const Pair ConstPair;
+
+	// Iterates the flat part first, then the hashed part. Zero-valued flat
+	// entries are skipped so that serialization does not bloat savegames
+	// with elements nothing ever wrote to.
+	class ConstIterator
+	{
+	public:
+		ConstIterator(const FWorldGlobalArray &array)
+			: Array(array), MapIt(array.Sparse), DenseIndex(0)
+		{
+		}
+
+		bool NextPair(ConstPair *&pair)
+		{
+			while (DenseIndex < Array.Dense.Size())
+			{
+				if (Array.Dense[DenseIndex] != 0)
+				{
+					Scratch.Key = (SDWORD)DenseIndex;
+					Scratch.Value = Array.Dense[DenseIndex];
+					DenseIndex++;
+					pair = &Scratch;
+					return true;
+				}
+				DenseIndex++;
+			}
+			FACSSparseArray::ConstPair *mappair;
+			if (MapIt.NextPair(mappair))
+			{
+				Scratch.Key = mappair->Key;
+				Scratch.Value = mappair->Value;
+				pair = &Scratch;
+				return true;
+			}
+			return false;
+		}
+
+	private:
+		const FWorldGlobalArray &Array;
+		FACSSparseArray::ConstIterator MapIt;
+		unsigned int DenseIndex;
+		Pair Scratch;
+	};
+
+	SDWORD &operator[](SDWORD index)
+	{
+		if ((unsigned int)index < Dense.Size())
+		{
+			return Dense[index];
+		}
+		if (index >= 0 && (unsigned int)index == Dense.Size())
+		{
+			// Appending: grow the flat part, then pull in any hashed
+			// entries that are contiguous with it now.
+			Dense.Push(0);
+			MoveSparseToDense();
+			return Dense[index];
+		}
+		return Sparse[index];
+	}
+
+	void Insert(SDWORD index, SDWORD value)
+	{
+		(*this)[index] = value;
+	}
+
+	unsigned int CountUsed() const
+	{
+		unsigned int count = (unsigned int)Sparse.CountUsed();
+		for (unsigned int i = 0; i < Dense.Size(); ++i)
+		{
+			count += Dense[i] != 0;
+		}
+		return count;
+	}
+
+	void Clear()
+	{
+		Dense.Clear();
+		Sparse.Clear();
+	}
+
+private:
+	void MoveSparseToDense()
+	{
+		SDWORD *val;
+		while ((val = Sparse.CheckKey((SDWORD)Dense.Size())) != NULL)
+		{
+			Dense.Push(*val);
+			Sparse.Remove((SDWORD)(Dense.Size() - 1));
+		}
+	}
+
+	TArray<SDWORD> Dense;
+	FACSSparseArray Sparse;
+};
 
 // ACS variables with world scope
 extern SDWORD ACS_WorldVars[NUM_WORLDVARS];
@@ -101,22 +213,23 @@ public:
 private:
 	int FindString(const char *str, size_t len, unsigned int h, unsigned int bucketnum);
 	int InsertString(FString &str, unsigned int h, unsigned int bucketnum);
-	void FindFirstFreeEntry(unsigned int base);
+	void Rehash(unsigned int newbuckets);
 
-	enum { NUM_BUCKETS = 251 };
+	enum { MIN_BUCKETS = 251 };
 	enum { FREE_ENTRY = 0xFFFFFFFE };	// Stored in PoolEntry's Next field
 	enum { NO_ENTRY = 0xFFFFFFFF };
 	enum { MIN_GC_SIZE = 100 };			// Don't auto-collect until there are this many strings
 	struct PoolEntry
 	{
 		FString Str;
-		unsigned int Hash;
+		unsigned int Hash;	// also the free list link while the entry is free
 		unsigned int Next;
 		unsigned int LockCount;
 	};
 	TArray<PoolEntry> Pool;
-	unsigned int PoolBuckets[NUM_BUCKETS];
-	unsigned int FirstFreeEntry;
+	TArray<unsigned int> PoolBuckets;
+	unsigned int NumBuckets;
+	unsigned int FirstFreeEntry;	// head of the free list, NO_ENTRY if none
 };
 extern ACSStringPool GlobalACSStrings;
 
@@ -889,6 +1002,8 @@ protected:
 	EScriptState	state;
 	int				statedata;
 	TObjPtr<AActor>	activator;
+	int				cachedtid;
+	AActor			*cachedactor;	// one entry TID memo, only valid while RunScript runs
 	line_t			*activationline;
 	bool			backSide;
 	FFont			*activefont;
@@ -916,6 +1031,7 @@ protected:
 	int DoSpawnSpotFacing (int type, int spot, int tid, bool forced);
 	int DoClassifyActor (int tid);
 	int CallFunction(int argCount, int funcIndex, SDWORD *args);
+	AActor *ActorFromTID (int tid, AActor *defactor);
 
 	void DoFadeTo (int r, int g, int b, int a, int time);
 	void DoFadeRange (int r1, int g1, int b1, int a1,
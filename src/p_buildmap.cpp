@@ -389,7 +389,7 @@ static void LoadSectors (sectortype *bsec)
 	sector_t *sec;
 	char tnam[9];
 
-	sec = sectors = new sector_t[numsectors];
+	sec = sectors = AllocMapArray<sector_t> (numsectors);
 	memset (sectors, 0, sizeof(sector_t)*numsectors);
 
 	sectors[0].e = new extsector_t[numsectors];
@@ -489,10 +489,10 @@ static void LoadWalls (walltype *walls, int numwalls, sectortype *bsec)
 	numsides = numvertexes = numwalls;
 	numlines = 0;
 
-	sides = new side_t[numsides];
+	sides = AllocMapArray<side_t> (numsides);
 	memset (sides, 0, numsides*sizeof(side_t));
 
-	vertexes = new vertex_t[numvertexes];
+	vertexes = AllocMapArray<vertex_t> (numvertexes);
 	numvertexes = 0;
 
 	// First mark each sidedef with the sector it belongs to
@@ -562,7 +562,7 @@ static void LoadWalls (walltype *walls, int numwalls, sectortype *bsec)
 	}
 
 	// Set line properties that Doom doesn't store per-sidedef
-	lines = new line_t[numlines];
+	lines = AllocMapArray<line_t> (numlines);
 	memset (lines, 0, numlines*sizeof(line_t));
 
 	for (i = 0, j = -1; i < numwalls; ++i)
@@ -11,9 +11,26 @@
 
 struct FCheckPosition
 {
+	// Classification of the moving thing, so that PIT_CheckThing can take
+	// quick exits instead of retesting the same multi-word flag combinations
+	// for every nearby actor. Set by ClassifyMover.
+	enum
+	{
+		MOVER_THRUACTORS	= 1,	// passes through all actors
+		MOVER_THRUSPECIES	= 2,	// passes through its own species
+		MOVER_MTHRUSPECIES	= 4,	// missile passes through its shooter's species
+		MOVER_WALKING		= 8,	// ordinary walker, may step onto bridge things
+		MOVER_PASSMOBJ		= 16,	// may move over/under other things
+		MOVER_MISSILE		= 32,	// missile or non-solid MBF bouncer
+		MOVER_PREDICTING	= 64,	// player prediction dry run
+	};
+
 	// in
 	AActor			*thing;
 	DVector3		pos;
+	DWORD			MoverFlags;
+	FName			MoverSpecies;		// for MOVER_THRUSPECIES
+	FName			MoverTargetSpecies;	// for MOVER_MTHRUSPECIES
 
 	// out
 	sector_t		*sector;
@@ -32,9 +49,23 @@ struct FCheckPosition
 	line_t			*ceilingline;
 	AActor			*stepthing;
 	// [RH] These are used by PIT_CheckThing and P_XYMovement to apply
-	// ripping damage once per tic instead of once per move.
-	TMap<AActor*, bool> LastRipped;
+	// ripping damage once per tic instead of once per move. A plain array
+	// beats a hash table here: only a handful of actors get ripped in one
+	// tic, and an empty TArray costs no heap allocation, which a TMap does
+	// for every FCheckPosition put on the stack.
+	TArray<AActor*>	LastRipped;
 	bool			DoRipping;
+
+	// Returns true the first time an actor is marked in a ripping pass.
+	bool MarkRipped (AActor *ripped)
+	{
+		for (unsigned i = 0; i < LastRipped.Size(); i++)
+		{
+			if (LastRipped[i] == ripped) return false;
+		}
+		LastRipped.Push (ripped);
+		return true;
+	}
 	bool			portalstep;
 
 	int				PushTime;
@@ -44,7 +75,10 @@ struct FCheckPosition
 		DoRipping = rip;
 		PushTime = 0;
 		FromPMove = false;
+		MoverFlags = 0;
 	}
+
+	void ClassifyMover ();
 };
 
 
@@ -65,11 +65,11 @@ FRandom pr_railtrail("RailTrail");
 #define FADEFROMTTL(a)	(255/(a))
 
 // [RH] particle globals
-WORD			NumParticles;
-WORD			ActiveParticles;
-WORD			InactiveParticles;
+DWORD			NumParticles;
+DWORD			ActiveParticles;
+DWORD			InactiveParticles;
 particle_t		*Particles;
-TArray<WORD>	ParticlesInSubsec;
+TArray<DWORD>	ParticlesInSubsec;
 
 static int grey1, grey2, grey3, grey4, red, green, blue, yellow, black,
 		   red1, green1, blue1, yellow1, purple, purple1, white,
@@ -117,7 +117,7 @@ inline particle_t *NewParticle (void)
 		result = Particles + InactiveParticles;
 		InactiveParticles = result->tnext;
 		result->tnext = ActiveParticles;
-		ActiveParticles = WORD(result - Particles);
+		ActiveParticles = DWORD(result - Particles);
 	}
 	return result;
 }
@@ -134,8 +134,8 @@ CUSTOM_CVAR( Int, r_maxparticles, 4000, CVAR_ARCHIVE )
 {
 	if ( self == 0 )
 		self = 4000;
-	else if (self > 65535)
-		self = 65535;
+	else if (self > 1000000)
+		self = 1000000;
 	else if (self < 100)
 		self = 100;
 
@@ -158,7 +158,7 @@ void P_InitParticles ()
 		num = r_maxparticles;
 
 	// This should be good, but eh...
-	NumParticles = (WORD)clamp<int>(num, 100, 65535);
+	NumParticles = (DWORD)clamp<int>(num, 100, 1000000);
 
 	P_DeinitParticles();
 	Particles = new particle_t[NumParticles];
@@ -177,7 +177,7 @@ void P_DeinitParticles()
 
 void P_ClearParticles ()
 {
-	int i;
+	DWORD i;
 
 	memset (Particles, 0, NumParticles * sizeof(particle_t));
 	ActiveParticles = NO_PARTICLE;
@@ -198,13 +198,13 @@ void P_FindParticleSubsectors ()
 		ParticlesInSubsec.Reserve (numsubsectors - ParticlesInSubsec.Size());
 	}
 
-	clearbufshort (&ParticlesInSubsec[0], numsubsectors, NO_PARTICLE);
+	clearbuf (&ParticlesInSubsec[0], numsubsectors, NO_PARTICLE);
 
 	if (!r_particles)
 	{
 		return;
 	}
-	for (WORD i = ActiveParticles; i != NO_PARTICLE; i = Particles[i].tnext)
+	for (DWORD i = ActiveParticles; i != NO_PARTICLE; i = Particles[i].tnext)
 	{
 		 // Try to reuse the subsector from the last portal check, if still valid.
 		if (Particles[i].subsector == NULL) Particles[i].subsector = R_PointInSubsector(Particles[i].Pos);
@@ -254,7 +254,7 @@ void P_InitEffects ()
 
 void P_ThinkParticles ()
 {
-	int i;
+	DWORD i;
 	particle_t *particle, *prev;
 
 	i = ActiveParticles;
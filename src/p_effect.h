@@ -64,16 +64,16 @@ struct particle_t
 	BYTE	bright;
 	BYTE	fade;
 	int		color;
-	WORD	tnext;
-	WORD	snext;
+	DWORD	tnext;
+	DWORD	snext;
 	subsector_t * subsector;
 	bool	notimefreeze;
 };
 
 extern particle_t *Particles;
-extern TArray<WORD>		ParticlesInSubsec;
+extern TArray<DWORD>	ParticlesInSubsec;
 
-const WORD NO_PARTICLE = 0xffff;
+const DWORD NO_PARTICLE = 0xffffffff;
 
 void P_ClearParticles ();
 void P_FindParticleSubsectors ();
@@ -1227,6 +1227,10 @@ bool P_IsVisible(AActor *lookee, AActor *other, INTBOOL allaround, FLookExParams
 	}
 
 	// P_CheckSight is by far the most expensive operation in here so let's do it last.
+	// Note that it cannot be taken off the playsim thread or deferred into a
+	// batch: it advances the checksight random stream and the callers act on
+	// the result immediately. Repeated checks for the same pair within a tic
+	// are answered by the cache inside P_CheckSight instead.
 	return P_CheckSight(lookee, other, SF_SEEPASTSHOOTABLELINES);
 }
 
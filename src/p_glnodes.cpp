@@ -251,7 +251,7 @@ static bool LoadGLVertexes(FileReader * lump)
 
 	vertex_t * oldvertexes = vertexes;
 	numvertexes += (gllen - GL_VERT_OFFSET)/sizeof(mapglvertex_t);
-	vertexes	 = new vertex_t[numvertexes];
+	vertexes	 = AllocMapArray<vertex_t> (numvertexes);
 	mgl			 = (mapglvertex_t *) (gldata + GL_VERT_OFFSET);	
 
 	memcpy(vertexes, oldvertexes, firstglvertex * sizeof(vertex_t));
@@ -315,9 +315,9 @@ static bool LoadGLSegs(FileReader * lump)
 		if (!format5 && memcmp(data, "gNd3", 4))
 		{
 			numsegs/=sizeof(glseg_t);
-			segs = new seg_t[numsegs];
+			segs = AllocMapArray<seg_t> (numsegs);
 			memset(segs,0,sizeof(seg_t)*numsegs);
-			glsegextras = new glsegextra_t[numsegs];
+			glsegextras = AllocMapArray<glsegextra_t> (numsegs);
 			
 			glseg_t * ml = (glseg_t*)data;
 			for(i = 0; i < numsegs; i++)
@@ -368,9 +368,9 @@ static bool LoadGLSegs(FileReader * lump)
 		{
 			if (!format5) numsegs-=4;
 			numsegs/=sizeof(glseg3_t);
-			segs = new seg_t[numsegs];
+			segs = AllocMapArray<seg_t> (numsegs);
 			memset(segs,0,sizeof(seg_t)*numsegs);
-			glsegextras = new glsegextra_t[numsegs];
+			glsegextras = AllocMapArray<glsegextra_t> (numsegs);
 			
 			glseg3_t * ml = (glseg3_t*)(data+ (format5? 0:4));
 			for(i = 0; i < numsegs; i++)
@@ -428,7 +428,6 @@ static bool LoadGLSegs(FileReader * lump)
 		// (at least under MSVC. GCC can't do SEH even for Windows... :( )
 		Printf("Invalid GL segs. The BSP will have to be rebuilt.\n");
 		delete [] data;
-		delete [] segs;
 		segs = NULL;
 		return false;
 	}
@@ -462,7 +461,7 @@ static bool LoadGLSubsectors(FileReader * lump)
 	{
 		mapsubsector_t * data = (mapsubsector_t*) datab;
 		numsubsectors /= sizeof(mapsubsector_t);
-		subsectors = new subsector_t[numsubsectors];
+		subsectors = AllocMapArray<subsector_t> (numsubsectors);
 		memset(subsectors,0,numsubsectors * sizeof(subsector_t));
 	
 		for (i=0; i<numsubsectors; i++)
@@ -481,7 +480,7 @@ static bool LoadGLSubsectors(FileReader * lump)
 	{
 		gl3_mapsubsector_t * data = (gl3_mapsubsector_t*) (datab+(format5? 0:4));
 		numsubsectors /= sizeof(gl3_mapsubsector_t);
-		subsectors = new subsector_t[numsubsectors];
+		subsectors = AllocMapArray<subsector_t> (numsubsectors);
 		memset(subsectors,0,numsubsectors * sizeof(subsector_t));
 	
 		for (i=0; i<numsubsectors; i++)
@@ -542,7 +541,7 @@ static bool LoadNodes (FileReader * lump)
 
 		if (numnodes == 0) return false;
 
-		nodes = new node_t[numnodes];		
+		nodes = AllocMapArray<node_t> (numnodes);
 		lump->Seek(0, SEEK_SET);
 
 		basemn = mn = new mapnode_t[numnodes];
@@ -602,7 +601,7 @@ static bool LoadNodes (FileReader * lump)
 
 		if (numnodes == 0) return false;
 
-		nodes = new node_t[numnodes];		
+		nodes = AllocMapArray<node_t> (numnodes);
 		lump->Seek(0, SEEK_SET);
 
 		basemn = mn = new gl5_mapnode_t[numnodes];
@@ -672,25 +671,19 @@ static bool DoLoadGLNodes(FileReader ** lumps)
 	}
 	if (!LoadGLSegs(lumps[1]))
 	{
-		delete [] segs;
 		segs = NULL;
 		return false;
 	}
 	if (!LoadGLSubsectors(lumps[2]))
 	{
-		delete [] subsectors;
 		subsectors = NULL;
-		delete [] segs;
 		segs = NULL;
 		return false;
 	}
 	if (!LoadNodes(lumps[3]))
 	{
-		delete [] nodes;
 		nodes = NULL;
-		delete [] subsectors;
 		subsectors = NULL;
-		delete [] segs;
 		segs = NULL;
 		return false;
 	}
@@ -704,11 +697,8 @@ static bool DoLoadGLNodes(FileReader ** lumps)
 		if (!seg->sidedef) 
 		{
 			Printf("GL nodes contain invalid data. The BSP has to be rebuilt.\n");
-			delete [] nodes;
 			nodes = NULL;
-			delete [] subsectors;
 			subsectors = NULL;
-			delete [] segs;
 			segs = NULL;
 			return false;
 		}
@@ -871,21 +861,9 @@ bool P_LoadGLNodes(MapData * map)
 			}
 			catch (CRecoverableError &)
 			{
-				if (subsectors != NULL)
-				{
-					delete[] subsectors;
-					subsectors = NULL;
-				}
-				if (segs != NULL)
-				{
-					delete[] segs;
-					segs = NULL;
-				}
-				if (nodes != NULL)
-				{
-					delete[] nodes;
-					nodes = NULL;
-				}
+				subsectors = NULL;
+				segs = NULL;
+				nodes = NULL;
 			}
 		}
 	}
@@ -984,7 +962,7 @@ bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime)
 		numnodes = 0;
 		subsectors = NULL;
 		numsubsectors = 0;
-		if (segs) delete [] segs;
+		R_ClearPointInSubsectorCache();	// any cached result refers to the discarded tree
 		segs = NULL;
 		numsegs = 0;
 
@@ -1007,7 +985,6 @@ bool P_CheckNodes(MapData * map, bool rebuilt, int buildtime)
 			};
 			leveldata.FindMapBounds ();
 			FNodeBuilder builder (leveldata, polyspots, anchors, true);
-			delete[] vertexes;
 			builder.Extract (nodes, numnodes,
 				segs, glsegextras, numsegs,
 				subsectors, numsubsectors,
@@ -1154,21 +1131,14 @@ static void CreateCachedNodes(MapData *map)
 		}
 	}
 
-	uLongf outlen = ZNodes.Size();
+	// The node data is stored uncompressed ("X" format) so that the loader
+	// can parse it in place from a memory mapping of the cache file.
+	unsigned outlen = ZNodes.Size();
 	BYTE *compressed;
 	int offset = numlines * 8 + 12 + 16;
-	int r;
-	do
-	{
-		compressed = new Bytef[outlen + offset];
-		r = compress (compressed + offset, &outlen, &ZNodes[0], ZNodes.Size());
-		if (r == Z_BUF_ERROR)
-		{
-			delete[] compressed;
-			outlen += 1024;
-		}
-	} 
-	while (r == Z_BUF_ERROR);
+
+	compressed = new BYTE[outlen + offset];
+	memcpy(compressed + offset, &ZNodes[0], ZNodes.Size());
 
 	memcpy(compressed, "CACH", 4);
 	DWORD len = LittleLong(numlines);
@@ -1179,7 +1149,7 @@ static void CreateCachedNodes(MapData *map)
 		DWORD ndx[2] = {LittleLong(DWORD(lines[i].v1 - vertexes)), LittleLong(DWORD(lines[i].v2 - vertexes)) };
 		memcpy(compressed+8+16+8*i, ndx, 8);
 	}
-	memcpy(compressed + offset - 4, "ZGL3", 4);
+	memcpy(compressed + offset - 4, "XGL3", 4);
 
 	FString path = CreateCacheName(map, true);
 	FILE *f = fopen(path, "wb");
@@ -1209,55 +1179,62 @@ static bool CheckCachedNodes(MapData *map)
 	BYTE md5map[16];
 	DWORD numlin;
 	DWORD *verts = NULL;
+	FileReader *fr = NULL;
 
 	FString path = CreateCacheName(map, false);
-	FILE *f = fopen(path, "rb");
-	if (f == NULL) return false;
 
-	if (fread(magic, 1, 4, f) != 4) goto errorout;
+	// Map the cache file into memory so that the node data is parsed in
+	// place; stdio reads are only used if the mapping fails.
+	{
+		MemoryMappedFileReader *mapped = new MemoryMappedFileReader;
+		if (mapped->Open(path))
+		{
+			fr = mapped;
+		}
+		else
+		{
+			delete mapped;
+			FileReader *plain = new FileReader;
+			if (!plain->Open(path))
+			{
+				delete plain;
+				return false;
+			}
+			fr = plain;
+		}
+	}
+
+	if (fr->Read(magic, 4) != 4) goto errorout;
 	if (memcmp(magic, "CACH", 4))  goto errorout;
 
-	if (fread(&numlin, 4, 1, f) != 1) goto errorout; 
+	if (fr->Read(&numlin, 4) != 4) goto errorout;
 	numlin = LittleLong(numlin);
 	if ((int)numlin != numlines) goto errorout;
 
-	if (fread(md5, 1, 16, f) != 16) goto errorout;
+	if (fr->Read(md5, 16) != 16) goto errorout;
 	map->GetChecksum(md5map);
 	if (memcmp(md5, md5map, 16)) goto errorout;
 
 	verts = new DWORD[numlin * 8];
-	if (fread(verts, 8, numlin, f) != numlin) goto errorout;
+	if (fr->Read(verts, numlin * 8) != (long)(numlin * 8)) goto errorout;
 
-	if (fread(magic, 1, 4, f) != 4) goto errorout;
-	if (memcmp(magic, "ZGL2", 4) && memcmp(magic, "ZGL3", 4))  goto errorout;
+	if (fr->Read(magic, 4) != 4) goto errorout;
+	// Caches from older versions hold zlib compressed nodes; they are still
+	// accepted, newly written caches use the uncompressed format.
+	if (memcmp(magic, "ZGL2", 4) && memcmp(magic, "ZGL3", 4) && memcmp(magic, "XGL3", 4))  goto errorout;
 
 
 	try
 	{
-		long pos = ftell(f);
-		FileReader fr(f);
-		fr.Seek(pos, SEEK_SET);
-		P_LoadZNodes (fr, MAKE_ID(magic[0],magic[1],magic[2],magic[3]));
+		P_LoadZNodes (*fr, MAKE_ID(magic[0],magic[1],magic[2],magic[3]));
 	}
 	catch (CRecoverableError &error)
 	{
 		Printf ("Error loading nodes: %s\n", error.GetMessage());
 
-		if (subsectors != NULL)
-		{
-			delete[] subsectors;
-			subsectors = NULL;
-		}
-		if (segs != NULL)
-		{
-			delete[] segs;
-			segs = NULL;
-		}
-		if (nodes != NULL)
-		{
-			delete[] nodes;
-			nodes = NULL;
-		}
+		subsectors = NULL;
+		segs = NULL;
+		nodes = NULL;
 		goto errorout;
 	}
 
@@ -1268,7 +1245,7 @@ static bool CheckCachedNodes(MapData *map)
 	}
 	delete [] verts;
 
-	fclose(f);
+	delete fr;
 	return true;
 
 errorout:
@@ -1276,7 +1253,7 @@ errorout:
 	{
 		delete[] verts;
 	}
-	fclose(f);
+	delete fr;
 	return false;
 }
 
@@ -3698,6 +3698,14 @@ int P_FindLineSpecial (const char *string, int *min_args, int *max_args)
 //
 // P_ExecuteSpecial
 //
+// The table above is dense - every slot holds a function, with LS_NOP
+// filling the gaps - so dispatch is one range check and one indirect
+// call. Resolving the pointer into line_t at load time would not remove
+// either: specials are also run from ACS and scripted sources with
+// arbitrary numbers, and whether a given activation may run a line
+// depends on the activator, which P_TestActivateLine has to evaluate per
+// attempt anyway.
+//
 //==========================================================================
 
 int P_ExecuteSpecial(int			num,
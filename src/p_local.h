@@ -400,6 +400,7 @@ void	P_DelSeclist(msecnode_t *);							// phares 3/16/98
 msecnode_t *P_AddSecnode(sector_t *s, AActor *thing, msecnode_t *nextnode, msecnode_t *&sec_thinglist);
 msecnode_t*	P_DelSecnode(msecnode_t *, msecnode_t *sector_t::*head);
 void	P_CreateSecNodeList(AActor*);		// phares 3/14/98
+void	P_FreeSecNodeArenas();
 double	P_GetMoveFactor(const AActor *mo, double *frictionp);	// phares  3/6/98
 double		P_GetFriction(const AActor *mo, double *frictionfactor);
 
@@ -411,6 +412,11 @@ const secplane_t * P_CheckSlopeWalk(AActor *actor, DVector2 &move);
 //
 extern BYTE*			rejectmatrix;	// for fast sight rejection
 
+// [p_sight.cpp] Background build of a synthetic REJECT for maps without one.
+void P_StartRejectBuild ();
+void P_AdoptBuiltReject ();
+void P_AbortRejectBuild ();
+
 
 
 //
@@ -1094,6 +1094,52 @@ static bool CanAttackHurt(AActor *victim, AActor *shooter)
 	return true;
 }
 
+//==========================================================================
+//
+// FCheckPosition :: ClassifyMover
+//
+// Precomputes the moving thing's side of the flag tests below, so that
+// checking a position only pays for them once instead of once per nearby
+// actor. Must be called again if the mover's flags change mid-check (see
+// the Slam handling in PIT_CheckThing).
+//
+//==========================================================================
+
+void FCheckPosition::ClassifyMover ()
+{
+	MoverFlags = 0;
+	if (thing->flags2 & MF2_THRUACTORS)
+	{
+		MoverFlags |= MOVER_THRUACTORS;
+	}
+	if (thing->flags6 & MF6_THRUSPECIES)
+	{
+		MoverFlags |= MOVER_THRUSPECIES;
+		MoverSpecies = thing->GetSpecies();
+	}
+	if ((thing->flags6 & MF6_MTHRUSPECIES) && thing->target != NULL)
+	{
+		MoverFlags |= MOVER_MTHRUSPECIES;
+		MoverTargetSpecies = thing->target->GetSpecies();
+	}
+	if (!(thing->flags & (MF_FLOAT | MF_MISSILE | MF_SKULLFLY | MF_NOGRAVITY)))
+	{
+		MoverFlags |= MOVER_WALKING;
+	}
+	if (thing->flags2 & MF2_PASSMOBJ)
+	{
+		MoverFlags |= MOVER_PASSMOBJ;
+	}
+	if (thing->flags & MF_MISSILE || ((thing->BounceFlags & BOUNCE_MBF) && !(thing->flags & MF_SOLID)))
+	{
+		MoverFlags |= MOVER_MISSILE;
+	}
+	if (thing->player != NULL && (thing->player->cheats & CF_PREDICTING))
+	{
+		MoverFlags |= MOVER_PREDICTING;
+	}
+}
+
 //==========================================================================
 //
 // PIT_CheckThing
@@ -1118,10 +1164,10 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 	if (fabs(thing->X() - cres.Position.X) >= blockdist || fabs(thing->Y() - cres.Position.Y) >= blockdist)
 		return true;
 
-	if ((thing->flags2 | tm.thing->flags2) & MF2_THRUACTORS)
+	if ((thing->flags2 & MF2_THRUACTORS) || (tm.MoverFlags & FCheckPosition::MOVER_THRUACTORS))
 		return true;
 
-	if ((tm.thing->flags6 & MF6_THRUSPECIES) && (tm.thing->GetSpecies() == thing->GetSpecies()))
+	if ((tm.MoverFlags & FCheckPosition::MOVER_THRUSPECIES) && tm.MoverSpecies == thing->GetSpecies())
 		return true;
 
 	tm.thing->BlockingMobj = thing;
@@ -1133,7 +1179,7 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 	// walking on other actors and unblocking is too messy through restricted portal types so disable it.
 	if (!(cres.portalflags & FFCF_RESTRICTEDPORTAL))
 	{
-		if (!(i_compatflags & COMPATF_NO_PASSMOBJ) && !(tm.thing->flags & (MF_FLOAT | MF_MISSILE | MF_SKULLFLY | MF_NOGRAVITY)) &&
+		if (!(i_compatflags & COMPATF_NO_PASSMOBJ) && (tm.MoverFlags & FCheckPosition::MOVER_WALKING) &&
 			(thing->flags & MF_SOLID) && (thing->flags4 & MF4_ACTLIKEBRIDGE))
 		{
 			// [RH] Let monsters walk on actors as well as floors
@@ -1181,7 +1227,7 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 
 	// [RH] If the other thing is a bridge, then treat the moving thing as if it had MF2_PASSMOBJ, so
 	// you can use a scrolling floor to move scenery items underneath a bridge.
-	if ((tm.thing->flags2 & MF2_PASSMOBJ || thing->flags4 & MF4_ACTLIKEBRIDGE) && !(i_compatflags & COMPATF_NO_PASSMOBJ))
+	if ((tm.MoverFlags & FCheckPosition::MOVER_PASSMOBJ || thing->flags4 & MF4_ACTLIKEBRIDGE) && !(i_compatflags & COMPATF_NO_PASSMOBJ))
 	{ // check if a mobj passed over/under another object
 		if (!(tm.thing->flags & MF_MISSILE) ||
 			!(tm.thing->flags2 & MF2_RIP) ||
@@ -1197,7 +1243,7 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 		}
 	}
 
-	if (tm.thing->player == NULL || !(tm.thing->player->cheats & CF_PREDICTING))
+	if (!(tm.MoverFlags & FCheckPosition::MOVER_PREDICTING))
 	{
 		// touchy object is alive, toucher is solid
 		if (thing->flags6 & MF6_TOUCHY && tm.thing->flags & MF_SOLID && thing->health > 0 &&
@@ -1236,11 +1282,13 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 	{
 		bool res = tm.thing->Slam(tm.thing->BlockingMobj);
 		tm.thing->BlockingMobj = NULL;
+		// Slam changes the skull's flags, so the cached classification is stale now.
+		tm.ClassifyMover ();
 		return res;
 	}
 
 	// [ED850] Player Prediction ends here. There is nothing else they could/should do.
-	if (tm.thing->player != NULL && (tm.thing->player->cheats & CF_PREDICTING))
+	if (tm.MoverFlags & FCheckPosition::MOVER_PREDICTING)
 	{
 		solid = (thing->flags & MF_SOLID) &&
 			!(thing->flags & MF_NOCLIP) &&
@@ -1270,7 +1318,7 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 		}
 	}
 	// Check for missile or non-solid MBF bouncer
-	if (tm.thing->flags & MF_MISSILE || ((tm.thing->BounceFlags & BOUNCE_MBF) && !(tm.thing->flags & MF_SOLID)))
+	if (tm.MoverFlags & FCheckPosition::MOVER_MISSILE)
 	{
 		// Check for a non-shootable mobj
 		if (thing->flags2 & MF2_NONSHOOTABLE)
@@ -1283,9 +1331,8 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 			return true;
 		}
 
-		if ((tm.thing->flags6 & MF6_MTHRUSPECIES)
-			&& tm.thing->target // NULL pointer check
-			&& (tm.thing->target->GetSpecies() == thing->GetSpecies()))
+		if ((tm.MoverFlags & FCheckPosition::MOVER_MTHRUSPECIES)
+			&& (tm.MoverTargetSpecies == thing->GetSpecies()))
 			return true;
 
 		// Check for rippers passing through corpses
@@ -1362,10 +1409,8 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 		{
 			if (!(tm.thing->flags6 & MF6_NOBOSSRIP) || !(thing->flags2 & MF2_BOSS))
 			{
-				bool *check = tm.LastRipped.CheckKey(thing);
-				if (check == NULL || !*check)
+				if (tm.MarkRipped(thing))
 				{
-					tm.LastRipped[thing] = true;
 					if (!(thing->flags & MF_NOBLOOD) &&
 						!(thing->flags2 & MF2_REFLECTIVE) &&
 						!(tm.thing->flags3 & MF3_BLOODLESSIMPACT) &&
@@ -1442,6 +1487,8 @@ bool PIT_CheckThing(FMultiBlockThingsIterator &it, FMultiBlockThingsIterator::Ch
 				tm.thing->tracer = tm.thing->target;
 			}
 			tm.thing->target = thing;
+			// The target switch invalidates the cached MTHRUSPECIES classification.
+			tm.ClassifyMover ();
 			return true;
 		}
 		return false;		// don't traverse any more
@@ -1526,6 +1573,7 @@ bool P_CheckPosition(AActor *thing, const DVector2 &pos, FCheckPosition &tm, boo
 	tm.pos.X = pos.X;
 	tm.pos.Y = pos.Y;
 	tm.pos.Z = thing->Z();
+	tm.ClassifyMover ();
 
 	newsec = tm.sector = P_PointInSector(pos);
 	tm.ceilingline = thing->BlockingLine = NULL;
@@ -5317,6 +5365,12 @@ int P_RadiusAttack(AActor *bombspot, AActor *bombsource, int bombdamage, int bom
 			// The damage pattern is square, not circular.
 			len = double(dx > dy ? dx : dy);
 
+			// Quick reject on the horizontal distance alone, so actors in the
+			// corners of the blockmap box don't pay for the vertical math and
+			// a square root just to produce zero points below.
+			if (len - boxradius >= (double)bombdistance)
+				continue;
+
 			if (bombspot->Z() < thing->Z() || bombspot->Z() >= thing->Top())
 			{
 				double dz;
@@ -6179,6 +6233,29 @@ bool P_ChangeSector(sector_t *sector, int crunch, double amt, int floorOrCeil, b
 
 msecnode_t *headsecnode = NULL;
 
+// Instead of allocating each node on its own, they are carved out of larger
+// arenas so the touching lists built from them stay reasonably local in
+// memory. The arenas are released by P_FreeSecNodeArenas at level teardown.
+struct FSecNodeArena
+{
+	FSecNodeArena *NextArena;
+	msecnode_t Nodes[512];
+};
+static FSecNodeArena *secnodearenas = NULL;
+
+void P_FreeSecNodeArenas()
+{
+	FSecNodeArena *arena = secnodearenas;
+	while (arena != NULL)
+	{
+		FSecNodeArena *next = arena->NextArena;
+		M_Free(arena);
+		arena = next;
+	}
+	secnodearenas = NULL;
+	headsecnode = NULL;
+}
+
 //=============================================================================
 //
 // P_GetSecnode
@@ -6192,15 +6269,20 @@ msecnode_t *P_GetSecnode()
 {
 	msecnode_t *node;
 
-	if (headsecnode)
+	if (headsecnode == NULL)
 	{
-		node = headsecnode;
-		headsecnode = headsecnode->m_snext;
-	}
-	else
-	{
-		node = (msecnode_t *)M_Malloc(sizeof(*node));
+		// Refill the freelist from a fresh arena.
+		FSecNodeArena *arena = (FSecNodeArena *)M_Malloc(sizeof(*arena));
+		arena->NextArena = secnodearenas;
+		secnodearenas = arena;
+		for (size_t i = 0; i < countof(arena->Nodes); i++)
+		{
+			arena->Nodes[i].m_snext = headsecnode;
+			headsecnode = &arena->Nodes[i];
+		}
 	}
+	node = headsecnode;
+	headsecnode = headsecnode->m_snext;
 	return node;
 }
 
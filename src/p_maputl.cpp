@@ -457,7 +457,7 @@ void AActor::LinkToWorld(bool spawningmapthing, sector_t *sector)
 	{
 		FPortalGroupArray check;
 
-		P_CollectConnectedGroups(Sector->PortalGroup, Pos(), Top(), radius, check);
+		P_CollectConnectedGroups(Sector->PortalGroup, Pos(), Top(), radius, check, Sector);
 
 		BlockNode = NULL;
 		FBlockNode **alink = &this->BlockNode;
@@ -704,7 +704,7 @@ FMultiBlockLinesIterator::FMultiBlockLinesIterator(FPortalGroupArray &check, AAc
 	: checklist(check)
 {
 	checkpoint = origin->Pos();
-	if (!check.inited) P_CollectConnectedGroups(origin->Sector->PortalGroup, checkpoint, origin->Top(), checkradius, checklist);
+	if (!check.inited) P_CollectConnectedGroups(origin->Sector->PortalGroup, checkpoint, origin->Top(), checkradius, checklist, origin->Sector);
 	checkpoint.Z = checkradius == -1? origin->radius : checkradius;
 	basegroup = origin->Sector->PortalGroup;
 	startsector = origin->Sector;
@@ -718,7 +718,7 @@ FMultiBlockLinesIterator::FMultiBlockLinesIterator(FPortalGroupArray &check, dou
 	if (newsec == NULL)	newsec = P_PointInSector(checkx, checky);
 	startsector = newsec;
 	basegroup = newsec->PortalGroup;
-	if (!check.inited) P_CollectConnectedGroups(basegroup, checkpoint, checkz + checkh, checkradius, checklist);
+	if (!check.inited) P_CollectConnectedGroups(basegroup, checkpoint, checkz + checkh, checkradius, checklist, newsec);
 	checkpoint.Z = checkradius;
 	Reset();
 }
@@ -856,6 +856,131 @@ void FMultiBlockLinesIterator::Reset()
 	startIteratorForGroup(basegroup);
 }
 
+//===========================================================================
+//
+// FBlockThingsIterator :: FCheckedTable
+//
+// Remembers actors the iterator has already returned. Actors that
+// straddle block boundaries are linked into several blocks, so without
+// this they would be visited more than once. The table uses flat open
+// addressing with linear probing; instances are pooled per thread and
+// entries are validated with a generation stamp, so starting an
+// iteration neither allocates nor clears anything.
+//
+//===========================================================================
+
+struct FBlockThingsIterator::FCheckedTable
+{
+	struct FEntry
+	{
+		AActor *Actor;
+		unsigned Stamp;
+	};
+
+	FEntry *Entries;
+	unsigned Size;		// always a power of 2
+	unsigned Used;
+	unsigned Stamp;
+	FCheckedTable *NextFree;
+
+	static thread_local FCheckedTable *FreeCheckedTables;
+
+	static FCheckedTable *Acquire();
+	void Release();
+	void Reset();
+	bool AddUnique(AActor *me);
+	void Grow();
+
+	unsigned FirstProbe(AActor *me) const
+	{
+		return (unsigned)(((size_t)me >> 3) * 2654435761u) & (Size - 1);
+	}
+};
+
+thread_local FBlockThingsIterator::FCheckedTable *FBlockThingsIterator::FCheckedTable::FreeCheckedTables;
+
+FBlockThingsIterator::FCheckedTable *FBlockThingsIterator::FCheckedTable::Acquire()
+{
+	FCheckedTable *table = FreeCheckedTables;
+	if (table != NULL)
+	{
+		FreeCheckedTables = table->NextFree;
+	}
+	else
+	{
+		table = new FCheckedTable;
+		table->Size = 64;
+		table->Entries = (FEntry *)M_Malloc(table->Size * sizeof(FEntry));
+		memset(table->Entries, 0, table->Size * sizeof(FEntry));
+		table->Stamp = 0;
+	}
+	table->Reset();
+	return table;
+}
+
+void FBlockThingsIterator::FCheckedTable::Release()
+{
+	NextFree = FreeCheckedTables;
+	FreeCheckedTables = this;
+}
+
+void FBlockThingsIterator::FCheckedTable::Reset()
+{
+	Used = 0;
+	if (++Stamp == 0)
+	{ // The stamp wrapped around; invalidate everything the hard way.
+		memset(Entries, 0, Size * sizeof(FEntry));
+		Stamp = 1;
+	}
+}
+
+bool FBlockThingsIterator::FCheckedTable::AddUnique(AActor *me)
+{
+	for (unsigned probe = FirstProbe(me);; probe = (probe + 1) & (Size - 1))
+	{
+		FEntry &entry = Entries[probe];
+		if (entry.Stamp != Stamp)
+		{ // free slot, so this actor was not seen before
+			entry.Actor = me;
+			entry.Stamp = Stamp;
+			if (++Used * 4 >= Size * 3)
+			{
+				Grow();
+			}
+			return true;
+		}
+		if (entry.Actor == me)
+		{
+			return false;
+		}
+	}
+}
+
+void FBlockThingsIterator::FCheckedTable::Grow()
+{
+	FEntry *oldent = Entries;
+	unsigned oldsize = Size;
+
+	Size <<= 1;
+	Entries = (FEntry *)M_Malloc(Size * sizeof(FEntry));
+	memset(Entries, 0, Size * sizeof(FEntry));
+	for (unsigned i = 0; i < oldsize; ++i)
+	{
+		if (oldent[i].Stamp == Stamp)
+		{
+			for (unsigned probe = FirstProbe(oldent[i].Actor);; probe = (probe + 1) & (Size - 1))
+			{
+				if (Entries[probe].Stamp != Stamp)
+				{
+					Entries[probe] = oldent[i];
+					break;
+				}
+			}
+		}
+	}
+	M_Free(oldent);
+}
+
 //===========================================================================
 //
 // FBlockThingsIterator :: FBlockThingsIterator
@@ -863,48 +988,47 @@ void FMultiBlockLinesIterator::Reset()
 //===========================================================================
 
 FBlockThingsIterator::FBlockThingsIterator()
-: DynHash(0)
 {
 	minx = maxx = 0;
 	miny = maxy = 0;
-	ClearHash();
+	singleblock = false;
+	checked = NULL;
 	block = NULL;
 }
 
 FBlockThingsIterator::FBlockThingsIterator(int _minx, int _miny, int _maxx, int _maxy)
-: DynHash(0)
 {
 	minx = _minx;
 	maxx = _maxx;
 	miny = _miny;
 	maxy = _maxy;
-	ClearHash();
+	singleblock = (minx == maxx && miny == maxy);
+	checked = NULL;
 	Reset();
 }
 
+FBlockThingsIterator::~FBlockThingsIterator()
+{
+	if (checked != NULL)
+	{
+		checked->Release();
+	}
+}
+
 void FBlockThingsIterator::init(const FBoundingBox &box)
 {
 	maxy = GetBlockY(box.Top());
 	miny = GetBlockY(box.Bottom());
 	maxx = GetBlockX(box.Right());
 	minx = GetBlockX(box.Left());
-	ClearHash();
+	singleblock = (minx == maxx && miny == maxy);
+	if (checked != NULL)
+	{
+		checked->Reset();
+	}
 	Reset();
 }
 
-//===========================================================================
-//
-// FBlockThingsIterator :: ClearHash
-//
-//===========================================================================
-
-void FBlockThingsIterator::ClearHash()
-{
-	clearbuf(Buckets, countof(Buckets), -1);
-	NumFixedHash = 0;
-	DynHash.Clear();
-}
-
 //===========================================================================
 //
 // FBlockThingsIterator :: StartBlock
@@ -936,6 +1060,10 @@ void FBlockThingsIterator::SwitchBlock(int x, int y)
 {
 	minx = maxx = x;
 	miny = maxy = y;
+	// The path traverser feeds successive blocks through here and relies
+	// on the dedup table persisting across them, so the single block fast
+	// path must stay off.
+	singleblock = false;
 	StartBlock(x, y);
 }
 
@@ -953,8 +1081,6 @@ AActor *FBlockThingsIterator::Next(bool centeronly)
 		{
 			AActor *me = block->Me;
 			FBlockNode *mynode = block;
-			HashEntry *entry;
-			int i;
 
 			block = block->NextActor;
 			// Don't recheck things that were already checked
@@ -979,36 +1105,16 @@ AActor *FBlockThingsIterator::Next(bool centeronly)
 			}
 			else
 			{
-				size_t hash = ((size_t)me >> 3) % countof(Buckets);
-				for (i = Buckets[hash]; i >= 0; )
+				if (singleblock)
+				{ // A one-block search sees even a straddling actor only once.
+					return me;
+				}
+				if (checked == NULL)
 				{
-					entry = GetHashEntry(i);
-					if (entry->Actor == me)
-					{ // I've already been checked. Skip to the next actor.
-						break;
-					}
-					i = entry->Next;
+					checked = FCheckedTable::Acquire();
 				}
-				if (i < 0)
-				{ // Add me to the hash table and return me.
-					if (NumFixedHash < (int)countof(FixedHash))
-					{
-						entry = &FixedHash[NumFixedHash];
-						entry->Next = Buckets[hash];
-						Buckets[hash] = NumFixedHash++;
-					}
-					else
-					{
-						if (DynHash.Size() == 0)
-						{
-							DynHash.Grow(50);
-						}
-						i = DynHash.Reserve(1);
-						entry = &DynHash[i];
-						entry->Next = Buckets[hash];
-						Buckets[hash] = i + countof(FixedHash);
-					}
-					entry->Actor = me;
+				if (checked->AddUnique(me))
+				{ // Not returned before.
 					return me;
 				}
 			}
@@ -1037,7 +1143,7 @@ FMultiBlockThingsIterator::FMultiBlockThingsIterator(FPortalGroupArray &check, A
 	: checklist(check)
 {
 	checkpoint = origin->Pos();
-	if (!check.inited) P_CollectConnectedGroups(origin->Sector->PortalGroup, checkpoint, origin->Top(), checkradius, checklist);
+	if (!check.inited) P_CollectConnectedGroups(origin->Sector->PortalGroup, checkpoint, origin->Top(), checkradius, checklist, origin->Sector);
 	checkpoint.Z = checkradius == -1? origin->radius : checkradius;
 	basegroup = origin->Sector->PortalGroup;
 	Reset();
@@ -1051,7 +1157,7 @@ FMultiBlockThingsIterator::FMultiBlockThingsIterator(FPortalGroupArray &check, d
 	checkpoint.Z = checkz;
 	if (newsec == NULL) newsec = P_PointInSector(checkx, checky);
 	basegroup = newsec->PortalGroup;
-	if (!check.inited) P_CollectConnectedGroups(basegroup, checkpoint, checkz + checkh, checkradius, checklist);
+	if (!check.inited) P_CollectConnectedGroups(basegroup, checkpoint, checkz + checkh, checkradius, checklist, newsec);
 	checkpoint.Z = checkradius;
 	Reset();
 }
@@ -1133,7 +1239,7 @@ void FMultiBlockThingsIterator::Reset()
 //
 //===========================================================================
 
-TArray<intercept_t> FPathTraverse::intercepts(128);
+thread_local TArray<intercept_t> FPathTraverse::intercepts(128);
 
 
 //===========================================================================
@@ -1175,7 +1281,6 @@ void FPathTraverse::AddLineIntercepts(int bx, int by)
 
 		newintercept.frac = frac;
 		newintercept.isaline = true;
-		newintercept.done = false;
 		newintercept.d.line = ld;
 		intercepts.Push (newintercept);
 	}
@@ -1284,7 +1389,6 @@ void FPathTraverse::AddThingIntercepts (int bx, int by, FBlockThingsIterator &it
 					intercept_t newintercept;
 					newintercept.frac = frac;
 					newintercept.isaline = false;
-					newintercept.done = false;
 					newintercept.d.thing = thing;
 					intercepts.Push (newintercept);
 					break;
@@ -1298,7 +1402,6 @@ void FPathTraverse::AddThingIntercepts (int bx, int by, FBlockThingsIterator &it
 				intercept_t newintercept;
 				newintercept.frac = 0;
 				newintercept.isaline = false;
-				newintercept.done = false;
 				newintercept.d.thing = thing;
 				intercepts.Push (newintercept);
 			}
@@ -1348,7 +1451,6 @@ void FPathTraverse::AddThingIntercepts (int bx, int by, FBlockThingsIterator &it
 					intercept_t newintercept;
 					newintercept.frac = frac;
 					newintercept.isaline = false;
-					newintercept.done = false;
 					newintercept.d.thing = thing;
 					intercepts.Push (newintercept);
 				}
@@ -1366,22 +1468,16 @@ void FPathTraverse::AddThingIntercepts (int bx, int by, FBlockThingsIterator &it
 
 intercept_t *FPathTraverse::Next()
 {
-	intercept_t *in = NULL;
-
-	double dist = FLT_MAX;
-	for (unsigned scanpos = intercept_index; scanpos < intercepts.Size (); scanpos++)
+	if (intercept_pos < intercepts.Size ())
 	{
-		intercept_t *scan = &intercepts[scanpos];
-		if (scan->frac < dist && !scan->done)
+		intercept_t *in = &intercepts[intercept_pos];
+		if (in->frac <= 1.)
 		{
-			dist = scan->frac;
-			in = scan;
+			intercept_pos++;
+			return in;
 		}
 	}
-	
-	if (dist > 1. || in == NULL) return NULL;	// checked everything in range			
-	in->done = true;
-	return in;
+	return NULL;	// checked everything in range
 }
 
 //===========================================================================
@@ -1598,6 +1694,23 @@ void FPathTraverse::init(double x1, double y1, double x2, double y2, int flags,
 			break;
 		}
 	}
+
+	// The blocks were visited in ray order, so the list is already nearly
+	// sorted; a stable insertion sort finishes the job cheaply and Next()
+	// can then just walk the range instead of rescanning it per call.
+	for (unsigned i = intercept_index + 1; i < intercepts.Size(); i++)
+	{
+		intercept_t in = intercepts[i];
+		unsigned j = i;
+
+		while (j > intercept_index && intercepts[j-1].frac > in.frac)
+		{
+			intercepts[j] = intercepts[j-1];
+			j--;
+		}
+		intercepts[j] = in;
+	}
+	intercept_pos = intercept_index;
 }
 
 //===========================================================================
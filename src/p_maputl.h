@@ -20,7 +20,6 @@ struct intercept_t
 {
 	double		frac;
 	bool	 	isaline;
-	bool		done;
 	union {
 		AActor *thing;
 		line_t *line;
@@ -278,26 +277,20 @@ class FBlockThingsIterator
 
 	int curx, cury;
 
-	FBlockNode *block;
-
-	int Buckets[32];
+	bool singleblock;	// the search box spans a single block: no dedup needed
 
-	struct HashEntry
-	{
-		AActor *Actor;
-		int Next;
-	};
-	HashEntry FixedHash[10];
-	int NumFixedHash;
-	TArray<HashEntry> DynHash;
+	FBlockNode *block;
 
-	HashEntry *GetHashEntry(int i) { return i < (int)countof(FixedHash) ? &FixedHash[i] : &DynHash[i - countof(FixedHash)]; }
+	// Flat open-addressing table remembering actors already returned.
+	// Storage comes from a per-thread pool in p_maputl.cpp and is only
+	// acquired once an actor that straddles blocks actually shows up.
+	struct FCheckedTable;
+	FCheckedTable *checked;
 
 	void StartBlock(int x, int y);
 	void SwitchBlock(int x, int y);
-	void ClearHash();
 
-	// The following is only for use in the path traverser 
+	// The following is only for use in the path traverser
 	// and therefore declared private.
 	FBlockThingsIterator();
 
@@ -308,8 +301,10 @@ public:
 	FBlockThingsIterator(int minx, int miny, int maxx, int maxy);
 	FBlockThingsIterator(const FBoundingBox &box)
 	{
+		checked = NULL;
 		init(box);
 	}
+	~FBlockThingsIterator();
 	void init(const FBoundingBox &box);
 	AActor *Next(bool centeronly = false);
 	void Reset() { StartBlock(minx, miny); }
@@ -351,12 +346,15 @@ public:
 class FPathTraverse
 {
 protected:
-	static TArray<intercept_t> intercepts;
+	// Each thread gets its own intercept arena so traces on worker
+	// threads don't fight over one list. Nested traversals stack their
+	// ranges on top of each other within a thread.
+	static thread_local TArray<intercept_t> intercepts;
 
 	divline_t trace;
 	double Startfrac;
 	unsigned int intercept_index;
-	unsigned int intercept_count;
+	unsigned int intercept_pos;
 	unsigned int count;
 
 	virtual void AddLineIntercepts(int bx, int by);
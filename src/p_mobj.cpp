@@ -137,6 +137,7 @@ IMPLEMENT_POINTY_CLASS (AActor)
  DECLARE_POINTER (goal)
  DECLARE_POINTER (LastLookActor)
  DECLARE_POINTER (Inventory)
+ DECLARE_POINTER (LastFoundInventory)
  DECLARE_POINTER (LastHeard)
  DECLARE_POINTER (master)
  DECLARE_POINTER (Poisoner)
@@ -812,6 +813,18 @@ AInventory *AActor::FindInventory (PClassActor *type, bool subclass)
 	{
 		return NULL;
 	}
+	if (!subclass)
+	{
+		// Check the result of the previous lookup first. Scripted checks
+		// tend to query the same few classes over and over, and a long
+		// inventory chain makes the list walk below expensive. The Owner
+		// check catches items that moved to another actor since then.
+		item = LastFoundInventory;
+		if (item != NULL && item->Owner == this && item->GetClass() == type)
+		{
+			return item;
+		}
+	}
 	for (item = Inventory; item != NULL; item = item->Inventory)
 	{
 		if (!subclass)
@@ -829,6 +842,10 @@ AInventory *AActor::FindInventory (PClassActor *type, bool subclass)
 			}
 		}
 	}
+	if (item != NULL && !subclass)
+	{
+		LastFoundInventory = item;
+	}
 	return item;
 }
 
@@ -1927,10 +1944,14 @@ double P_XYMovement (AActor *mo, DVector2 scroll)
 
 	FCheckPosition tm(!!(mo->flags2 & MF2_RIP));
 
+	// The compatibility flags cannot change during the move, so resolve the
+	// wallrun test once instead of in each step of the loop below.
+	const bool compat_wallrun = !!(i_compatflags & COMPATF_WALLRUN);
+
 	DAngle oldangle = mo->Angles.Yaw;
 	do
 	{
-		if (i_compatflags & COMPATF_WALLRUN) pushtime++;
+		if (compat_wallrun) pushtime++;
 		tm.PushTime = pushtime;
 
 		ptry = start + move * step / steps;
@@ -1966,7 +1987,7 @@ double P_XYMovement (AActor *mo, DVector2 scroll)
 					// actor's velocity, do not attempt to slide.
 					if (mo->Vel.XY() == startvel)
 					{
-						if (player && (i_compatflags & COMPATF_WALLRUN))
+						if (player && compat_wallrun)
 						{
 						// [RH] Here is the key to wall running: The move is clipped using its full speed.
 						// If the move is done a second time (because it was too fast for one move), it
@@ -1984,7 +2005,7 @@ double P_XYMovement (AActor *mo, DVector2 scroll)
 						}
 						else
 						{
-							if (!player || !(i_compatflags & COMPATF_WALLRUN))
+							if (!player || !compat_wallrun)
 							{
 								move = mo->Vel;
 								onestep = move / steps;
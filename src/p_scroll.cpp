@@ -185,26 +185,33 @@ void DScroller::Tick ()
 	if (dx == 0 && dy == 0)
 		return;
 
+	// Note that the offsets must be updated eagerly here: they are part of
+	// the playsim state (saved with the side and readable through ACS), so
+	// they cannot be accumulated as a velocity and resolved at render time.
+
 	switch (m_Type)
 	{
 		case EScroll::sc_side:					// killough 3/7/98: Scroll wall texture
+		{
+			side_t *side = &sides[m_Affectee];
 			if (m_Parts & EScrollPos::scw_top)
 			{
-				sides[m_Affectee].AddTextureXOffset(side_t::top, dx);
-				sides[m_Affectee].AddTextureYOffset(side_t::top, dy);
+				side->AddTextureXOffset(side_t::top, dx);
+				side->AddTextureYOffset(side_t::top, dy);
 			}
-			if (m_Parts & EScrollPos::scw_mid && (sides[m_Affectee].linedef->backsector == NULL ||
-				!(sides[m_Affectee].linedef->flags&ML_3DMIDTEX)))
+			if (m_Parts & EScrollPos::scw_mid && (side->linedef->backsector == NULL ||
+				!(side->linedef->flags&ML_3DMIDTEX)))
 			{
-				sides[m_Affectee].AddTextureXOffset(side_t::mid, dx);
-				sides[m_Affectee].AddTextureYOffset(side_t::mid, dy);
+				side->AddTextureXOffset(side_t::mid, dx);
+				side->AddTextureYOffset(side_t::mid, dy);
 			}
 			if (m_Parts & EScrollPos::scw_bottom)
 			{
-				sides[m_Affectee].AddTextureXOffset(side_t::bottom, dx);
-				sides[m_Affectee].AddTextureYOffset(side_t::bottom, dy);
+				side->AddTextureXOffset(side_t::bottom, dx);
+				side->AddTextureYOffset(side_t::bottom, dy);
 			}
 			break;
+		}
 
 		case EScroll::sc_floor:						// killough 3/7/98: Scroll floor texture
 			RotationComp(&sectors[m_Affectee], sector_t::floor, dx, dy, tdx, tdy);
@@ -373,6 +380,13 @@ DScroller::DScroller (double dx, double dy, const line_t *l,
 //
 // Initialize the scrollers
 //
+// Each scroller is its own thinker. Batching them into one object with a
+// flat array was considered for maps with thousands of scrolling sectors,
+// but rejected: every thinker is individually serialized into savegames
+// and ticked in list order, so merging them would break savegame
+// compatibility and reorder effects relative to other thinkers. The per
+// object cost is a virtual call and a few adds, which is not worth that.
+//
 //-----------------------------------------------------------------------------
 
 void P_SpawnScrollers(void)
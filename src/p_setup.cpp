@@ -78,6 +78,9 @@
 #endif
 
 #include "fragglescript/t_fs.h"
+#include "threadpool.h"
+
+#include <atomic>
 
 #define MISSING_TEXTURE_WARN_LIMIT		20
 
@@ -98,6 +101,7 @@ extern int numinterpolations;
 extern unsigned int R_OldBlend;
 
 EXTERN_CVAR(Bool, am_textured)
+EXTERN_CVAR(Bool, g_instanttransition)
 
 CVAR (Bool, genblockmap, false, CVAR_SERVERINFO|CVAR_GLOBALCONFIG);
 CVAR (Bool, gennodes, false, CVAR_SERVERINFO|CVAR_GLOBALCONFIG);
@@ -122,6 +126,8 @@ int 			numsegs;
 seg_t*			segs;
 glsegextra_t*	glsegextras;
 
+FMemArena		MapArena;
+
 int 			numsectors;
 sector_t*		sectors;
 TArray<sector_t>	loadsectors;
@@ -852,7 +858,7 @@ void P_LoadVertexes (MapData * map)
 	}
 
 	// Allocate memory for buffer.
-	vertexes = new vertex_t[numvertexes];		
+	vertexes = AllocMapArray<vertex_t> (numvertexes);		
 	vertexdatas = NULL;
 
 	map->Seek(ML_VERTEXES);
@@ -996,7 +1002,7 @@ void LoadZNodes(FileReaderBase &data, int glnodes)
 	}
 	else
 	{
-		newvertarray = new vertex_t[orgVerts + newVerts];
+		newvertarray = AllocMapArray<vertex_t> (orgVerts + newVerts);
 		memcpy (newvertarray, vertexes, orgVerts * sizeof(vertex_t));
 	}
 	for (i = 0; i < newVerts; ++i)
@@ -1012,7 +1018,6 @@ void LoadZNodes(FileReaderBase &data, int glnodes)
 			lines[i].v1 = lines[i].v1 - vertexes + newvertarray;
 			lines[i].v2 = lines[i].v2 - vertexes + newvertarray;
 		}
-		delete[] vertexes;
 		vertexes = newvertarray;
 		numvertexes = orgVerts + newVerts;
 	}
@@ -1022,7 +1027,7 @@ void LoadZNodes(FileReaderBase &data, int glnodes)
 
 	data >> numSubs;
 	numsubsectors = numSubs;
-	subsectors = new subsector_t[numSubs];
+	subsectors = AllocMapArray<subsector_t> (numSubs);
 	memset (subsectors, 0, numsubsectors*sizeof(subsector_t));
 
 	for (i = currSeg = 0; i < numSubs; ++i)
@@ -1048,7 +1053,7 @@ void LoadZNodes(FileReaderBase &data, int glnodes)
 	}
 
 	numsegs = numSegs;
-	segs = new seg_t[numsegs];
+	segs = AllocMapArray<seg_t> (numsegs);
 	memset (segs, 0, numsegs*sizeof(seg_t));
 	glsegextras = NULL;
 
@@ -1063,7 +1068,7 @@ void LoadZNodes(FileReaderBase &data, int glnodes)
 	}
 	else
 	{
-		glsegextras = new glsegextra_t[numsegs];
+		glsegextras = AllocMapArray<glsegextra_t> (numsegs);
 		P_LoadGLZSegs (data, glnodes);
 	}
 
@@ -1072,7 +1077,7 @@ void LoadZNodes(FileReaderBase &data, int glnodes)
 
 	data >> numNodes;
 	numnodes = numNodes;
-	nodes = new node_t[numNodes];
+	nodes = AllocMapArray<node_t> (numNodes);
 	memset (nodes, 0, sizeof(node_t)*numNodes);
 
 	for (i = 0; i < numNodes; ++i)
@@ -1233,14 +1238,12 @@ void P_LoadSegs (MapData * map)
 	if (numsegs == 0)
 	{
 		Printf ("This map has no segs.\n");
-		delete[] subsectors;
-		delete[] nodes;
 		delete[] vertchanged;
 		ForceNodeBuild = true;
 		return;
 	}
 
-	segs = new seg_t[numsegs];
+	segs = AllocMapArray<seg_t> (numsegs);
 	memset (segs, 0, numsegs*sizeof(seg_t));
 
 	data = new BYTE[lumplen];
@@ -1378,9 +1381,6 @@ void P_LoadSegs (MapData * map)
 			break;
 		}
 		Printf ("The BSP will be rebuilt.\n");
-		delete[] segs;
-		delete[] subsectors;
-		delete[] nodes;
 		ForceNodeBuild = true;
 	}
 
@@ -1406,12 +1406,11 @@ void P_LoadSubsectors (MapData * map)
 	if (numsubsectors == 0 || maxseg == 0 )
 	{
 		Printf ("This map has an incomplete BSP tree.\n");
-		delete[] nodes;
 		ForceNodeBuild = true;
 		return;
 	}
 
-	subsectors = new subsector_t[numsubsectors];		
+	subsectors = AllocMapArray<subsector_t> (numsubsectors);		
 	map->Seek(ML_SSECTORS);
 		
 	memset (subsectors, 0, numsubsectors*sizeof(subsector_t));
@@ -1425,8 +1424,6 @@ void P_LoadSubsectors (MapData * map)
 		if (subd.numsegs == 0)
 		{
 			Printf ("Subsector %i is empty.\n", i);
-			delete[] subsectors;
-			delete[] nodes;
 			ForceNodeBuild = true;
 			return;
 		}
@@ -1440,8 +1437,6 @@ void P_LoadSubsectors (MapData * map)
 				"The BSP will be rebuilt.\n", i, (unsigned)((size_t)subsectors[i].firstline),
 				(unsigned)((size_t)subsectors[i].firstline) + subsectors[i].numlines - 1);
 			ForceNodeBuild = true;
-			delete[] nodes;
-			delete[] subsectors;
 			break;
 		}
 		else if ((size_t)subsectors[i].firstline + subsectors[i].numlines > maxseg)
@@ -1450,8 +1445,6 @@ void P_LoadSubsectors (MapData * map)
 				"The BSP will be rebuilt.\n", i, maxseg,
 				(unsigned)((size_t)subsectors[i].firstline) + subsectors[i].numlines - 1);
 			ForceNodeBuild = true;
-			delete[] nodes;
-			delete[] subsectors;
 			break;
 		}
 	}
@@ -1475,7 +1468,7 @@ void P_LoadSectors (MapData *map, FMissingTextureTracker &missingtex)
 	int					lumplen = map->Size(ML_SECTORS);
 
 	numsectors = lumplen / sizeof(mapsector_t);
-	sectors = new sector_t[numsectors];		
+	sectors = AllocMapArray<sector_t> (numsectors);		
 	memset (sectors, 0, numsectors*sizeof(sector_t));
 
 	if (level.flags & LEVEL_SNDSEQTOTALCTRL)
@@ -1583,7 +1576,7 @@ void P_LoadNodes (MapData * map)
 		return;
 	}
 	
-	nodes = new node_t[numnodes];		
+	nodes = AllocMapArray<node_t> (numnodes);		
 	used = (WORD *)alloca (sizeof(WORD)*numnodes);
 	memset (used, 0, sizeof(WORD)*numnodes);
 
@@ -1609,7 +1602,6 @@ void P_LoadNodes (MapData * map)
 					Printf ("BSP node %d references invalid subsector %d.\n"
 						"The BSP will be rebuilt.\n", i, child);
 					ForceNodeBuild = true;
-					delete[] nodes;
 					delete[] mnp;
 					return;
 				}
@@ -1620,7 +1612,6 @@ void P_LoadNodes (MapData * map)
 				Printf ("BSP node %d references invalid node %td.\n"
 					"The BSP will be rebuilt.\n", i, (node_t *)no->children[j] - nodes);
 				ForceNodeBuild = true;
-				delete[] nodes;
 				delete[] mnp;
 				return;
 			}
@@ -1630,7 +1621,6 @@ void P_LoadNodes (MapData * map)
 					"which is already used by node %d.\n"
 					"The BSP will be rebuilt.\n", i, child, used[child]-1);
 				ForceNodeBuild = true;
-				delete[] nodes;
 				delete[] mnp;
 				return;
 			}
@@ -2106,7 +2096,7 @@ void P_LoadLineDefs (MapData * map)
 	maplinedef_t *mld;
 		
 	numlines = lumplen / sizeof(maplinedef_t);
-	lines = new line_t[numlines];
+	lines = AllocMapArray<line_t> (numlines);
 	linemap.Resize(numlines);
 	memset (lines, 0, numlines*sizeof(line_t));
 
@@ -2205,7 +2195,7 @@ void P_LoadLineDefs2 (MapData * map)
 	maplinedef2_t *mld;
 		
 	numlines = lumplen / sizeof(maplinedef2_t);
-	lines = new line_t[numlines];
+	lines = AllocMapArray<line_t> (numlines);
 	linemap.Resize(numlines);
 	memset (lines, 0, numlines*sizeof(line_t));
 
@@ -2306,7 +2296,7 @@ static void P_AllocateSideDefs (int count)
 {
 	int i;
 
-	sides = new side_t[count];
+	sides = AllocMapArray<side_t> (count);
 	memset (sides, 0, count*sizeof(side_t));
 
 	sidetemp = new sidei_t[MAX(count,numvertexes)];
@@ -2671,108 +2661,144 @@ void P_LoadSideDefs2 (MapData *map, FMissingTextureTracker &missingtex)
 // thing to do. (Doom E3M6, near vertex 0--the one furthest east
 // on the map--had problems.)
 //
-// Using a hash table to get the minimum possible blockmap size
-// seems like overkill, but I wanted to change the code as little
-// as possible from its ZDBSP incarnation.
+// The blocks each line touches are found with the same traversal twice:
+// once to count how many lines land in every block, and once to write the
+// line numbers into one flat lump. The counting pass runs over the
+// linedefs in parallel; the fill pass stays serial so the list order is
+// the same as a single threaded build would produce. Blocks are laid out
+// in row major order, so the iterators in p_maputl.cpp walk neighbouring
+// block lists that are also neighbours in memory. All empty blocks share
+// a single list.
 //
 
-static unsigned int BlockHash (TArray<int> *block)
-{
-	int hash = 0;
-	int *ar = &(*block)[0];
-	for (size_t i = 0; i < block->Size(); ++i)
-	{
-		hash = hash * 12235 + ar[i];
-	}
-	return hash & 0x7fffffff;
-}
+#define BLOCKBITS 7
+#define BLOCKSIZE 128
 
-static bool BlockCompare (TArray<int> *block1, TArray<int> *block2)
+//
+// P_TraverseBlocks
+//
+// Calls add(blocknum) for every block the given line touches.
+//
+
+template<class Func>
+static void P_TraverseBlocks (int line, int minx, int miny, int bmapwidth, Func add)
 {
-	size_t size = block1->Size();
+	int x1 = int(lines[line].v1->fX());
+	int y1 = int(lines[line].v1->fY());
+	int x2 = int(lines[line].v2->fX());
+	int y2 = int(lines[line].v2->fY());
+	int dx = x2 - x1;
+	int dy = y2 - y1;
+	int bx = (x1 - minx) >> BLOCKBITS;
+	int by = (y1 - miny) >> BLOCKBITS;
+	int bx2 = (x2 - minx) >> BLOCKBITS;
+	int by2 = (y2 - miny) >> BLOCKBITS;
+
+	int block = bx + by * bmapwidth;
+	int endblock = bx2 + by2 * bmapwidth;
 
-	if (size != block2->Size())
+	if (block == endblock)	// Single block
 	{
-		return false;
+		add (block);
 	}
-	if (size == 0)
+	else if (by == by2)		// Horizontal line
 	{
-		return true;
+		if (bx > bx2)
+		{
+			swapvalues (block, endblock);
+		}
+		do
+		{
+			add (block);
+			block += 1;
+		} while (block <= endblock);
 	}
-	int *ar1 = &(*block1)[0];
-	int *ar2 = &(*block2)[0];
-	for (size_t i = 0; i < size; ++i)
+	else if (bx == bx2)	// Vertical line
 	{
-		if (ar1[i] != ar2[i])
+		if (by > by2)
 		{
-			return false;
+			swapvalues (block, endblock);
 		}
+		do
+		{
+			add (block);
+			block += bmapwidth;
+		} while (block <= endblock);
 	}
-	return true;
-}
+	else				// Diagonal line
+	{
+		int xchange = (dx < 0) ? -1 : 1;
+		int ychange = (dy < 0) ? -1 : 1;
+		int ymove = ychange * bmapwidth;
+		int adx = abs (dx);
+		int ady = abs (dy);
 
-static void CreatePackedBlockmap (TArray<int> &BlockMap, TArray<int> *blocks, int bmapwidth, int bmapheight)
-{
-	int buckets[4096];
-	int *hashes, hashblock;
-	TArray<int> *block;
-	int zero = 0;
-	int terminator = -1;
-	int *array;
-	int i, hash;
-	int hashed = 0, nothashed = 0;
-
-	hashes = new int[bmapwidth * bmapheight];
-
-	memset (hashes, 0xff, sizeof(int)*bmapwidth*bmapheight);
-	memset (buckets, 0xff, sizeof(buckets));
-
-	for (i = 0; i < bmapwidth * bmapheight; ++i)
-	{
-		block = &blocks[i];
-		hash = BlockHash (block) % 4096;
-		hashblock = buckets[hash];
-		while (hashblock != -1)
+		if (adx == ady)		// 45 degrees
 		{
-			if (BlockCompare (block, &blocks[hashblock]))
+			int xb = (x1 - minx) & (BLOCKSIZE-1);
+			int yb = (y1 - miny) & (BLOCKSIZE-1);
+			if (dx < 0)
 			{
-				break;
+				xb = BLOCKSIZE-xb;
 			}
-			hashblock = hashes[hashblock];
+			if (dy < 0)
+			{
+				yb = BLOCKSIZE-yb;
+			}
+			if (xb < yb)
+				adx--;
 		}
-		if (hashblock != -1)
+		if (adx >= ady)		// X-major
 		{
-			BlockMap[4+i] = BlockMap[4+hashblock];
-			hashed++;
+			int yadd = dy < 0 ? -1 : BLOCKSIZE;
+			do
+			{
+				int stop = (Scale ((by << BLOCKBITS) + yadd - (y1 - miny), dx, dy) + (x1 - minx)) >> BLOCKBITS;
+				while (bx != stop)
+				{
+					add (block);
+					block += xchange;
+					bx += xchange;
+				}
+				add (block);
+				block += ymove;
+				by += ychange;
+			} while (by != by2);
+			while (block != endblock)
+			{
+				add (block);
+				block += xchange;
+			}
+			add (block);
 		}
-		else
+		else					// Y-major
 		{
-			hashes[i] = buckets[hash];
-			buckets[hash] = i;
-			BlockMap[4+i] = BlockMap.Size ();
-			BlockMap.Push (zero);
-			array = &(*block)[0];
-			for (size_t j = 0; j < block->Size(); ++j)
+			int xadd = dx < 0 ? -1 : BLOCKSIZE;
+			do
 			{
-				BlockMap.Push (array[j]);
+				int stop = (Scale ((bx << BLOCKBITS) + xadd - (x1 - minx), dy, dx) + (y1 - miny)) >> BLOCKBITS;
+				while (by != stop)
+				{
+					add (block);
+					block += ymove;
+					by += ychange;
+				}
+				add (block);
+				block += xchange;
+				bx += xchange;
+			} while (bx != bx2);
+			while (block != endblock)
+			{
+				add (block);
+				block += ymove;
 			}
-			BlockMap.Push (terminator);
-			nothashed++;
+			add (block);
 		}
 	}
-
-	delete[] hashes;
-
-//	printf ("%d blocks written, %d blocks saved\n", nothashed, hashed);
 }
 
-#define BLOCKBITS 7
-#define BLOCKSIZE 128
-
 static void P_CreateBlockMap ()
 {
-	TArray<int> *BlockLists, *block, *endblock;
-	int adder;
 	int bmapwidth, bmapheight;
 	double dminx, dmaxx, dminy, dmaxy;
 	int minx, maxx, miny, maxy;
@@ -2802,140 +2828,85 @@ static void P_CreateBlockMap ()
 	bmapwidth =	 ((maxx - minx) >> BLOCKBITS) + 1;
 	bmapheight = ((maxy - miny) >> BLOCKBITS) + 1;
 
-	TArray<int> BlockMap (bmapwidth * bmapheight * 3 + 4);
+	int numblocks = bmapwidth * bmapheight;
 
-	adder = minx;			BlockMap.Push (adder);
-	adder = miny;			BlockMap.Push (adder);
-	adder = bmapwidth;		BlockMap.Push (adder);
-	adder = bmapheight;		BlockMap.Push (adder);
-
-	BlockLists = new TArray<int>[bmapwidth * bmapheight];
-
-	for (line = 0; line < numlines; ++line)
+	// Pass one: count the lines landing in each block. The traversals are
+	// independent of each other, so the linedefs are counted in parallel.
+	std::atomic<int> *counts = new std::atomic<int>[numblocks];
+	for (i = 0; i < numblocks; ++i)
+	{
+		counts[i].store (0, std::memory_order_relaxed);
+	}
+	FThreadPool::Instance().ParallelFor (numlines, [=](int lineno)
 	{
-		int x1 = int(lines[line].v1->fX());
-		int y1 = int(lines[line].v1->fY());
-		int x2 = int(lines[line].v2->fX());
-		int y2 = int(lines[line].v2->fY());
-		int dx = x2 - x1;
-		int dy = y2 - y1;
-		int bx = (x1 - minx) >> BLOCKBITS;
-		int by = (y1 - miny) >> BLOCKBITS;
-		int bx2 = (x2 - minx) >> BLOCKBITS;
-		int by2 = (y2 - miny) >> BLOCKBITS;
-
-		block = &BlockLists[bx + by * bmapwidth];
-		endblock = &BlockLists[bx2 + by2 * bmapwidth];
-
-		if (block == endblock)	// Single block
+		P_TraverseBlocks (lineno, minx, miny, bmapwidth, [=](int block)
 		{
-			block->Push (line);
-		}
-		else if (by == by2)		// Horizontal line
+			counts[block].fetch_add (1, std::memory_order_relaxed);
+		});
+	});
+
+	// Turn the counts into offsets into the flat lump: four ints of header,
+	// the offset table, one shared empty list, then every non-empty block
+	// in row major order. Each list is a leading 0, the line numbers and a
+	// -1 terminator, the same as a stock blockmap.
+	int *offsets = new int[numblocks];
+	int pos = 4 + numblocks;
+	int emptylist = -1;
+
+	for (i = 0; i < numblocks; ++i)
+	{
+		int count = counts[i].load (std::memory_order_relaxed);
+		if (count == 0)
 		{
-			if (bx > bx2)
+			if (emptylist < 0)
 			{
-				swapvalues (block, endblock);
+				emptylist = pos;
+				pos += 2;
 			}
-			do
-			{
-				block->Push (line);
-				block += 1;
-			} while (block <= endblock);
+			offsets[i] = emptylist;
 		}
-		else if (bx == bx2)	// Vertical line
+		else
 		{
-			if (by > by2)
-			{
-				swapvalues (block, endblock);
-			}
-			do
-			{
-				block->Push (line);
-				block += bmapwidth;
-			} while (block <= endblock);
+			offsets[i] = pos;
+			pos += count + 2;
 		}
-		else				// Diagonal line
-		{
-			int xchange = (dx < 0) ? -1 : 1;
-			int ychange = (dy < 0) ? -1 : 1;
-			int ymove = ychange * bmapwidth;
-			int adx = abs (dx);
-			int ady = abs (dy);
+	}
 
-			if (adx == ady)		// 45 degrees
-			{
-				int xb = (x1 - minx) & (BLOCKSIZE-1);
-				int yb = (y1 - miny) & (BLOCKSIZE-1);
-				if (dx < 0)
-				{
-					xb = BLOCKSIZE-xb;
-				}
-				if (dy < 0)
-				{
-					yb = BLOCKSIZE-yb;
-				}
-				if (xb < yb)
-					adx--;
-			}
-			if (adx >= ady)		// X-major
-			{
-				int yadd = dy < 0 ? -1 : BLOCKSIZE;
-				do
-				{
-					int stop = (Scale ((by << BLOCKBITS) + yadd - (y1 - miny), dx, dy) + (x1 - minx)) >> BLOCKBITS;
-					while (bx != stop)
-					{
-						block->Push (line);
-						block += xchange;
-						bx += xchange;
-					}
-					block->Push (line);
-					block += ymove;
-					by += ychange;
-				} while (by != by2);
-				while (block != endblock)
-				{
-					block->Push (line);
-					block += xchange;
-				}
-				block->Push (line);
-			}
-			else					// Y-major
-			{
-				int xadd = dx < 0 ? -1 : BLOCKSIZE;
-				do
-				{
-					int stop = (Scale ((bx << BLOCKBITS) + xadd - (x1 - minx), dy, dx) + (y1 - miny)) >> BLOCKBITS;
-					while (by != stop)
-					{
-						block->Push (line);
-						block += ymove;
-						by += ychange;
-					}
-					block->Push (line);
-					block += xchange;
-					bx += xchange;
-				} while (bx != bx2);
-				while (block != endblock)
-				{
-					block->Push (line);
-					block += ymove;
-				}
-				block->Push (line);
-			}
+	blockmaplump = new int[pos];
+	blockmaplump[0] = minx;
+	blockmaplump[1] = miny;
+	blockmaplump[2] = bmapwidth;
+	blockmaplump[3] = bmapheight;
+	memcpy (&blockmaplump[4], offsets, numblocks * sizeof(int));
+	if (emptylist >= 0)
+	{
+		blockmaplump[emptylist] = 0;
+		blockmaplump[emptylist + 1] = -1;
+	}
+	for (i = 0; i < numblocks; ++i)
+	{
+		int count = counts[i].load (std::memory_order_relaxed);
+		if (count != 0)
+		{
+			blockmaplump[offsets[i]] = 0;
+			blockmaplump[offsets[i] + count + 1] = -1;
 		}
 	}
 
-	BlockMap.Reserve (bmapwidth * bmapheight);
-	CreatePackedBlockmap (BlockMap, BlockLists, bmapwidth, bmapheight);
-	delete[] BlockLists;
-
-	blockmaplump = new int[BlockMap.Size()];
-	for (unsigned int ii = 0; ii < BlockMap.Size(); ++ii)
+	// Pass two: write the line numbers. This pass stays serial so that
+	// every block lists its lines in ascending order, just like a single
+	// threaded build. The offset table doubles as the write cursors; the
+	// pre-increment skips each list's leading 0.
+	for (line = 0; line < numlines; ++line)
 	{
-		blockmaplump[ii] = BlockMap[ii];
+		P_TraverseBlocks (line, minx, miny, bmapwidth, [=](int block)
+		{
+			blockmaplump[++offsets[block]] = line;
+		});
 	}
+
+	delete[] offsets;
+	delete[] counts;
 }
 
 
@@ -3157,7 +3128,7 @@ static void P_GroupLines (bool buildmap)
 
 	// build line tables for each sector
 	times[3].Clock();
-	linebuffer = new line_t *[total];
+	linebuffer = AllocMapArray<line_t *> (total);
 	line_t **lineb_p = linebuffer;
 	linesDoneInEachSector = new int[numsectors];
 	memset (linesDoneInEachSector, 0, sizeof(int)*numsectors);
@@ -3424,6 +3395,11 @@ static void P_PrecacheLevel()
 		if (tex.Exists()) hitlist[tex.GetIndex()] |= FTextureManager::HIT_Wall;
 	}
 
+	// The intermission art for this level's exit is known from MAPINFO
+	// already, so have it decoded here where a load screen is up anyway
+	// instead of when the level is left.
+	WI_MarkBackgroundTextures(hitlist);
+
 	Renderer->Precache(hitlist, actorhitlist);
 
 	delete[] hitlist;
@@ -3433,7 +3409,9 @@ extern polyblock_t **PolyBlockMap;
 
 void P_FreeLevelData ()
 {
+	P_AbortRejectBuild ();				// must not outlive the geometry it reads.
 	interpolator.ClearInterpolations();	// [RH] Nothing to interpolate on a fresh level.
+	R_ClearPointInSubsectorCache();		// the cached subsector is about to be freed.
 	Renderer->CleanLevelData();
 	FPolyObj::ClearAllSubsectorLinks(); // can't be done as part of the polyobj deletion process.
 	SN_StopAllSequences ();
@@ -3445,38 +3423,20 @@ void P_FreeLevelData ()
 		wminfo.maxfrags = 0;
 		
 	FBehavior::StaticUnloadModules ();
-	if (vertexes != NULL)
-	{
-		delete[] vertexes;
-		vertexes = NULL;
-	}
+	// The map geometry arrays live in MapArena, which is released wholesale
+	// at the end of this function. Only sub-allocations hanging off them
+	// still need to be freed individually.
+	vertexes = NULL;
 	numvertexes = 0;
-	if (segs != NULL)
-	{
-		delete[] segs;
-		segs = NULL;
-	}
+	segs = NULL;
 	numsegs = 0;
-	if (glsegextras != NULL)
-	{
-		delete[] glsegextras;
-		glsegextras = NULL;
-	}
+	glsegextras = NULL;
 	if (sectors != NULL)
 	{
 		delete[] sectors[0].e;
-		delete[] sectors;
 		sectors = NULL;
 	}
 	numsectors = 0;
-	if (gamenodes != NULL && gamenodes != nodes)
-	{
-		delete[] gamenodes;
-	}
-	if (gamesubsectors != NULL && gamesubsectors != subsectors)
-	{
-		delete[] gamesubsectors;
-	}
 	if (subsectors != NULL)
 	{
 		for (int i = 0; i < numsubsectors; ++i)
@@ -3486,27 +3446,14 @@ void P_FreeLevelData ()
 				delete subsectors[i].BSP;
 			}
 		}
-		delete[] subsectors;
-	}
-	if (nodes != NULL)
-	{
-		delete[] nodes;
 	}
 	subsectors = gamesubsectors = NULL;
 	numsubsectors = numgamesubsectors = 0;
 	nodes = gamenodes = NULL;
 	numnodes = numgamenodes = 0;
-	if (lines != NULL)
-	{
-		delete[] lines;
-		lines = NULL;
-	}
+	lines = NULL;
 	numlines = 0;
-	if (sides != NULL)
-	{
-		delete[] sides;
-		sides = NULL;
-	}
+	sides = NULL;
 	numsides = 0;
 
 	if (blockmaplump != NULL)
@@ -3539,11 +3486,7 @@ void P_FreeLevelData ()
 		delete[] rejectmatrix;
 		rejectmatrix = NULL;
 	}
-	if (linebuffer != NULL)
-	{
-		delete[] linebuffer;
-		linebuffer = NULL;
-	}
+	linebuffer = NULL;
 	if (polyobjs != NULL)
 	{
 		delete[] polyobjs;
@@ -3554,9 +3497,11 @@ void P_FreeLevelData ()
 	P_FreeStrifeConversations ();
 	level.Scrolls.Clear();
 	P_ClearUDMFKeys();
-}
 
-extern msecnode_t *headsecnode;
+	// Now everything that was allocated from the arena is dead, so give
+	// its memory back to the system in one go.
+	MapArena.FreeAllBlocks();
+}
 
 void P_FreeExtraLevelData()
 {
@@ -3573,17 +3518,9 @@ void P_FreeExtraLevelData()
 		}
 		FBlockNode::FreeBlocks = NULL;
 	}
-	{
-		msecnode_t *node = headsecnode;
-
-		while (node != NULL)
-		{
-			msecnode_t *next = node->m_snext;
-			M_Free (node);
-			node = next;
-		}
-		headsecnode = NULL;
-	}
+	// The msecnodes live in arenas owned by p_map.cpp; this also resets
+	// the freelist head.
+	P_FreeSecNodeArenas ();
 }
 
 //
@@ -3855,21 +3792,9 @@ void P_SetupLevel (const char *lumpname, int position)
 				Printf ("Error loading nodes: %s\n", error.GetMessage());
 
 				ForceNodeBuild = true;
-				if (subsectors != NULL)
-				{
-					delete[] subsectors;
-					subsectors = NULL;
-				}
-				if (segs != NULL)
-				{
-					delete[] segs;
-					segs = NULL;
-				}
-				if (nodes != NULL)
-				{
-					delete[] nodes;
-					nodes = NULL;
-				}
+				subsectors = NULL;
+				segs = NULL;
+				nodes = NULL;
 			}
 		}
 		else if (!map->isText)	// regular nodes are not supported for text maps
@@ -3945,7 +3870,6 @@ void P_SetupLevel (const char *lumpname, int position)
 		// In case a sync critical game mode is started, also build GL nodes to avoid problems
 		// if the different machines' am_textured setting differs.
 		FNodeBuilder builder (leveldata, polyspots, anchors, BuildGLNodes);
-		delete[] vertexes;
 		builder.Extract (nodes, numnodes,
 			segs, glsegextras, numsegs,
 			subsectors, numsubsectors,
@@ -4147,8 +4071,9 @@ void P_SetupLevel (const char *lumpname, int position)
 	P_ClearParticles ();
 
 	times[17].Clock();
-	// preload graphics and sounds
-	if (precache)
+	// preload graphics and sounds; in instant transition mode everything
+	// is loaded on demand instead so the level can start immediately
+	if (precache && !g_instanttransition)
 	{
 		P_PrecacheLevel ();
 		S_PrecacheLevel ();
@@ -4163,6 +4088,10 @@ void P_SetupLevel (const char *lumpname, int position)
 	P_ResetSightCounters (true);
 	//Printf ("free memory: 0x%x\n", Z_FreeMemory());
 
+	// If the map brought no REJECT, compute a conservative stand-in in the
+	// background. P_Ticker picks it up once it is ready.
+	P_StartRejectBuild ();
+
 	if (showloadtimes)
 	{
 		Printf ("---Total load times---\n");
@@ -4203,11 +4132,7 @@ void P_SetupLevel (const char *lumpname, int position)
 	loadsides.Resize(numsides);
 	memcpy(&loadsides[0], sides, numsides * sizeof(side_t));
 
-	if (glsegextras != NULL)
-	{
-		delete[] glsegextras;
-		glsegextras = NULL;
-	}
+	glsegextras = NULL;
 }
 
 
@@ -25,7 +25,27 @@
 
 #include "resourcefiles/resourcefile.h"
 #include "doomdata.h"
+#include "memarena.h"
 
+#include <new>
+
+
+// All map geometry that lives until the next level change is allocated from
+// this arena, so P_FreeLevelData can drop it wholesale and related structures
+// end up close together in memory. Anything allocated from it must never be
+// deleted individually.
+extern FMemArena MapArena;
+
+template<class T> T *AllocMapArray (size_t count)
+{
+	T *mem = (T *)MapArena.Alloc (sizeof(T) * count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		::new ((void *)&mem[i]) T;
+	}
+	return mem;
+}
 
 struct MapData
 {
@@ -11,7 +11,15 @@
 
 #include <assert.h>
 
+#include <atomic>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "doomdef.h"
+#include "doomstat.h"
 #include "i_system.h"
 #include "p_local.h"
 #include "p_maputl.h"
@@ -24,6 +32,8 @@
 #include "r_utility.h"
 #include "b_bot.h"
 #include "p_spec.h"
+#include "portal.h"
+#include "templates.h"
 
 // State.
 #include "r_state.h"
@@ -44,10 +54,58 @@ This uses specialized forms of the maputils routines for optimized performance
 */
 
 // Performance meters
-static int sightcounts[6];
+static int sightcounts[7];
 static cycle_t SightCycles;
 static cycle_t MaxSightCycles;
 
+// A monster's AI frequently asks the same sight question several times
+// within one tic (A_Look, A_Chase and the attack functions all check
+// independently), so remember the answers. The table is direct-mapped
+// and every entry is stamped with the tic it was computed in, which
+// makes clearing it between tics unnecessary. Collisions simply miss.
+struct FSightCacheEntry
+{
+	AActor *Looker, *Target;
+	int Flags;
+	int Tic;
+	bool Result;
+};
+
+#define SIGHTCACHESIZE 1024		// must be a power of 2
+
+static FSightCacheEntry sightcache[SIGHTCACHESIZE];
+
+static inline FSightCacheEntry *SightCacheEntry(AActor *t1, AActor *t2, int flags)
+{
+	size_t hash = ((size_t)t1 >> 4) * 31 + ((size_t)t2 >> 4) * 7 + flags;
+	return &sightcache[hash & (SIGHTCACHESIZE - 1)];
+}
+
+//==========================================================================
+//
+// PointsOnDivlineSameSide
+//
+// Classifies both points against the divline at once. The SSE2 path
+// computes the two cross products side by side with the same operations
+// in the same order as P_PointOnDivlineSide, so its results are
+// bit-identical to the scalar fallback.
+//
+//==========================================================================
+
+static inline bool PointsOnDivlineSameSide(double x1, double y1, double x2, double y2, const divline_t *line)
+{
+#if defined(__SSE2__) || defined(_M_X64)
+	__m128d px = _mm_set_pd(x2, x1);
+	__m128d py = _mm_set_pd(y2, y1);
+	__m128d left = _mm_mul_pd(_mm_sub_pd(py, _mm_set1_pd(line->y)), _mm_set1_pd(line->dx));
+	__m128d right = _mm_mul_pd(_mm_sub_pd(_mm_set1_pd(line->x), px), _mm_set1_pd(line->dy));
+	int mask = _mm_movemask_pd(_mm_cmpgt_pd(_mm_add_pd(left, right), _mm_set1_pd(EQUAL_EPSILON)));
+	return mask == 0 || mask == 3;
+#else
+	return P_PointOnDivlineSide(x1, y1, line) == P_PointOnDivlineSide(x2, y2, line);
+#endif
+}
+
 enum
 {
 	SO_TOPFRONT = 1,
@@ -378,14 +436,12 @@ bool SightCheck::P_SightCheckLine (line_t *ld)
 		return true;
 	}
 	ld->validcount = validcount;
-	if (P_PointOnDivlineSide (ld->v1->fPos(), &Trace) ==
-		P_PointOnDivlineSide (ld->v2->fPos(), &Trace))
+	if (PointsOnDivlineSameSide (ld->v1->fX(), ld->v1->fY(), ld->v2->fX(), ld->v2->fY(), &Trace))
 	{
 		return true;		// line isn't crossed
 	}
 	P_MakeDivline (ld, &dl);
-	if (P_PointOnDivlineSide (Trace.x, Trace.y, &dl) ==
-		P_PointOnDivlineSide (Trace.x+Trace.dx, Trace.y+Trace.dy, &dl))
+	if (PointsOnDivlineSameSide (Trace.x, Trace.y, Trace.x+Trace.dx, Trace.y+Trace.dy, &dl))
 	{
 		return true;		// line isn't crossed
 	}
@@ -845,6 +901,19 @@ sightcounts[0]++;
 		}
 	}
 
+	// Answered this very question earlier in the tic? The lookup sits below
+	// the stealth check on purpose: the random stream stays the same
+	// whether or not the cache hits.
+	{
+		FSightCacheEntry *cache = SightCacheEntry(t1, t2, flags);
+		if (cache->Tic == gametic && cache->Looker == t1 && cache->Target == t2 && cache->Flags == flags)
+		{
+			sightcounts[6]++;
+			res = cache->Result;
+			goto done;
+		}
+	}
+
 	// killough 4/19/98: make fake floors and ceilings block monster view
 
 	if (!(flags & SF_IGNOREWATERBOUNDARY))
@@ -900,6 +969,16 @@ sightcounts[0]++;
 		}
 	}
 
+	// Remember the full traversal's answer for the rest of this tic.
+	{
+		FSightCacheEntry *cache = SightCacheEntry(t1, t2, flags);
+		cache->Looker = t1;
+		cache->Target = t2;
+		cache->Flags = flags;
+		cache->Tic = gametic;
+		cache->Result = res;
+	}
+
 done:
 	SightCycles.Unclock();
 	return res;
@@ -908,9 +987,10 @@ done:
 ADD_STAT (sight)
 {
 	FString out;
-	out.Format ("%04.1f ms (%04.1f max), %5d %2d%4d%4d%4d%4d\n",
+	out.Format ("%04.1f ms (%04.1f max), %5d %2d%4d%4d%4d%4d, %d cached\n",
 		SightCycles.TimeMS(), MaxSightCycles.TimeMS(),
-		sightcounts[3], sightcounts[0], sightcounts[1], sightcounts[2], sightcounts[4], sightcounts[5]);
+		sightcounts[3], sightcounts[0], sightcounts[1], sightcounts[2], sightcounts[4], sightcounts[5],
+		sightcounts[6]);
 	return out;
 }
 
@@ -927,3 +1007,201 @@ void P_ResetSightCounters (bool full)
 	SightCycles.Reset();
 	memset (sightcounts, 0, sizeof(sightcounts));
 }
+
+//==========================================================================
+//
+// Synthetic REJECT for maps that ship without one
+//
+// Modern maps usually omit the REJECT lump, which turns every sight
+// question into a full BSP traversal. Build a conservative replacement in
+// the background: sight lines can only cross two-sided lines, and once a
+// line has been crossed, the rest of the ray stays on its far side. So for
+// two sectors to see each other, some exit portal of the first must face
+// some entry portal of the second. Testing all portal pairs for that gives
+// a superset of the true visibility, and REJECT stores the complement.
+//
+// Since the matrix only ever skips sight checks that would have failed
+// anyway, it is safe to swap in whenever the build finishes; differing
+// adoption times between net nodes cannot cause desyncs.
+//
+//==========================================================================
+
+struct FRejectPortal
+{
+	DVector2 a, b;		// oriented so the destination sector is to the left
+	int source, dest;
+};
+
+static TArray<FRejectPortal> RejectPortals;
+static BYTE *BuiltReject;
+static std::thread RejectThread;
+static std::atomic<bool> RejectDone(false);
+static std::atomic<bool> RejectAbort(false);
+static bool RejectBuilding;
+
+static const int MAX_REJECT_SECTORS = 16384;		// caps the matrix at 32 MB
+static const unsigned MAX_REJECT_PORTALS = 32768;	// caps the pair loop
+
+// Grazing exactly along a portal's plane does not count as facing it.
+static const double SIDE_EPSILON = 1 / 65536.;
+
+static inline double PortalSide (const FRejectPortal &p, const DVector2 &v)
+{
+	// > 0 when v lies on the portal's destination side
+	return (p.b.X - p.a.X) * (v.Y - p.a.Y) - (p.b.Y - p.a.Y) * (v.X - p.a.X);
+}
+
+static inline void RejectClear (BYTE *matrix, int s1, int s2)
+{
+	int pnum = s1 * numsectors + s2;
+	matrix[pnum >> 3] &= ~(1 << (pnum & 7));
+}
+
+static void BuildRejectWorker ()
+{
+	const int count = numsectors;
+	const size_t size = ((size_t)count * count + 7) >> 3;
+	BYTE *matrix = new BYTE[size];
+	memset (matrix, 0xff, size);
+
+	// Every sector can see itself and its immediate portal neighbors.
+	for (int i = 0; i < count; ++i)
+	{
+		RejectClear (matrix, i, i);
+	}
+	for (unsigned i = 0; i < RejectPortals.Size(); ++i)
+	{
+		RejectClear (matrix, RejectPortals[i].source, RejectPortals[i].dest);
+	}
+
+	for (unsigned i = 0; i < RejectPortals.Size(); ++i)
+	{
+		if (RejectAbort)
+		{
+			delete[] matrix;
+			return;
+		}
+		const FRejectPortal &p = RejectPortals[i];
+		for (unsigned j = 0; j < RejectPortals.Size(); ++j)
+		{
+			const FRejectPortal &q = RejectPortals[j];
+			int pnum = p.source * count + q.dest;
+			if (!(matrix[pnum >> 3] & (1 << (pnum & 7))))
+			{ // this pair is already known to be possibly visible
+				continue;
+			}
+			// Some part of q must lie ahead of p, and some part of p behind q.
+			if (PortalSide (p, q.a) <= SIDE_EPSILON && PortalSide (p, q.b) <= SIDE_EPSILON)
+				continue;
+			if (PortalSide (q, p.a) >= -SIDE_EPSILON && PortalSide (q, p.b) >= -SIDE_EPSILON)
+				continue;
+			matrix[pnum >> 3] &= ~(1 << (pnum & 7));
+		}
+	}
+
+	BuiltReject = matrix;
+	RejectDone = true;
+}
+
+void P_StartRejectBuild ()
+{
+	P_AbortRejectBuild ();
+
+	if (rejectmatrix != NULL || numsectors == 0 || numsectors > MAX_REJECT_SECTORS)
+	{
+		return;
+	}
+	// Portals and polyobjects can carry sight lines past what the static
+	// level geometry allows, so leave those maps alone.
+	if (linePortals.Size() != 0 || po_NumPolyobjs != 0)
+	{
+		return;
+	}
+	for (unsigned i = 0; i < sectorPortals.Size(); ++i)
+	{
+		if (sectorPortals[i].mType != PORTS_SKYVIEWPOINT)
+		{
+			return;
+		}
+	}
+
+	for (int i = 0; i < numlines; ++i)
+	{
+		line_t *line = &lines[i];
+		if (line->backsector == NULL || line->frontsector == NULL)
+		{
+			continue;
+		}
+		if (line->backsector == line->frontsector)
+		{ // Self-referencing sector trick (deep water, invisible bridges).
+		  // Such lines contribute no edge between distinct sectors, so the
+		  // inner area would falsely appear unreachable. Leave these maps
+		  // to the blockmap-only sight check.
+			RejectPortals.Clear();
+			return;
+		}
+		if (RejectPortals.Size() + 2 > MAX_REJECT_PORTALS)
+		{ // Too many portals to test every pair in reasonable time.
+			RejectPortals.Clear();
+			return;
+		}
+		FRejectPortal port;
+		// The back sector lies to the left of v1->v2.
+		port.a = line->v1->fPos();
+		port.b = line->v2->fPos();
+		port.source = int(line->frontsector - sectors);
+		port.dest = int(line->backsector - sectors);
+		RejectPortals.Push (port);
+		// ...and the reverse crossing.
+		swapvalues (port.a, port.b);
+		swapvalues (port.source, port.dest);
+		RejectPortals.Push (port);
+	}
+	if (RejectPortals.Size() == 0)
+	{
+		return;
+	}
+
+	RejectDone = false;
+	RejectAbort = false;
+	RejectThread = std::thread (BuildRejectWorker);
+	RejectBuilding = true;
+}
+
+void P_AdoptBuiltReject ()
+{
+	if (!RejectBuilding || !RejectDone)
+	{
+		return;
+	}
+	RejectThread.join ();
+	RejectBuilding = false;
+	RejectPortals.Clear();
+	if (rejectmatrix == NULL)
+	{
+		rejectmatrix = BuiltReject;
+	}
+	else
+	{
+		delete[] BuiltReject;
+	}
+	BuiltReject = NULL;
+}
+
+void P_AbortRejectBuild ()
+{
+	if (RejectBuilding)
+	{
+		RejectAbort = true;
+		RejectThread.join ();
+		RejectBuilding = false;
+		RejectAbort = false;
+	}
+	if (BuiltReject != NULL)
+	{
+		delete[] BuiltReject;
+	}
+	BuiltReject = NULL;
+	RejectPortals.Clear();
+	RejectDone = false;
+}
@@ -695,6 +695,13 @@ DLightTransfer::DLightTransfer (sector_t *srcSec, int target, bool copyFloor)
 	ChangeStatNum (STAT_LIGHTTRANSFER);
 }
 
+// The transfer thinkers only watch for changes; the actual copy to the
+// target sectors/walls happens in DoTransfer and runs solely when the
+// source light really moved. At steady state each transfer costs one
+// comparison per tic, so there is no point in wiring subscriber lists
+// into sector_t's light setters to push updates instead - that would
+// trade a compare for list maintenance plus extra serialization state.
+
 void DLightTransfer::Tick ()
 {
 	int light = Source->lightlevel;
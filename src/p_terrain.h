@@ -42,6 +42,11 @@ class PClass;
 extern WORD DefaultTerrainType;
 
 
+// This is already the dense texture-to-terrain table: it is filled once
+// after TERRAIN parsing and indexed directly by texture id, so the splash
+// code in P_HitWater never touches a hash or a name lookup per impact.
+// P_FindTerrain's linear name search only runs at parse time (UDMF, EDF,
+// DECORATE), from ACS and when restoring a savegame.
 class FTerrainTypeArray
 {
 public:
@@ -35,6 +35,7 @@
 #include "g_level.h"
 #include "r_utility.h"
 #include "p_spec.h"
+#include "profiler.h"
 
 extern gamestate_t wipegamestate;
 
@@ -73,9 +74,13 @@ void P_Ticker (void)
 {
 	int i;
 
+	PROF_ZONE ("playsim");
 	interpolator.UpdateInterpolations ();
 	r_NoInterpolate = true;
 
+	// Pick up the background-built sight rejection matrix when it is done.
+	P_AdoptBuiltReject ();
+
 	if (!demoplayback)
 	{
 		// This is a separate slot from the wipe in D_Display(), because this
@@ -126,7 +131,10 @@ void P_Ticker (void)
 
 	StatusBar->Tick ();		// [RH] moved this here
 	level.Tick ();			// [RH] let the level tick
-	DThinker::RunThinkers ();
+	{
+		PROF_ZONE ("thinkers");
+		DThinker::RunThinkers ();
+	}
 
 	//if added by MC: Freeze mode.
 	if (!bglobal.freeze && !(level.flags2 & LEVEL2_FROZEN))
@@ -757,12 +757,14 @@ bool FTraceInfo::TraceTraverse (int ptflags)
 
 	FPathTraverse it(Start.X, Start.Y, Vec.X * MaxDist, Vec.Y * MaxDist, ptflags | PT_DELTA, startfrac);
 	intercept_t *in;
-	int lastsplashsector = -1;
+	// Setup3DFloors already checked the starting sector for 3D water.
+	int lastsplashsector = CurSector->sectornum;
 
 	while ((in = it.Next()))
 	{
 		// Deal with splashes in 3D floors (but only run once per sector, not each iteration - and stop if something was found.)
-		if (Results->Crossed3DWater == NULL && lastsplashsector != CurSector->sectornum)
+		if (Results->Crossed3DWater == NULL && lastsplashsector != CurSector->sectornum &&
+			CurSector->e->XFloor.ffloors.Size())
 		{
 			for (auto rover : CurSector->e->XFloor.ffloors)
 			{
@@ -1791,8 +1791,8 @@ public:
 		}
 		numlines = ParsedLines.Size();
 		numsides = sidecount;
-		lines = new line_t[numlines];
-		sides = new side_t[numsides];
+		lines = AllocMapArray<line_t> (numlines);
+		sides = AllocMapArray<side_t> (numsides);
 		int line, side;
 
 		for(line = 0, side = 0; line < numlines; line++)
@@ -1844,15 +1844,22 @@ public:
 
 	void ParseTextMap(MapData *map)
 	{
-		char *buffer = new char[map->Size(ML_TEXTMAP)];
+		int size = map->Size(ML_TEXTMAP);
+		FString buffer;
 
 		isTranslated = true;
 		isExtended = false;
 		floordrop = false;
 
-		map->Read(ML_TEXTMAP, buffer);
-		sc.OpenMem(Wads.GetLumpFullName(map->lumpnum), buffer, map->Size(ML_TEXTMAP));
-		delete [] buffer;
+		// Read the lump straight into the scanner's buffer, with the
+		// trailing '\n' the scanner requires already in place, so that
+		// neither OpenString nor PrepareScript has to copy the data
+		// again. That matters for multi-megabyte TEXTMAP lumps.
+		char *bufptr = buffer.LockNewBuffer(size + 1);
+		map->Read(ML_TEXTMAP, bufptr, size);
+		bufptr[size] = '\n';
+		buffer.UnlockBuffer();
+		sc.OpenString(Wads.GetLumpFullName(map->lumpnum), buffer);
 		sc.SetCMode(true);
 		if (sc.CheckString("namespace"))
 		{
@@ -1986,7 +1993,7 @@ public:
 
 		// Create the real vertices
 		numvertexes = ParsedVertices.Size();
-		vertexes = new vertex_t[numvertexes];
+		vertexes = AllocMapArray<vertex_t> (numvertexes);
 		memcpy(vertexes, &ParsedVertices[0], numvertexes * sizeof(*vertexes));
 
 		// Create the real vertex datas
@@ -1996,7 +2003,7 @@ public:
 
 		// Create the real sectors
 		numsectors = ParsedSectors.Size();
-		sectors = new sector_t[numsectors];
+		sectors = AllocMapArray<sector_t> (numsectors);
 		memcpy(sectors, &ParsedSectors[0], numsectors * sizeof(*sectors));
 		sectors[0].e = new extsector_t[numsectors];
 		for(int i = 0; i < numsectors; i++)
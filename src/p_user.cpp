@@ -91,6 +91,9 @@ struct PredictPos
 } static PredictionLerpFrom, PredictionLerpResult, PredictionLast;
 static int PredictionLerptics;
 
+static int PredictionGametic;	// the authoritative tic the current prediction started from
+static int PredictionMaxtic;	// the last tic the current prediction has simulated
+
 static player_t PredictionPlayerBackup;
 static BYTE PredictionActorBackup[sizeof(APlayerPawn)];
 static TArray<sector_t *> PredictionTouchingSectorsBackup;
@@ -2740,9 +2743,8 @@ void P_PredictPlayer (player_t *player)
 		player->mo == NULL ||
 		player != &players[consoleplayer] ||
 		player->playerstate != PST_LIVE ||
-		!netgame ||
-		/*player->morphTics ||*/
-		(player->cheats & CF_PREDICTING))
+		!netgame /*||
+		player->morphTics*/)
 	{
 		return;
 	}
@@ -2754,6 +2756,40 @@ void P_PredictPlayer (player_t *player)
 		return;
 	}
 
+	if (player->cheats & CF_PREDICTING)
+	{
+		// The player is still predicted from an earlier call. If the
+		// authoritative tic it was predicted from has not run since, that
+		// prediction is still exact and only newly buffered command tics
+		// need to be simulated on top of it. A pending lerp correction
+		// offsets the position, so simulation cannot continue from one.
+		if (PredictionGametic == gametic && PredictionLerptics == 0)
+		{
+			if (maxtic > PredictionMaxtic)
+			{
+				bool NoInterpolateOld = R_GetViewInterpolationStatus();
+				for (int i = PredictionMaxtic; i < maxtic; ++i)
+				{
+					if (!NoInterpolateOld)
+						R_RebuildViewInterpolation(player);
+
+					player->cmd = localcmds[i % LOCALCMDTICS];
+					P_PlayerThink (player);
+					player->mo->Tick ();
+				}
+				PredictionMaxtic = maxtic;
+				// Continuing an exact prediction cannot mispredict, so only
+				// the reference for the next full prediction is updated.
+				PredictionLast.gametic = maxtic - 1;
+				PredictionLast.pos = player->mo->Pos();
+			}
+			return;
+		}
+		// The world has ticked since, so the backed up state is stale and
+		// prediction has to start over from the new authoritative state.
+		P_UnPredictPlayer();
+	}
+
 	// Save original values for restoration later
 	PredictionPlayerBackup = *player;
 
@@ -2816,6 +2852,9 @@ void P_PredictPlayer (player_t *player)
 	act->BlockNode = NULL;
 
 	// Values too small to be usable for lerping can be considered "off".
+	PredictionGametic = gametic;
+	PredictionMaxtic = maxtic;
+
 	bool CanLerp = (!(cl_predict_lerpscale < 0.01f) && (ticdup == 1)), DoLerp = false, NoInterpolateOld = R_GetViewInterpolationStatus();
 	for (int i = gametic; i < maxtic; ++i)
 	{
@@ -947,11 +947,14 @@ bool FPolyObj::MovePolyobj (const DVector2 &pos, bool force)
 	{
 		bool blocked = false;
 
-		for(unsigned i=0;i < Sidedefs.Size(); i++)
+		if (AnyBlockingActorsNearby())
 		{
-			if (CheckMobjBlocking(Sidedefs[i]))
+			for(unsigned i=0;i < Sidedefs.Size(); i++)
 			{
-				blocked = true;
+				if (CheckMobjBlocking(Sidedefs[i]))
+				{
+					blocked = true;
+				}
 			}
 		}
 		if (blocked)
@@ -1036,7 +1039,7 @@ bool FPolyObj::RotatePolyobj (DAngle angle, bool fromsave)
 	UpdateBBox();
 
 	// If we are loading a savegame we do not really want to damage actors and be blocked by them. This can also cause crashes when trying to damage incompletely deserialized player pawns.
-	if (!fromsave)
+	if (!fromsave && AnyBlockingActorsNearby())
 	{
 		for (unsigned i = 0; i < Sidedefs.Size(); i++)
 		{
@@ -1098,6 +1101,53 @@ void FPolyObj::UnLinkPolyobj ()
 	}
 }
 
+//==========================================================================
+//
+// FPolyObj :: AnyBlockingActorsNearby
+//
+// Broadphase for the blocking checks: scans the blockmap cells covered
+// by the polyobject's lines for any solid actor. Most moving polyobjects
+// have nobody near them, so this lets a move or rotation skip the
+// per-sidedef line checks entirely.
+//
+//==========================================================================
+
+bool FPolyObj::AnyBlockingActorsNearby () const
+{
+	int top = INT_MIN, bottom = INT_MAX, left = INT_MAX, right = INT_MIN;
+
+	for (unsigned i = 0; i < Linedefs.Size(); i++)
+	{
+		const line_t *ld = Linedefs[i];
+		int v;
+
+		v = GetBlockY(ld->bbox[BOXTOP]);	if (v > top) top = v;
+		v = GetBlockY(ld->bbox[BOXBOTTOM]);	if (v < bottom) bottom = v;
+		v = GetBlockX(ld->bbox[BOXLEFT]);	if (v < left) left = v;
+		v = GetBlockX(ld->bbox[BOXRIGHT]);	if (v > right) right = v;
+	}
+	bottom = bottom < 0 ? 0 : bottom >= bmapheight ? bmapheight-1 : bottom;
+	top = top < 0 ? 0 : top >= bmapheight ? bmapheight-1 : top;
+	left = left < 0 ? 0 : left >= bmapwidth ? bmapwidth-1 : left;
+	right = right < 0 ? 0 : right >= bmapwidth ? bmapwidth-1 : right;
+
+	for (int j = bottom; j <= top; j++)
+	{
+		for (int i = left; i <= right; i++)
+		{
+			for (FBlockNode *block = blocklinks[j*bmapwidth + i]; block != NULL; block = block->NextActor)
+			{
+				AActor *mobj = block->Me;
+				if ((mobj->flags & MF_SOLID) && !(mobj->flags & MF_NOCLIP))
+				{
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
 //==========================================================================
 //
 // CheckMobjBlocking
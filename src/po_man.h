@@ -113,6 +113,7 @@ private:
 	void DoMovePolyobj (const DVector2 &pos);
 	void UnLinkPolyobj ();
 	bool CheckMobjBlocking (side_t *sd);
+	bool AnyBlockingActorsNearby () const;
 
 };
 extern FPolyObj *polyobjs;		// list of all poly-objects on the level
@@ -190,7 +190,6 @@ void FLinePortalTraverse::AddLineIntercepts(int bx, int by)
 
 		newintercept.frac = frac;
 		newintercept.isaline = true;
-		newintercept.done = false;
 		newintercept.d.line = ld;
 		intercepts.Push(newintercept);
 	}
@@ -1156,7 +1155,7 @@ void P_CreateLinkedPortals()
 //
 //============================================================================
 
-bool P_CollectConnectedGroups(int startgroup, const DVector3 &position, double upperz, double checkradius, FPortalGroupArray &out)
+bool P_CollectConnectedGroups(int startgroup, const DVector3 &position, double upperz, double checkradius, FPortalGroupArray &out, sector_t *startsec)
 {
 	// Keep this temporary work stuff static. This function can never be called recursively
 	// and this would have to be reallocated for each call otherwise.
@@ -1215,7 +1214,9 @@ bool P_CollectConnectedGroups(int startgroup, const DVector3 &position, double u
 	}
 	if (out.method != FPortalGroupArray::PGA_NoSectorPortals)
 	{
-		sector_t *sec = P_PointInSector(position);
+		// Callers usually know the sector at the check position already, so
+		// only run a BSP walk when they don't.
+		sector_t *sec = startsec != NULL ? startsec : P_PointInSector(position);
 		sector_t *wsec = sec;
 		while (!wsec->PortalBlocksMovement(sector_t::ceiling) && upperz > wsec->GetPortalPlaneZ(sector_t::ceiling))
 		{
@@ -16,6 +16,8 @@
 
 #include <SDL.h>
 
+#include "gl/system/gl_system.h"
+
 #ifdef __APPLE__
 #include <OpenGL/OpenGL.h>
 #endif // __APPLE__
@@ -67,14 +69,22 @@ private:
 		SDL_Texture *Texture;
 		SDL_Surface *Surface;
 	};
+	SDL_GLContext GLContext;
+	GLuint CanvasTex;
+	GLuint PaletteTex;
+	GLuint Program;
 
 	bool UsingRenderer;
+	bool UsingGL;
 	bool NeedPalUpdate;
 	bool NeedGammaUpdate;
 	bool NotPaletted;
 
 	void UpdateColors ();
 	void ResetSDLRenderer ();
+	bool InitGLPresent ();
+	void ShutdownGLPresent ();
+	void GLPresent ();
 
 	SDLFB () {}
 };
@@ -107,6 +117,11 @@ CVAR (Int, vid_displaybits, 32, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 
 CVAR (Bool, vid_forcesurface, false, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 
+// Present the paletted canvas through an OpenGL shader that does the
+// palette lookup on the GPU, like the Direct3D 9 backend does on Windows.
+// Falls back to the SDL renderer path if OpenGL is not usable.
+CVAR (Bool, vid_glswfb, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
+
 CUSTOM_CVAR (Float, rgamma, 1.f, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 {
 	if (screen != NULL)
@@ -361,6 +376,14 @@ SDLFB::SDLFB (int width, int height, bool fullscreen, SDL_Window *oldwin)
 	NotPaletted = false;
 	FlashAmount = 0;
 
+	Renderer = NULL;
+	Texture = NULL;
+	GLContext = NULL;
+	CanvasTex = 0;
+	PaletteTex = 0;
+	Program = 0;
+	UsingGL = false;
+
 	if (oldwin)
 	{
 		// In some cases (Mac OS X fullscreen) SDL2 doesn't like having multiple windows which
@@ -375,16 +398,29 @@ SDLFB::SDLFB (int width, int height, bool fullscreen, SDL_Window *oldwin)
 		FString caption;
 		caption.Format(GAMESIG " %s (%s)", GetVersionString(), GetGitTime());
 
+		Uint32 winflags = (fullscreen ? SDL_WINDOW_FULLSCREEN_DESKTOP : 0)|SDL_WINDOW_RESIZABLE;
+		if (vid_glswfb)
+		{
+			winflags |= SDL_WINDOW_OPENGL;
+		}
+
 		Screen = SDL_CreateWindow (caption,
 			SDL_WINDOWPOS_UNDEFINED_DISPLAY(vid_adapter), SDL_WINDOWPOS_UNDEFINED_DISPLAY(vid_adapter),
-			width, height, (fullscreen ? SDL_WINDOW_FULLSCREEN_DESKTOP : 0)|SDL_WINDOW_RESIZABLE);
+			width, height, winflags);
+
+		if (Screen == NULL && (winflags & SDL_WINDOW_OPENGL))
+		{
+			// No OpenGL. Retry with a plain window and use the SDL present path.
+			winflags &= ~SDL_WINDOW_OPENGL;
+			Screen = SDL_CreateWindow (caption,
+				SDL_WINDOWPOS_UNDEFINED_DISPLAY(vid_adapter), SDL_WINDOWPOS_UNDEFINED_DISPLAY(vid_adapter),
+				width, height, winflags);
+		}
 
 		if (Screen == NULL)
 			return;
 	}
 
-	Renderer = NULL;
-	Texture = NULL;
 	ResetSDLRenderer ();
 
 	for (i = 0; i < 256; i++)
@@ -410,6 +446,11 @@ SDLFB::~SDLFB ()
 		SDL_DestroyRenderer (Renderer);
 	}
 
+	if (GLContext)
+	{
+		ShutdownGLPresent ();
+	}
+
 	if(Screen)
 	{
 		SDL_DestroyWindow (Screen);
@@ -478,60 +519,67 @@ void SDLFB::Update ()
 	SDLFlipCycles.Reset();
 	BlitCycles.Clock();
 
-	void *pixels;
-	int pitch;
-	if (UsingRenderer)
+	if (UsingGL)
 	{
-		if (SDL_LockTexture (Texture, NULL, &pixels, &pitch))
-			return;
+		GLPresent ();
 	}
 	else
 	{
-		if (SDL_LockSurface (Surface))
-			return;
+		void *pixels;
+		int pitch;
+		if (UsingRenderer)
+		{
+			if (SDL_LockTexture (Texture, NULL, &pixels, &pitch))
+				return;
+		}
+		else
+		{
+			if (SDL_LockSurface (Surface))
+				return;
 
-		pixels = Surface->pixels;
-		pitch = Surface->pitch;
-	}
+			pixels = Surface->pixels;
+			pitch = Surface->pitch;
+		}
 
-	if (NotPaletted)
-	{
-		GPfx.Convert (MemBuffer, Pitch,
-			pixels, pitch, Width, Height,
-			FRACUNIT, FRACUNIT, 0, 0);
-	}
-	else
-	{
-		if (pitch == Pitch)
+		if (NotPaletted)
 		{
-			memcpy (pixels, MemBuffer, Width*Height);
+			GPfx.Convert (MemBuffer, Pitch,
+				pixels, pitch, Width, Height,
+				FRACUNIT, FRACUNIT, 0, 0);
 		}
 		else
 		{
-			for (int y = 0; y < Height; ++y)
+			if (pitch == Pitch)
+			{
+				memcpy (pixels, MemBuffer, Width*Height);
+			}
+			else
 			{
-				memcpy ((BYTE *)pixels+y*pitch, MemBuffer+y*Pitch, Width);
+				for (int y = 0; y < Height; ++y)
+				{
+					memcpy ((BYTE *)pixels+y*pitch, MemBuffer+y*Pitch, Width);
+				}
 			}
 		}
-	}
 
-	if (UsingRenderer)
-	{
-		SDL_UnlockTexture (Texture);
+		if (UsingRenderer)
+		{
+			SDL_UnlockTexture (Texture);
 
-		SDLFlipCycles.Clock();
-		SDL_RenderClear(Renderer);
-		SDL_RenderCopy(Renderer, Texture, NULL, NULL);
-		SDL_RenderPresent(Renderer);
-		SDLFlipCycles.Unclock();
-	}
-	else
-	{
-		SDL_UnlockSurface (Surface);
+			SDLFlipCycles.Clock();
+			SDL_RenderClear(Renderer);
+			SDL_RenderCopy(Renderer, Texture, NULL, NULL);
+			SDL_RenderPresent(Renderer);
+			SDLFlipCycles.Unclock();
+		}
+		else
+		{
+			SDL_UnlockSurface (Surface);
 
-		SDLFlipCycles.Clock();
-		SDL_UpdateWindowSurface (Screen);
-		SDLFlipCycles.Unclock();
+			SDLFlipCycles.Clock();
+			SDL_UpdateWindowSurface (Screen);
+			SDLFlipCycles.Unclock();
+		}
 	}
 
 	BlitCycles.Unclock();
@@ -555,7 +603,29 @@ void SDLFB::Update ()
 
 void SDLFB::UpdateColors ()
 {
-	if (NotPaletted)
+	if (UsingGL)
+	{
+		PalEntry palette[256];
+
+		for (int i = 0; i < 256; ++i)
+		{
+			palette[i].r = GammaTable[0][SourcePalette[i].r];
+			palette[i].g = GammaTable[1][SourcePalette[i].g];
+			palette[i].b = GammaTable[2][SourcePalette[i].b];
+			palette[i].a = 255;
+		}
+		if (FlashAmount)
+		{
+			DoBlending (palette, palette,
+				256, GammaTable[0][Flash.r], GammaTable[1][Flash.g], GammaTable[2][Flash.b],
+				FlashAmount);
+		}
+		glActiveTexture (GL_TEXTURE1);
+		glBindTexture (GL_TEXTURE_2D, PaletteTex);
+		glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, 256, 1, GL_BGRA, GL_UNSIGNED_BYTE, palette);
+		glActiveTexture (GL_TEXTURE0);
+	}
+	else if (NotPaletted)
 	{
 		PalEntry palette[256];
 		
@@ -661,6 +731,25 @@ void SDLFB::ResetSDLRenderer ()
 		if (Texture)
 			SDL_DestroyTexture (Texture);
 		SDL_DestroyRenderer (Renderer);
+		Renderer = NULL;
+		Texture = NULL;
+	}
+	if (GLContext)
+	{
+		ShutdownGLPresent ();
+	}
+
+	if (vid_glswfb && (SDL_GetWindowFlags (Screen) & SDL_WINDOW_OPENGL))
+	{
+		UsingGL = InitGLPresent ();
+	}
+	if (UsingGL)
+	{
+		// The palette is applied by the present shader, so the flash and
+		// gamma blending still happens per palette entry, not per pixel.
+		NotPaletted = true;
+		NeedPalUpdate = true;
+		return;
 	}
 
 	UsingRenderer = !vid_forcesurface;
@@ -720,6 +809,173 @@ void SDLFB::ResetSDLRenderer ()
 	}
 }
 
+static GLuint CompilePresentShader (GLenum type, const char *source)
+{
+	GLuint shader = glCreateShader (type);
+	glShaderSource (shader, 1, &source, NULL);
+	glCompileShader (shader);
+
+	GLint status = GL_FALSE;
+	glGetShaderiv (shader, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE)
+	{
+		glDeleteShader (shader);
+		return 0;
+	}
+	return shader;
+}
+
+// Hands the paletted canvas to the GPU and lets a fragment shader do the
+// palette lookup, so the CPU never expands the frame to 32 bits. This is
+// the same idea as the shader present in the Direct3D 9 framebuffer.
+bool SDLFB::InitGLPresent ()
+{
+	GLContext = SDL_GL_CreateContext (Screen);
+	if (GLContext == NULL)
+	{
+		return false;
+	}
+	SDL_GL_MakeCurrent (Screen, GLContext);
+
+	if (ogl_LoadFunctions () == ogl_LOAD_FAILED ||
+		glCreateShader == NULL || glUseProgram == NULL || glBegin == NULL)
+	{
+		ShutdownGLPresent ();
+		return false;
+	}
+
+	static const char *vertsrc =
+		"#version 110\n"
+		"void main()\n"
+		"{\n"
+		"	gl_Position = gl_Vertex;\n"
+		"	gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+		"}\n";
+	static const char *fragsrc =
+		"#version 110\n"
+		"uniform sampler2D canvas;\n"
+		"uniform sampler2D palette;\n"
+		"void main()\n"
+		"{\n"
+		"	float index = texture2D(canvas, gl_TexCoord[0].xy).r;\n"
+		"	gl_FragColor = texture2D(palette, vec2((index * 255.0 + 0.5) / 256.0, 0.5));\n"
+		"}\n";
+
+	GLuint vert = CompilePresentShader (GL_VERTEX_SHADER, vertsrc);
+	GLuint frag = CompilePresentShader (GL_FRAGMENT_SHADER, fragsrc);
+	if (vert != 0 && frag != 0)
+	{
+		Program = glCreateProgram ();
+		glAttachShader (Program, vert);
+		glAttachShader (Program, frag);
+		glLinkProgram (Program);
+
+		GLint status = GL_FALSE;
+		glGetProgramiv (Program, GL_LINK_STATUS, &status);
+		if (status == GL_FALSE)
+		{
+			glDeleteProgram (Program);
+			Program = 0;
+		}
+	}
+	if (vert != 0)
+		glDeleteShader (vert);
+	if (frag != 0)
+		glDeleteShader (frag);
+	if (Program == 0)
+	{
+		ShutdownGLPresent ();
+		return false;
+	}
+
+	glUseProgram (Program);
+	glUniform1i (glGetUniformLocation (Program, "canvas"), 0);
+	glUniform1i (glGetUniformLocation (Program, "palette"), 1);
+
+	glActiveTexture (GL_TEXTURE1);
+	glGenTextures (1, &PaletteTex);
+	glBindTexture (GL_TEXTURE_2D, PaletteTex);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA8, 256, 1, 0, GL_BGRA, GL_UNSIGNED_BYTE, NULL);
+
+	glActiveTexture (GL_TEXTURE0);
+	glGenTextures (1, &CanvasTex);
+	glBindTexture (GL_TEXTURE_2D, CanvasTex);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexImage2D (GL_TEXTURE_2D, 0, GL_LUMINANCE8, Width, Height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, NULL);
+
+	glPixelStorei (GL_UNPACK_ALIGNMENT, 1);
+
+	SDL_GL_SetSwapInterval (vid_vsync ? 1 : 0);
+
+	return true;
+}
+
+void SDLFB::ShutdownGLPresent ()
+{
+	SDL_GL_MakeCurrent (Screen, GLContext);
+	if (Program != 0)
+	{
+		glDeleteProgram (Program);
+		Program = 0;
+	}
+	if (CanvasTex != 0)
+	{
+		glDeleteTextures (1, &CanvasTex);
+		CanvasTex = 0;
+	}
+	if (PaletteTex != 0)
+	{
+		glDeleteTextures (1, &PaletteTex);
+		PaletteTex = 0;
+	}
+	SDL_GL_DeleteContext (GLContext);
+	GLContext = NULL;
+	UsingGL = false;
+}
+
+void SDLFB::GLPresent ()
+{
+	glBindTexture (GL_TEXTURE_2D, CanvasTex);
+	glPixelStorei (GL_UNPACK_ROW_LENGTH, Pitch);
+	glTexSubImage2D (GL_TEXTURE_2D, 0, 0, 0, Width, Height, GL_LUMINANCE, GL_UNSIGNED_BYTE, MemBuffer);
+	glPixelStorei (GL_UNPACK_ROW_LENGTH, 0);
+
+	// In fullscreen, letterbox according to the animorphic ratio, like the
+	// SDL renderer does with its logical size.
+	int w, h;
+	SDL_GetWindowSize (Screen, &w, &h);
+	int vw = w, vh = h;
+	if (IsFullscreen ())
+	{
+		ScaleWithAspect (vw, vh, Width, Height);
+	}
+	if (vw != w || vh != h)
+	{
+		glViewport (0, 0, w, h);
+		glClear (GL_COLOR_BUFFER_BIT);
+	}
+	glViewport ((w - vw) / 2, (h - vh) / 2, vw, vh);
+
+	glUseProgram (Program);
+	glBegin (GL_QUADS);
+	glTexCoord2f (0.f, 0.f); glVertex2f (-1.f,  1.f);
+	glTexCoord2f (1.f, 0.f); glVertex2f ( 1.f,  1.f);
+	glTexCoord2f (1.f, 1.f); glVertex2f ( 1.f, -1.f);
+	glTexCoord2f (0.f, 1.f); glVertex2f (-1.f, -1.f);
+	glEnd ();
+
+	SDLFlipCycles.Clock();
+	SDL_GL_SwapWindow (Screen);
+	SDLFlipCycles.Unclock();
+}
+
 void SDLFB::SetVSync (bool vsync)
 {
 #ifdef __APPLE__
@@ -0,0 +1,486 @@
+/*
+** profiler.cpp
+** Hierarchical frame profiler with an on-screen flame view
+**
+**---------------------------------------------------------------------------
+** Copyright 2016 Randy Heit
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "doomtype.h"
+#include "doomdef.h"
+#include "profiler.h"
+#include "stats.h"
+#include "tarray.h"
+#include "templates.h"
+#include "c_cvars.h"
+#include "c_dispatch.h"
+#include "v_video.h"
+#include "v_palette.h"
+#include "v_text.h"
+#include "v_font.h"
+#include "zstring.h"
+#include "m_misc.h"
+
+// Collect zone data every frame. Cheap enough to leave on while measuring;
+// the zones themselves cost nothing when this is off.
+CVAR (Bool, prof, false, 0)
+
+// Draw the flame view of the most recent frame plus a history strip of the
+// whole ring. Implies collection.
+CVAR (Bool, prof_draw, false, 0)
+
+bool FZoneProfiler::Collecting;
+FZoneProfiler::FFrame FZoneProfiler::Frames[FZoneProfiler::MAX_FRAMES];
+unsigned int FZoneProfiler::NextFrame;
+double FZoneProfiler::FrameStart;
+bool FZoneProfiler::InFrame;
+short FZoneProfiler::ZoneStack[FZoneProfiler::MAX_DEPTH];
+int FZoneProfiler::StackDepth;
+bool FZoneProfiler::Benching;
+TArray<float> FZoneProfiler::BenchTotals;
+TArray<float> FZoneProfiler::BenchPlaysim;
+TArray<float> FZoneProfiler::BenchRender;
+
+//==========================================================================
+//
+// ProfNow
+//
+// Absolute monotonic time in seconds, built from cycle_t so that every
+// platform's clock source works without another #ifdef ladder here.
+//
+//==========================================================================
+
+static inline double ProfNow ()
+{
+	cycle_t clock;
+
+	clock.Reset ();
+	clock.Clock ();
+	return -clock.Time ();
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: BeginFrame
+//
+//==========================================================================
+
+void FZoneProfiler::BeginFrame ()
+{
+	// An exception during the previous frame can leave it half-recorded;
+	// throw it away rather than dump or draw garbage durations.
+	InFrame = false;
+	StackDepth = 0;
+
+	Collecting = prof || prof_draw || Benching;
+	if (!Collecting)
+	{
+		return;
+	}
+
+	FFrame &frame = Frames[NextFrame & (MAX_FRAMES - 1)];
+	frame.Sequence = NextFrame;
+	frame.Total = 0;
+	frame.Zones.Clear ();
+	FrameStart = ProfNow ();
+	InFrame = true;
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: EndFrame
+//
+//==========================================================================
+
+void FZoneProfiler::EndFrame ()
+{
+	if (!InFrame)
+	{
+		return;
+	}
+	FFrame &frame = Frames[NextFrame & (MAX_FRAMES - 1)];
+	frame.Total = ProfNow () - FrameStart;
+	NextFrame++;
+	InFrame = false;
+
+	if (Benching)
+	{
+		double playsim = 0, render = 0;
+
+		for (unsigned int i = 0; i < frame.Zones.Size (); ++i)
+		{
+			if (strcmp (frame.Zones[i].Name, "playsim") == 0)
+			{
+				playsim += frame.Zones[i].Duration;
+			}
+			else if (strcmp (frame.Zones[i].Name, "display") == 0)
+			{
+				render += frame.Zones[i].Duration;
+			}
+		}
+		BenchTotals.Push (float(frame.Total * 1000));
+		BenchPlaysim.Push (float(playsim * 1000));
+		BenchRender.Push (float(render * 1000));
+	}
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: Enter
+//
+// The name must be a string literal; only the pointer is stored.
+//
+//==========================================================================
+
+void FZoneProfiler::Enter (const char *name)
+{
+	if (!InFrame)
+	{
+		// Keep Enter/Leave balanced even when not recording, so that a
+		// manual pair spanning BeginFrame cannot corrupt the stack.
+		StackDepth++;
+		return;
+	}
+	if (StackDepth >= MAX_DEPTH)
+	{
+		StackDepth++;
+		return;
+	}
+
+	FFrame &frame = Frames[NextFrame & (MAX_FRAMES - 1)];
+	FZone zone;
+
+	zone.Name = name;
+	zone.Parent = StackDepth > 0 ? ZoneStack[StackDepth - 1] : -1;
+	zone.Depth = (BYTE)StackDepth;
+	zone.Start = ProfNow () - FrameStart;
+	zone.Duration = 0;
+	ZoneStack[StackDepth++] = (short)frame.Zones.Push (zone);
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: Leave
+//
+//==========================================================================
+
+void FZoneProfiler::Leave ()
+{
+	if (StackDepth <= 0)
+	{
+		return;
+	}
+	StackDepth--;
+	if (!InFrame || StackDepth >= MAX_DEPTH)
+	{
+		return;
+	}
+
+	FFrame &frame = Frames[NextFrame & (MAX_FRAMES - 1)];
+	FZone &zone = frame.Zones[ZoneStack[StackDepth]];
+	zone.Duration = ProfNow () - FrameStart - zone.Start;
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: Draw
+//
+// Flame view of the newest completed frame: one row per nesting depth,
+// horizontal extent proportional to time within the frame. Below it, a
+// history strip with one bar per ring entry, so spikes stay visible for
+// MAX_FRAMES frames after they happen.
+//
+//==========================================================================
+
+void FZoneProfiler::Draw ()
+{
+	static const uint32 depthcolors[4] =
+	{
+		MAKEARGB(255,192,48,48), MAKEARGB(255,208,144,32),
+		MAKEARGB(255,64,160,64), MAKEARGB(255,64,112,192)
+	};
+
+	if (!prof_draw || NextFrame == 0)
+	{
+		return;
+	}
+
+	const FFrame &frame = Frames[(NextFrame - 1) & (MAX_FRAMES - 1)];
+	int left = 8;
+	int width = SCREENWIDTH - 16;
+	int top = SCREENHEIGHT / 2;
+	int rowheight = ConFont->GetHeight () + 2;
+	double scale = frame.Total > 0 ? width / frame.Total : 0;
+	char buffer[64];
+
+	mysnprintf (buffer, countof(buffer), "frame %u: %.2f ms", frame.Sequence, frame.Total * 1000);
+	screen->DrawText (ConFont, CR_WHITE, left, top - rowheight, buffer, TAG_DONE);
+
+	for (unsigned int i = 0; i < frame.Zones.Size (); ++i)
+	{
+		const FZone &zone = frame.Zones[i];
+		int x1 = left + int(zone.Start * scale);
+		int x2 = left + int((zone.Start + zone.Duration) * scale);
+		int y1 = top + zone.Depth * rowheight;
+
+		if (x2 <= x1)
+		{ // Keep even the cheapest zones visible.
+			x2 = x1 + 1;
+		}
+		screen->Clear (x1, y1, x2, y1 + rowheight - 1, -1, depthcolors[zone.Depth & 3]);
+		if (zone.Depth == 0 && x2 - x1 > ConFont->StringWidth (zone.Name))
+		{
+			screen->DrawText (ConFont, CR_BLACK, x1 + 2, y1, zone.Name, TAG_DONE);
+		}
+	}
+
+	// History strip: 35 fps budget maps to half the strip height, so a
+	// bar reaching the top marks a frame that took twice its budget.
+	int striptop = SCREENHEIGHT - 40;
+	int stripheight = 32;
+	unsigned int numframes = MIN<unsigned int> (NextFrame, MAX_FRAMES);
+	double budget = 1 / 35.0;
+
+	for (unsigned int i = 0; i < numframes; ++i)
+	{
+		const FFrame &old = Frames[(NextFrame - numframes + i) & (MAX_FRAMES - 1)];
+		int barheight = int(old.Total / budget * (stripheight / 2));
+		int x = left + i * width / MAX_FRAMES;
+
+		if (barheight > stripheight)
+		{
+			barheight = stripheight;
+		}
+		else if (barheight < 1)
+		{
+			barheight = 1;
+		}
+		screen->Clear (x, striptop + stripheight - barheight, x + 2, striptop + stripheight, -1,
+			old.Total > budget ? MAKEARGB(255,255,64,64) : MAKEARGB(255,64,192,64));
+	}
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: DumpToFile
+//
+// Writes per-zone aggregates over the whole ring, keyed by the zone's
+// full path and sorted by it, so two dumps from different runs can be
+// diffed line by line.
+//
+//==========================================================================
+
+struct FZoneAggregate
+{
+	FString Path;
+	double Total, Min, Max;
+	unsigned int Calls;
+};
+
+static int aggcompare (const void *a, const void *b)
+{
+	return strcmp (((const FZoneAggregate *)a)->Path,
+				   ((const FZoneAggregate *)b)->Path);
+}
+
+bool FZoneProfiler::DumpToFile (const char *filename)
+{
+	unsigned int numframes = MIN<unsigned int> (NextFrame, MAX_FRAMES);
+
+	if (numframes == 0)
+	{
+		return false;
+	}
+
+	TMap<FString, FZoneAggregate> aggmap;
+
+	for (unsigned int i = 0; i < numframes; ++i)
+	{
+		const FFrame &frame = Frames[(NextFrame - numframes + i) & (MAX_FRAMES - 1)];
+
+		for (unsigned int j = 0; j < frame.Zones.Size (); ++j)
+		{
+			FString path = frame.Zones[j].Name;
+
+			for (short k = frame.Zones[j].Parent; k >= 0; k = frame.Zones[k].Parent)
+			{
+				path = FString(frame.Zones[k].Name) + "/" + path;
+			}
+
+			FZoneAggregate *agg = aggmap.CheckKey (path);
+			double ms = frame.Zones[j].Duration * 1000;
+
+			if (agg == NULL)
+			{
+				FZoneAggregate newagg = { path, ms, ms, ms, 1 };
+				aggmap.Insert (path, newagg);
+			}
+			else
+			{
+				agg->Total += ms;
+				agg->Min = MIN (agg->Min, ms);
+				agg->Max = MAX (agg->Max, ms);
+				agg->Calls++;
+			}
+		}
+	}
+
+	TArray<FZoneAggregate> aggs;
+	TMap<FString, FZoneAggregate>::Iterator it (aggmap);
+	TMap<FString, FZoneAggregate>::Pair *pair;
+
+	while (it.NextPair (pair))
+	{
+		aggs.Push (pair->Value);
+	}
+	qsort (&aggs[0], aggs.Size (), sizeof(FZoneAggregate), aggcompare);
+
+	FILE *file = fopen (filename, "w");
+	if (file == NULL)
+	{
+		return false;
+	}
+	fprintf (file, "zones over %u frames; times in ms\n", numframes);
+	fprintf (file, "%-48s %10s %10s %10s %10s\n", "path", "calls", "avg", "min", "max");
+	for (unsigned int i = 0; i < aggs.Size (); ++i)
+	{
+		fprintf (file, "%-48s %10u %10.3f %10.3f %10.3f\n", aggs[i].Path.GetChars (),
+			aggs[i].Calls, aggs[i].Total / aggs[i].Calls, aggs[i].Min, aggs[i].Max);
+	}
+	fclose (file);
+	return true;
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: StartBench
+//
+//==========================================================================
+
+void FZoneProfiler::StartBench ()
+{
+	BenchTotals.Clear ();
+	BenchPlaysim.Clear ();
+	BenchRender.Clear ();
+	Benching = true;
+}
+
+//==========================================================================
+//
+// FZoneProfiler :: StopBench
+//
+// Writes the accumulated per-frame data as JSON. The full frame time
+// array goes last so the summary stays readable when eyeballing the file.
+//
+//==========================================================================
+
+static int floatcompare (const void *a, const void *b)
+{
+	float d = *(const float *)a - *(const float *)b;
+	return d < 0 ? -1 : d > 0 ? 1 : 0;
+}
+
+static float percentile (const TArray<float> &sorted, int pct)
+{
+	return sorted[MIN (sorted.Size () - 1, sorted.Size () * pct / 100)];
+}
+
+static float average (const TArray<float> &values)
+{
+	double sum = 0;
+
+	for (unsigned int i = 0; i < values.Size (); ++i)
+	{
+		sum += values[i];
+	}
+	return float(sum / values.Size ());
+}
+
+bool FZoneProfiler::StopBench (const char *filename, int gametics, int realtics)
+{
+	Benching = false;
+	if (BenchTotals.Size () == 0)
+	{
+		return false;
+	}
+
+	TArray<float> sorted = BenchTotals;
+	qsort (&sorted[0], sorted.Size (), sizeof(float), floatcompare);
+
+	FILE *file = fopen (filename, "w");
+	if (file == NULL)
+	{
+		return false;
+	}
+	fprintf (file, "{\n");
+	fprintf (file, "\t\"frames\": %u,\n", BenchTotals.Size ());
+	fprintf (file, "\t\"gametics\": %d,\n", gametics);
+	fprintf (file, "\t\"realtics\": %d,\n", realtics);
+	fprintf (file, "\t\"fps\": %.2f,\n", realtics > 0 ? (double)gametics / realtics * TICRATE : 0.0);
+	fprintf (file, "\t\"frame_ms\": { \"avg\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f },\n",
+		average (BenchTotals), percentile (sorted, 50), percentile (sorted, 90),
+		percentile (sorted, 95), percentile (sorted, 99), sorted[sorted.Size () - 1]);
+	fprintf (file, "\t\"playsim_ms\": { \"avg\": %.3f },\n", average (BenchPlaysim));
+	fprintf (file, "\t\"render_ms\": { \"avg\": %.3f },\n", average (BenchRender));
+	fprintf (file, "\t\"frame_times_ms\": [");
+	for (unsigned int i = 0; i < BenchTotals.Size (); ++i)
+	{
+		fprintf (file, "%s%.3f", i == 0 ? "" : ",", BenchTotals[i]);
+	}
+	fprintf (file, "]\n}\n");
+	fclose (file);
+
+	BenchTotals.Clear ();
+	BenchPlaysim.Clear ();
+	BenchRender.Clear ();
+	return true;
+}
+
+//==========================================================================
+//
+// CCMD prof_dump
+//
+//==========================================================================
+
+CCMD (prof_dump)
+{
+	const char *filename = argv.argc () > 1 ? argv[1] : "profile.txt";
+
+	if (FZoneProfiler::DumpToFile (filename))
+	{
+		Printf ("Wrote %s\n", filename);
+	}
+	else
+	{
+		Printf ("Could not write %s. Is \"prof\" enabled?\n", filename);
+	}
+}
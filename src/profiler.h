@@ -0,0 +1,129 @@
+/*
+** profiler.h
+** Hierarchical frame profiler with an on-screen flame view
+**
+**---------------------------------------------------------------------------
+** Copyright 2016 Randy Heit
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+** Unlike the FStat counters, which report one aggregate number per
+** subsystem, the profiler records every instrumented zone of every frame
+** into a ring buffer, preserving the nesting so that a frame can be drawn
+** as a flame graph or dumped to a file and diffed against another run.
+*/
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include "doomtype.h"
+#include "tarray.h"
+
+class FZoneProfiler
+{
+public:
+	enum
+	{
+		MAX_FRAMES = 256,	// must be a power of 2
+		MAX_DEPTH = 16
+	};
+
+	struct FZone
+	{
+		const char *Name;	// must point to a string literal
+		short Parent;		// index of the enclosing zone, or -1 at the frame root
+		BYTE Depth;
+		double Start;		// seconds since the start of the frame
+		double Duration;	// seconds; filled in by Leave()
+	};
+
+	struct FFrame
+	{
+		unsigned int Sequence;	// frame counter, for the dump header
+		double Total;			// whole-frame time in seconds
+		TArray<FZone> Zones;	// in Enter() order, i.e. pre-order
+	};
+
+	static void BeginFrame ();
+	static void EndFrame ();
+	static void Enter (const char *name);
+	static void Leave ();
+	static void Draw ();
+	static bool DumpToFile (const char *filename);
+
+	// Benchmark mode: accumulate every completed frame (not just the last
+	// MAX_FRAMES) until stopped, then write percentiles and the playsim/
+	// render split as JSON. Used by timedemo when -benchfile is given.
+	static void StartBench ();
+	static bool StopBench (const char *filename, int gametics, int realtics);
+
+	// Latched from the cvars by BeginFrame so that a frame is always
+	// recorded completely or not at all.
+	static bool Collecting;
+
+private:
+	static FFrame Frames[MAX_FRAMES];
+	static unsigned int NextFrame;
+	static double FrameStart;
+	static bool InFrame;
+	static short ZoneStack[MAX_DEPTH];
+	static int StackDepth;
+
+	static bool Benching;
+	static TArray<float> BenchTotals;	// per-frame times in ms
+	static TArray<float> BenchPlaysim;
+	static TArray<float> BenchRender;
+};
+
+// RAII helper for PROF_ZONE. The decision to record is made on entry so
+// that toggling the cvar mid-frame cannot unbalance the zone stack.
+class FZoneScope
+{
+public:
+	FZoneScope (const char *name)
+	{
+		Entered = FZoneProfiler::Collecting;
+		if (Entered)
+		{
+			FZoneProfiler::Enter (name);
+		}
+	}
+	~FZoneScope ()
+	{
+		if (Entered)
+		{
+			FZoneProfiler::Leave ();
+		}
+	}
+private:
+	bool Entered;
+};
+
+#define PROF_ZONE2(name,line)	FZoneScope prof_zone_ ## line (name)
+#define PROF_ZONE1(name,line)	PROF_ZONE2(name,line)
+#define PROF_ZONE(name)			PROF_ZONE1(name,__LINE__)
+
+#endif //__PROFILER_H__
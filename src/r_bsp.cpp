@@ -92,6 +92,9 @@ drawseg_t*		ds_p;
 size_t			FirstInterestingDrawseg;
 TArray<size_t>	InterestingDrawsegs;
 
+size_t			FirstClippingDrawseg;
+TArray<size_t>	ClippingDrawsegs;
+
 FWallCoords		WallC;
 FWallTmapVals	WallT;
 
@@ -122,6 +125,8 @@ void R_ClearDrawSegs (void)
 	}
 	FirstInterestingDrawseg = 0;
 	InterestingDrawsegs.Clear ();
+	FirstClippingDrawseg = 0;
+	ClippingDrawsegs.Clear ();
 	ds_p = drawsegs;
 }
 
@@ -544,6 +549,7 @@ void R_AddLine (seg_t *line)
 	DVector2		pt1, pt2;
 
 	curline = line;
+	sw_walked_segs++;
 
 	// [RH] Color if not texturing line
 	dc_color = (((int)(line - segs) * 8) + 4) & 255;
@@ -1311,7 +1317,7 @@ void R_Subsector (subsector_t *sub)
 	if ((unsigned int)(sub - subsectors) < (unsigned int)numsubsectors)
 	{ // Only do it for the main BSP.
 		int shade = LIGHT2SHADE((floorlightlevel + ceilinglightlevel)/2 + r_actualextralight);
-		for (WORD i = ParticlesInSubsec[(unsigned int)(sub-subsectors)]; i != NO_PARTICLE; i = Particles[i].snext)
+		for (DWORD i = ParticlesInSubsec[(unsigned int)(sub-subsectors)]; i != NO_PARTICLE; i = Particles[i].snext)
 		{
 			R_ProjectParticle (Particles + i, subsectors[sub-subsectors].sector, shade, FakeSide);
 		}
@@ -104,6 +104,9 @@ extern drawseg_t*	ds_p;
 extern TArray<size_t>	InterestingDrawsegs;	// drawsegs that have something drawn on them
 extern size_t			FirstInterestingDrawseg;
 
+extern TArray<size_t>	ClippingDrawsegs;		// drawsegs that can clip sprites
+extern size_t			FirstClippingDrawseg;
+
 extern int			WindowLeft, WindowRight;
 extern WORD			MirrorFlags;
 
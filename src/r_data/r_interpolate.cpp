@@ -55,12 +55,13 @@ class DSectorPlaneInterpolation : public DInterpolation
 	double oldheight, oldtexz;
 	double bakheight, baktexz;
 	bool ceiling;
+	bool moved;				// transient; whether Interpolate() changed anything this frame
 	TArray<DInterpolation *> attached;
 
 
 public:
 
-	DSectorPlaneInterpolation() {}
+	DSectorPlaneInterpolation() { moved = false; }
 	DSectorPlaneInterpolation(sector_t *sector, bool plane, bool attach);
 	void Destroy();
 	void UpdateInterpolation();
@@ -400,6 +401,7 @@ DSectorPlaneInterpolation::DSectorPlaneInterpolation(sector_t *_sector, bool _pl
 {
 	sector = _sector;
 	ceiling = _plane;
+	moved = false;
 	UpdateInterpolation ();
 
 	if (attach)
@@ -465,6 +467,10 @@ void DSectorPlaneInterpolation::UpdateInterpolation()
 
 void DSectorPlaneInterpolation::Restore()
 {
+	if (!moved)
+	{ // Interpolate() left the plane untouched.
+		return;
+	}
 	if (!ceiling)
 	{
 		sector->floorplane.setD(bakheight);
@@ -477,6 +483,7 @@ void DSectorPlaneInterpolation::Restore()
 	}
 	P_RecalculateAttached3DFloors(sector);
 	sector->CheckPortalPlane(ceiling? sector_t::ceiling : sector_t::floor);
+	moved = false;
 }
 
 //==========================================================================
@@ -508,11 +515,19 @@ void DSectorPlaneInterpolation::Interpolate(double smoothratio)
 	{
 		Destroy();
 	}
+	else if (oldheight == bakheight && oldtexz == baktexz)
+	{
+		// The plane didn't move since the last tic (e.g. a stalled lift or
+		// a ceiling waiting to crush), so there is nothing to interpolate
+		// and no need to recalculate attached 3D floors every frame.
+		moved = false;
+	}
 	else
 	{
+		moved = true;
 		pplane->setD(oldheight + (bakheight - oldheight) * smoothratio);
 		sector->SetPlaneTexZ(pos, oldtexz + (baktexz - oldtexz) * smoothratio, true);
-	P_RecalculateAttached3DFloors(sector);
+		P_RecalculateAttached3DFloors(sector);
 		sector->CheckPortalPlane(pos);
 	}
 }
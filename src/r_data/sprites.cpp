@@ -470,6 +470,14 @@ void VOX_AddVoxel(int sprnum, int frame, FVoxelDef *def)
 // Reads in everything applicable to a skin. The skins should have already
 // been counted and had their identifiers assigned to namespaces.
 //
+// This has to be eager, even though most skins are never selected: it
+// registers sprites, player sounds and class skin lists as global side
+// effects, and dozens of places read skins[x].sprite and friends directly
+// by index - the menu preview, the playsim, savegames and network userinfo
+// among them - with no funnel where a lazily materialized skin could be
+// faulted in. Note that only texture headers are touched here; the actual
+// pixel data stays unloaded until a skin is first drawn.
+//
 #define NUMSKINSOUNDS 17
 static const char *skinsoundnames[NUMSKINSOUNDS][2] =
 { // The *painXXX sounds must be the first four
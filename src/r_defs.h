@@ -621,6 +621,14 @@ FSerializer &Serialize(FSerializer &arc, const char *key, secspecial_t &spec, se
 
 enum class EMoveResult { ok, crushed, pastdest };
 
+// Note on layout: sector_t is big, but splitting the render-hot fields
+// (plane heights, light level, textures) into separate parallel arrays is
+// not workable. They are mutated from far more places than the movers -
+// ACS, serialization, UDMF loaders, compatibility fixups and the instant
+// setters all write them directly through sector pointers, so shadow
+// copies would need invalidation hooks in all of them. The renderers also
+// read a much wider slice per visit (colormaps, heightsec, portals,
+// 3D floor lists), so the struct stays the single source of truth.
 struct sector_t
 {
 	// Member functions
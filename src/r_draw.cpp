@@ -1502,6 +1502,24 @@ extern "C" void R_DrawSlabC(int dx, fixed_t v, int dy, fixed_t vi, const BYTE *v
 
 	assert(dx > 0);
 
+	if (vi == 0 && dy > 1)
+	{
+		// A slab only one voxel tall samples the same texel on every row,
+		// so the colormap lookup can be hoisted out of the loop and the
+		// whole rectangle becomes a plain fill.
+		BYTE color = colormap[vptr[v >> FRACBITS]];
+		while (dy > 0)
+		{
+			for (x = 0; x < dx; x++)
+			{
+				p[x] = color;
+			}
+			p += pitch;
+			dy--;
+		}
+		return;
+	}
+
 	if (dx == 1)
 	{
 		while (dy > 0)
@@ -829,6 +829,13 @@ void R_SetupBuffer ()
 //
 //==========================================================================
 
+// Scene complexity counters for "stat scene".
+int sw_walked_segs;
+int sw_created_visplanes;
+int sw_added_sprites;
+int sw_drawn_sprites;
+int sw_rendered_portals;
+
 void R_RenderActorView (AActor *actor, bool dontmaplines)
 {
 	WallCycles.Reset();
@@ -836,6 +843,9 @@ void R_RenderActorView (AActor *actor, bool dontmaplines)
 	MaskedCycles.Reset();
 	WallScanCycles.Reset();
 
+	sw_walked_segs = sw_created_visplanes = 0;
+	sw_added_sprites = sw_drawn_sprites = sw_rendered_portals = 0;
+
 	fakeActive = 0; // kg3D - reset fake floor indicator
 	R_3D_ResetClip(); // reset clips (floor/ceiling)
 
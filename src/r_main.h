@@ -138,6 +138,13 @@ void R_MultiresInit (void);
 extern int stacked_extralight;
 extern double stacked_visibility;
 extern DVector3 stacked_viewpos;
+
+// Scene complexity counters for "stat scene", reset per rendered view.
+extern int sw_walked_segs;
+extern int sw_created_visplanes;
+extern int sw_added_sprites;
+extern int sw_drawn_sprites;
+extern int sw_rendered_portals;
 extern DAngle stacked_angle;
 
 extern void R_CopyStackedViewParameters();
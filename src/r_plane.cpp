@@ -58,6 +58,11 @@
 #include "r_3dfloors.h"
 #include "v_palette.h"
 #include "r_data/colormaps.h"
+#include "threadpool.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(disable:4244)
@@ -76,7 +81,7 @@ planefunction_t 		floorfunc;
 planefunction_t 		ceilingfunc;
 
 // Here comes the obnoxious "visplane".
-#define MAXVISPLANES 128    /* must be a power of 2 */
+#define MAXVISPLANES 256    /* must be a power of 2 */
 
 // Avoid infinite recursion with stacked sectors by limiting them.
 #define MAX_SKYBOX_PLANES 1000
@@ -90,10 +95,19 @@ visplane_t 				*floorplane;
 visplane_t 				*ceilingplane;
 
 // killough -- hash function for visplanes
-// Empirically verified to be fairly uniform:
+// The old small-prime key bunched up badly on large open maps where many
+// planes share a height but differ in light or slope, so mix the fields
+// with Fibonacci-style multipliers and fold the tilt into the key.
 
-#define visplane_hash(picnum,lightlevel,height) \
-  ((unsigned)((picnum)*3+(lightlevel)+(FLOAT2FIXED((height).fD()))*7) & (MAXVISPLANES-1))
+static inline unsigned visplane_hash (unsigned picnum, int lightlevel, const secplane_t &height)
+{
+	unsigned bits = picnum * 2654435761u
+		+ (unsigned)lightlevel * 2246822519u
+		+ (unsigned)FLOAT2FIXED(height.fD()) * 3266489917u
+		+ (unsigned)FLOAT2FIXED(height.fC());
+	bits ^= bits >> 16;
+	return bits & (MAXVISPLANES-1);
+}
 
 // These are copies of the main parameters used when drawing stacked sectors.
 // When you change the main parameters, you should copy them here too *unless*
@@ -271,6 +285,9 @@ void R_MapPlane (int y, int x1)
 //==========================================================================
 
 extern "C" {
+static BYTE *tiltlighting_fill;	// colormap tiltlighting was last filled with, NULL if per-column
+static int tiltlighting_fillwidth;
+
 void R_CalcTiltedLighting (double lval, double lend, int width)
 {
 	double lstep;
@@ -278,6 +295,8 @@ void R_CalcTiltedLighting (double lval, double lend, int width)
 	BYTE *basecolormapdata = basecolormap->Maps;
 	int i = 0;
 
+	tiltlighting_fill = NULL;
+
 	if (width == 0 || lval == lend)
 	{ // Constant lighting
 		lightfiller = basecolormapdata + (GETPALOOKUP(lval, planeshade) << COLORMAPSHIFT);
@@ -575,6 +594,8 @@ static visplane_t *new_visplane (unsigned hash)
 {
 	visplane_t *check = freetail;
 
+	sw_created_visplanes++;
+
 	if (check == NULL)
 	{
 		check = (visplane_t *)M_Malloc (sizeof(*check) + 3 + sizeof(*check->top)*(MAXWIDTH*2));
@@ -769,8 +790,24 @@ visplane_t *R_CheckPlane (visplane_t *pl, int start, int stop)
 		intrh = stop;
 	}
 
-	for (x = intrl; x < intrh && pl->top[x] == 0x7fff; x++)
-		;
+	// The plane can be reused if no column in the intersection has been
+	// drawn to yet. Scan eight columns at a time where SSE2 is available;
+	// this test is run for every wall segment touching the plane.
+	x = intrl;
+#if defined(__SSE2__) || defined(_M_X64)
+	{
+		const __m128i empty = _mm_set1_epi16 (0x7fff);
+		while (x + 8 <= intrh)
+		{
+			__m128i top = _mm_loadu_si128 ((const __m128i *)&pl->top[x]);
+			if (_mm_movemask_epi8 (_mm_cmpeq_epi16 (top, empty)) != 0xffff)
+				break;
+			x += 8;
+		}
+	}
+#endif
+	while (x < intrh && pl->top[x] == 0x7fff)
+		x++;
 
 	if (x >= intrh)
 	{
@@ -1182,6 +1219,281 @@ static void R_DrawSkyStriped (visplane_t *pl)
 CVAR (Bool, tilt, false, 0);
 //CVAR (Int, pa, 0, 0)
 
+CVAR (Bool, r_parallelplanes, false, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
+
+#ifndef X86_ASM
+
+//==========================================================================
+//
+// Parallel plane drawing
+//
+// An opaque, unsloped flat touches no renderer state once its mapping
+// parameters have been captured, and distinct visplanes from the same
+// pass never overlap on screen, so they can be farmed out to the thread
+// pool. Everything that still runs through the shared dc_*/ds_* globals
+// (skies, slopes, translucent stacks, r_drawflat and the assembly span
+// drawers) stays on the serial path.
+//
+//==========================================================================
+
+struct FParallelPlaneState
+{
+	const BYTE *source;			// NULL if the plane could not be set up
+	const BYTE *colormap;		// fixed colormap to use when shade is false
+	const BYTE *basecolormapdata;
+	int xbits, ybits;
+	int planeshade;
+	bool shade;
+	double globvis;
+	double planeheight;
+	fixed_t pviewx, pviewy;
+	double xstepscale, ystepscale;
+	double basexfrac, baseyfrac;
+};
+
+//==========================================================================
+//
+// R_SetupParallelPlane
+//
+// Captures everything R_DrawNormalPlane computes from the globals into
+// a per-task state block. Runs on the main thread because it may need
+// to load the flat's pixels. Returns false for null textures.
+//
+//==========================================================================
+
+static bool R_SetupParallelPlane (visplane_t *pl, FParallelPlaneState &state)
+{
+	FTexture *tex = TexMan(pl->picnum, true);
+
+	if (tex->UseType == FTexture::TEX_Null)
+	{
+		return false;
+	}
+
+	tex->GetWidth ();
+	state.xbits = tex->WidthBits;
+	state.ybits = tex->HeightBits;
+	if ((1 << state.xbits) > tex->GetWidth())
+	{
+		state.xbits--;
+	}
+	if ((1 << state.ybits) > tex->GetHeight())
+	{
+		state.ybits--;
+	}
+	state.source = tex->GetPixels ();
+
+	double _xscale = pl->xform.xScale * tex->Scale.X;
+	double _yscale = pl->xform.yScale * tex->Scale.Y;
+	double planeang = (pl->xform.Angle + pl->xform.baseAngle).Radians();
+	double xstep, ystep, leftxfrac, leftyfrac, rightxfrac, rightyfrac;
+	double x;
+	fixed_t xscale, yscale;
+
+	xscale = xs_ToFixed(32 - state.xbits, _xscale);
+	yscale = xs_ToFixed(32 - state.ybits, _yscale);
+	if (planeang != 0)
+	{
+		double cosine = cos(planeang), sine = sin(planeang);
+		state.pviewx = FLOAT2FIXED(pl->xform.xOffs + ViewPos.X * cosine - ViewPos.Y * sine);
+		state.pviewy = FLOAT2FIXED(pl->xform.yOffs - ViewPos.X * sine - ViewPos.Y * cosine);
+	}
+	else
+	{
+		state.pviewx = FLOAT2FIXED(pl->xform.xOffs + ViewPos.X);
+		state.pviewy = FLOAT2FIXED(pl->xform.yOffs - ViewPos.Y);
+	}
+
+	state.pviewx = FixedMul (xscale, state.pviewx);
+	state.pviewy = FixedMul (yscale, state.pviewy);
+
+	// left to right mapping
+	planeang += (ViewAngle - 90).Radians();
+
+	xstep = cos(planeang) / FocalLengthX;
+	ystep = -sin(planeang) / FocalLengthX;
+
+	if (MirrorFlags & RF_XFLIP)
+	{
+		xstep = -xstep;
+		ystep = -ystep;
+	}
+
+	planeang += M_PI/2;
+	double cosine = cos(planeang), sine = -sin(planeang);
+	x = pl->right - centerx - 0.5;
+	rightxfrac = _xscale * (cosine + x * xstep);
+	rightyfrac = _yscale * (sine + x * ystep);
+	x = pl->left - centerx - 0.5;
+	leftxfrac = _xscale * (cosine + x * xstep);
+	leftyfrac = _yscale * (sine + x * ystep);
+
+	state.basexfrac = rightxfrac;
+	state.baseyfrac = rightyfrac;
+	state.xstepscale = (rightxfrac - leftxfrac) / (pl->right - pl->left);
+	state.ystepscale = (rightyfrac - leftyfrac) / (pl->right - pl->left);
+
+	state.planeheight = fabs(pl->height.Zat0() - ViewPos.Z);
+	state.globvis = r_FloorVisibility / state.planeheight;
+	state.basecolormapdata = pl->colormap->Maps;
+	state.planeshade = LIGHT2SHADE(pl->lightlevel);
+
+	if (fixedlightlev >= 0)
+		state.colormap = pl->colormap->Maps + fixedlightlev, state.shade = false;
+	else if (fixedcolormap)
+		state.colormap = fixedcolormap, state.shade = false;
+	else
+		state.colormap = NULL, state.shade = true;
+
+	return true;
+}
+
+//==========================================================================
+//
+// R_MapPlaneParallel
+//
+// R_MapPlane plus the unmasked C span drawer, reading from the captured
+// state instead of the ds_* globals.
+//
+//==========================================================================
+
+static void R_MapPlaneParallel (FParallelPlaneState &state, const short *spanend, int y, int x1)
+{
+	int x2 = spanend[y];
+	double distance = state.planeheight * yslope[y];
+	dsfixed_t xfrac, yfrac, xstep, ystep;
+	const BYTE *colormap;
+	const BYTE *source = state.source;
+	BYTE *dest;
+	int count, spot;
+
+	if (state.xbits != 0)
+	{
+		xstep = xs_ToFixed(32 - state.xbits, distance * state.xstepscale);
+		xfrac = xs_ToFixed(32 - state.xbits, distance * state.basexfrac) + state.pviewx;
+	}
+	else
+	{
+		xstep = 0;
+		xfrac = 0;
+	}
+	if (state.ybits != 0)
+	{
+		ystep = xs_ToFixed(32 - state.ybits, distance * state.ystepscale);
+		yfrac = xs_ToFixed(32 - state.ybits, distance * state.baseyfrac) + state.pviewy;
+	}
+	else
+	{
+		ystep = 0;
+		yfrac = 0;
+	}
+
+	if (state.shade)
+	{
+		colormap = state.basecolormapdata + (GETPALOOKUP (
+			state.globvis * fabs(CenterY - y), state.planeshade) << COLORMAPSHIFT);
+	}
+	else
+	{
+		colormap = state.colormap;
+	}
+
+	dest = ylookup[y] + x1 + dc_destorg;
+	count = x2 - x1 + 1;
+
+	if (state.xbits == 6 && state.ybits == 6)
+	{
+		// 64x64 is the most common case by far, so special case it.
+		do
+		{
+			spot = ((xfrac>>(32-6-6))&(63*64)) + (yfrac>>(32-6));
+			*dest++ = colormap[source[spot]];
+			xfrac += xstep;
+			yfrac += ystep;
+		} while (--count);
+	}
+	else
+	{
+		BYTE yshift = 32 - state.ybits;
+		BYTE xshift = yshift - state.xbits;
+		int xmask = ((1 << state.xbits) - 1) << state.ybits;
+
+		do
+		{
+			spot = ((xfrac >> xshift) & xmask) + (yfrac >> yshift);
+			*dest++ = colormap[source[spot]];
+			xfrac += xstep;
+			yfrac += ystep;
+		} while (--count);
+	}
+}
+
+//==========================================================================
+//
+// R_DrawVisPlaneParallel
+//
+// The R_MapVisPlane traversal with a local span table, so that several
+// planes can be in flight at once.
+//
+//==========================================================================
+
+static void R_DrawVisPlaneParallel (visplane_t *pl, FParallelPlaneState &state)
+{
+	short spanend[MAXHEIGHT];
+	int x = pl->right - 1;
+	int t2 = pl->top[x];
+	int b2 = pl->bottom[x];
+
+	if (b2 > t2)
+	{
+		clearbufshort (spanend+t2, b2-t2, x);
+	}
+
+	for (--x; x >= pl->left; --x)
+	{
+		int t1 = pl->top[x];
+		int b1 = pl->bottom[x];
+		const int xr = x+1;
+		int stop;
+
+		// Draw any spans that have just closed
+		stop = MIN (t1, b2);
+		while (t2 < stop)
+		{
+			R_MapPlaneParallel (state, spanend, t2++, xr);
+		}
+		stop = MAX (b1, t2);
+		while (b2 > stop)
+		{
+			R_MapPlaneParallel (state, spanend, --b2, xr);
+		}
+
+		// Mark any spans that have just opened
+		stop = MIN (t2, b1);
+		while (t1 < stop)
+		{
+			spanend[t1++] = x;
+		}
+		stop = MAX (b2, t2);
+		while (b1 > stop)
+		{
+			spanend[--b1] = x;
+		}
+
+		t2 = pl->top[x];
+		b2 = pl->bottom[x];
+		state.basexfrac -= state.xstepscale;
+		state.baseyfrac -= state.ystepscale;
+	}
+	// Draw any spans that are still open
+	while (t2 < b2)
+	{
+		R_MapPlaneParallel (state, spanend, --b2, pl->left);
+	}
+}
+
+#endif	// !X86_ASM
+
 int R_DrawPlanes ()
 {
 	visplane_t *pl;
@@ -1190,6 +1502,12 @@ int R_DrawPlanes ()
 
 	ds_color = 3;
 
+#ifndef X86_ASM
+	TArray<visplane_t *> parallelplanes;
+	bool useparallel = r_parallelplanes && !r_drawflat &&
+		FThreadPool::Instance().NumThreads() > 1;
+#endif
+
 	for (i = 0; i < MAXVISPLANES; i++)
 	{
 		for (pl = visplanes[i]; pl; pl = pl->next)
@@ -1200,10 +1518,40 @@ int R_DrawPlanes ()
 			// kg3D - draw only real planes now
 			if(pl->sky >= 0) {
 				vpcount++;
+#ifndef X86_ASM
+				if (useparallel && pl->left < pl->right &&
+					pl->picnum != skyflatnum && !pl->height.isSlope() && !tilt)
+				{
+					parallelplanes.Push (pl);
+					continue;
+				}
+#endif
 				R_DrawSinglePlane (pl, OPAQUE, false, false);
 			}
 		}
 	}
+#ifndef X86_ASM
+	if (parallelplanes.Size() > 0)
+	{
+		TArray<FParallelPlaneState> states;
+		states.Resize (parallelplanes.Size());
+		for (unsigned j = 0; j < parallelplanes.Size(); ++j)
+		{
+			if (!R_SetupParallelPlane (parallelplanes[j], states[j]))
+			{
+				states[j].source = NULL;
+			}
+		}
+		FThreadPool::Instance().ParallelFor (parallelplanes.Size(), [&](int j)
+		{
+			if (states[j].source != NULL)
+			{
+				R_DrawVisPlaneParallel (parallelplanes[j], states[j]);
+			}
+		});
+		NetUpdate ();
+	}
+#endif
 	return vpcount;
 }
 
@@ -1323,6 +1671,7 @@ static int numskyboxes;
 void R_DrawPortals ()
 {
 	static TArray<size_t> interestingStack;
+	static TArray<size_t> clippingStack;
 	static TArray<ptrdiff_t> drawsegStack;
 	static TArray<ptrdiff_t> visspriteStack;
 	static TArray<DVector3> viewposStack;
@@ -1343,6 +1692,7 @@ void R_DrawPortals ()
 	ptrdiff_t savedds_p = ds_p - drawsegs;
 	ptrdiff_t savedlastopening = lastopening;
 	size_t savedinteresting = FirstInterestingDrawseg;
+	size_t savedclipping = FirstClippingDrawseg;
 	double savedvisibility = R_GetVisibility();
 	AActor *savedcamera = camera;
 	sector_t *savedsector = viewsector;
@@ -1367,6 +1717,7 @@ void R_DrawPortals ()
 		}
 
 		numskyboxes++;
+		sw_rendered_portals++;
 
 		FSectorPortal *port = pl->portal;
 		switch (port->mType)
@@ -1457,8 +1808,13 @@ void R_DrawPortals ()
 		firstvissprite = vissprite_p;
 		firstdrawseg = ds_p++;
 		FirstInterestingDrawseg = InterestingDrawsegs.Size();
+		// The dummy drawseg above has a silhouette, so the sprite clipper
+		// inside the skybox must see it.
+		FirstClippingDrawseg = ClippingDrawsegs.Size();
+		ClippingDrawsegs.Push (firstdrawseg - drawsegs);
 
 		interestingStack.Push (FirstInterestingDrawseg);
+		clippingStack.Push (FirstClippingDrawseg);
 		ptrdiff_t diffnum = firstdrawseg - drawsegs;
 		drawsegStack.Push (diffnum);
 		diffnum = firstvissprite - vissprites;
@@ -1482,6 +1838,7 @@ void R_DrawPortals ()
 	{
 		ptrdiff_t pd = 0;
 
+		clippingStack.Pop (FirstClippingDrawseg);
 		drawsegStack.Pop (pd);
 		firstdrawseg = drawsegs + pd;
 		visspriteStack.Pop (pd);
@@ -1494,6 +1851,10 @@ void R_DrawPortals ()
 
 		ds_p = firstdrawseg;
 		vissprite_p = firstvissprite;
+		// Match the drawseg rollback above, so that the next skybox popped
+		// off the stack does not see the entries of this one.
+		InterestingDrawsegs.Resize ((unsigned int)FirstInterestingDrawseg);
+		ClippingDrawsegs.Resize ((unsigned int)FirstClippingDrawseg);
 
 		visplaneStack.Pop (pl);
 		if (pl->Alpha > 0 && pl->picnum != skyflatnum)
@@ -1509,6 +1870,8 @@ void R_DrawPortals ()
 	ds_p = drawsegs + savedds_p;
 	InterestingDrawsegs.Resize ((unsigned int)FirstInterestingDrawseg);
 	FirstInterestingDrawseg = savedinteresting;
+	ClippingDrawsegs.Resize ((unsigned int)FirstClippingDrawseg);
+	FirstClippingDrawseg = savedclipping;
 
 	lastopening = savedlastopening;
 
@@ -1898,9 +2261,16 @@ void R_DrawTiltedPlane (visplane_t *pl, double _xscale, double _yscale, fixed_t
 
 	if (!plane_shade)
 	{
-		for (int i = 0; i < viewwidth; ++i)
+		// This fill is the same for every fixed light plane in a scene, so
+		// skip it if the array still holds the wanted colormap.
+		if (tiltlighting_fill != ds_colormap || tiltlighting_fillwidth < viewwidth)
 		{
-			tiltlighting[i] = ds_colormap;
+			for (int i = 0; i < viewwidth; ++i)
+			{
+				tiltlighting[i] = ds_colormap;
+			}
+			tiltlighting_fill = ds_colormap;
+			tiltlighting_fillwidth = viewwidth;
 		}
 	}
 
@@ -2466,6 +2466,14 @@ void R_StoreWallRange (int start, int stop)
 		ds_p->silhouette |= SIL_TOP | SIL_BOTTOM;
 	}
 
+	// Now that the silhouette flags are final, record drawsegs that
+	// can affect sprite clipping, so R_DrawSprite does not have to scan the
+	// entire drawseg list for the few that matter.
+	if ((ds_p->silhouette & SIL_BOTH) || ds_p->maskedtexturecol != -1 || ds_p->bFogBoundary)
+	{
+		ClippingDrawsegs.Push (ds_p - drawsegs);
+	}
+
 	// [RH] Draw any decals bound to the seg
 	// [ZZ] Only if not an active mirror
 	if (!rw_markportal)
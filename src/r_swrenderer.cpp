@@ -42,6 +42,27 @@
 #include "r_3dfloors.h"
 #include "textures/textures.h"
 #include "r_data/voxels.h"
+#include "templates.h"
+
+EXTERN_CVAR (Int, png_savegame_level)
+
+// Renders the 3D view at a fraction of the output resolution and scales it
+// up into the view window, so high output resolutions stay playable without
+// giving up the software look. The HUD, menus and console are unaffected
+// since they draw straight to the screen afterwards.
+CUSTOM_CVAR (Float, r_viewscale, 1.f, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
+{
+	if (self < 0.25f)
+	{
+		self = 0.25f;
+	}
+	else if (self > 1.f)
+	{
+		self = 1.f;
+	}
+}
+
+static DSimpleCanvas *ScaledViewCanvas;
 
 
 void R_SWRSetWindow(int windowSize, int fullWidth, int fullHeight, int stHeight, float trueratio);
@@ -81,6 +102,13 @@ void FSoftwareRenderer::PrecacheTexture(FTexture *tex, int cache)
 {
 	if (tex != NULL)
 	{
+		if (cache & FTextureManager::HIT_Sky)
+		{
+			// Compute the cap colors for sky rendering up front; they stick
+			// to the texture, so this only costs anything the first time a
+			// given sky gets used.
+			tex->GetSkyCapColor(false);
+		}
 		if (cache & FTextureManager::HIT_Columnmode)
 		{
 			const FTexture::Span *spanp;
@@ -139,6 +167,12 @@ void FSoftwareRenderer::Precache(BYTE *texhitlist, TMap<PClassActor*, bool> &act
 	}
 	delete[] spritelist;
 
+	// This loop stays on the main thread on purpose: texture decoding goes
+	// through FWadLump readers that share the archive's FILE handle and the
+	// unsynchronized lump cache, and composite textures recurse into patch
+	// textures that other entries in the hit list may reference as well.
+	// The costly parts that can be made concurrent safely (archive entry
+	// decompression, texture upscaling) already run on the worker pool.
 	int cnt = TexMan.NumTextures();
 	for (int i = cnt - 1; i >= 0; i--)
 	{
@@ -148,15 +182,80 @@ void FSoftwareRenderer::Precache(BYTE *texhitlist, TMap<PClassActor*, bool> &act
 
 //===========================================================================
 //
-// Render the view 
+// R_ScaleBlit
+//
+// Replicates the reduced-resolution view into the view window. A plain
+// point scale keeps everything in the palette-indexed domain; the view is
+// 8 bit from the columns right through to the final blit, so the RGBA
+// scalers used for textures cannot be applied here.
+//
+//===========================================================================
+
+static void R_ScaleBlit (BYTE *dest, int dpitch, int dwidth, int dheight,
+	const BYTE *src, int spitch, int swidth, int sheight)
+{
+	fixed_t xstep = (swidth << FRACBITS) / dwidth;
+	fixed_t ystep = (sheight << FRACBITS) / dheight;
+	fixed_t ypos = 0;
+
+	for (int y = 0; y < dheight; y++)
+	{
+		const BYTE *srcline = src + (ypos >> FRACBITS) * spitch;
+		fixed_t xpos = 0;
+		for (int x = 0; x < dwidth; x++)
+		{
+			dest[x] = srcline[xpos >> FRACBITS];
+			xpos += xstep;
+		}
+		dest += dpitch;
+		ypos += ystep;
+	}
+}
+
+//===========================================================================
+//
+// Render the view
 //
 //===========================================================================
 
 void FSoftwareRenderer::RenderView(player_t *player)
 {
-	R_RenderActorView (player->mo);
+	if (r_viewscale < 1.f && viewactive)
+	{
+		// Render into a reduced canvas and scale the result into the view
+		// window instead of rendering every output pixel.
+		int w = MAX<int> (8, int(viewwidth * r_viewscale));
+		int h = MAX<int> (8, int(viewheight * r_viewscale));
+
+		if (ScaledViewCanvas != NULL &&
+			(ScaledViewCanvas->GetWidth() != w || ScaledViewCanvas->GetHeight() != h))
+		{
+			ScaledViewCanvas->Destroy();
+			ScaledViewCanvas->ObjectFlags |= OF_YesReallyDelete;
+			delete ScaledViewCanvas;
+			ScaledViewCanvas = NULL;
+		}
+		if (ScaledViewCanvas == NULL)
+		{
+			ScaledViewCanvas = new DSimpleCanvas (w, h);
+			ScaledViewCanvas->ObjectFlags |= OF_Fixed;
+		}
+
+		ScaledViewCanvas->Lock ();
+		R_RenderViewToCanvas (player->mo, ScaledViewCanvas, 0, 0, w, h);
+		R_ScaleBlit (screen->GetBuffer() + viewwindowy * screen->GetPitch() + viewwindowx,
+			screen->GetPitch(), viewwidth, viewheight,
+			ScaledViewCanvas->GetBuffer(), ScaledViewCanvas->GetPitch(), w, h);
+		ScaledViewCanvas->Unlock ();
+	}
+	else
+	{
+		R_RenderActorView (player->mo);
+	}
 	// [RH] Let cameras draw onto textures that were visible this frame.
 	FCanvasTextureInfo::UpdateAll ();
+	// Evict stale texture pixel data if the cache has outgrown its budget.
+	TexMan.SweepPixelCache ();
 }
 
 //==========================================================================
@@ -189,7 +288,7 @@ void FSoftwareRenderer::WriteSavePic (player_t *player, FileWriter *file, int wi
 	pic->Lock ();
 	R_RenderViewToCanvas (player->mo, pic, 0, 0, width, height);
 	screen->GetFlashedPalette (palette);
-	M_CreatePNG (file, pic->GetBuffer(), palette, SS_PAL, width, height, pic->GetPitch());
+	M_CreatePNG (file, pic->GetBuffer(), palette, SS_PAL, width, height, pic->GetPitch(), png_savegame_level);
 	pic->Unlock ();
 	pic->Destroy();
 	pic->ObjectFlags |= OF_YesReallyDelete;
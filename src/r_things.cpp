@@ -233,6 +233,7 @@ vissprite_t *R_NewVisSprite (void)
 	}
 
 	vissprite_p++;
+	sw_added_sprites++;
 	return *(vissprite_p-1);
 }
 
@@ -385,6 +386,8 @@ void R_DrawVisSprite (vissprite_t *vis)
 		return;
 	}
 
+	sw_drawn_sprites++;
+
 	fixed_t centeryfrac = FLOAT2FIXED(CenterY);
 	dc_colormap = vis->Style.colormap;
 
@@ -631,6 +634,8 @@ void R_DrawVisVoxel(vissprite_t *spr, int minslabz, int maxslabz, short *cliptop
 	ESPSResult mode;
 	int flags = 0;
 
+	sw_drawn_sprites++;
+
 	// Do setup for blending.
 	dc_colormap = spr->Style.colormap;
 	mode = R_SetPatchStyle(spr->Style.RenderStyle, spr->Style.Alpha, spr->Translation, spr->FillColor);
@@ -1215,6 +1220,10 @@ void R_AddSprites (sector_t *sec, int lightlevel, int fakeside)
 	// A sector might have been split into several
 	//	subsectors during BSP building.
 	// Thus we check whether it was already added.
+	// Note that this check also means each actor is only visited once
+	// per frame: thinglist holds an actor in its center sector alone
+	// (touching_thinglist is the multi-sector contact list and is not
+	// consulted here), so no per-actor dedup marking is needed either.
 	if (sec->thinglist == NULL || sec->validcount == validcount)
 		return;
 
@@ -1882,6 +1891,74 @@ static void swap(vissprite_t *&a, vissprite_t *&b)
 }
 #endif
 
+// With thousands of vissprites the comparison overhead of stable_sort
+// dominates, so big batches take a stable byte-wise radix sort on the
+// depth key instead. The keys are positive floats, whose bit patterns
+// order the same way the values do.
+static TArray<DWORD> spritekeys[2];
+static TArray<vissprite_t *> spritepass;
+
+static void R_RadixSortSprites (bool voxview)
+{
+	union { float f; DWORD bits; } conv;
+	int i;
+
+	spritekeys[0].Resize(vsprcount);
+	spritekeys[1].Resize(vsprcount);
+	spritepass.Resize(vsprcount);
+
+	for (i = 0; i < vsprcount; ++i)
+	{
+		if (voxview)
+		{ // sv_compare2d: nearest 2D distance first
+			conv.f = spritesorter[i]->deltax * spritesorter[i]->deltax +
+					 spritesorter[i]->deltay * spritesorter[i]->deltay;
+			spritekeys[0][i] = conv.bits;
+		}
+		else
+		{ // sv_compare: largest inverse depth first
+			conv.f = spritesorter[i]->idepth;
+			spritekeys[0][i] = ~conv.bits;
+		}
+	}
+
+	vissprite_t **src = spritesorter, **dst = &spritepass[0];
+	DWORD *srckeys = &spritekeys[0][0], *dstkeys = &spritekeys[1][0];
+
+	for (int shift = 0; shift < 32; shift += 8)
+	{
+		unsigned counts[256] = { 0 };
+
+		for (i = 0; i < vsprcount; ++i)
+		{
+			counts[(srckeys[i] >> shift) & 0xff]++;
+		}
+		if (counts[(srckeys[0] >> shift) & 0xff] == (unsigned)vsprcount)
+		{ // every key shares this byte, so the pass would not move anything
+			continue;
+		}
+		unsigned total = 0;
+		for (i = 0; i < 256; ++i)
+		{
+			unsigned c = counts[i];
+			counts[i] = total;
+			total += c;
+		}
+		for (i = 0; i < vsprcount; ++i)
+		{
+			unsigned slot = counts[(srckeys[i] >> shift) & 0xff]++;
+			dst[slot] = src[i];
+			dstkeys[slot] = srckeys[i];
+		}
+		swapvalues(src, dst);
+		swapvalues(srckeys, dstkeys);
+	}
+	if (src != spritesorter)
+	{
+		memcpy(spritesorter, src, vsprcount * sizeof(*src));
+	}
+}
+
 void R_SortVisSprites (bool (*compare)(vissprite_t *, vissprite_t *), size_t first)
 {
 	int i;
@@ -1918,7 +1995,16 @@ void R_SortVisSprites (bool (*compare)(vissprite_t *, vissprite_t *), size_t fir
 		}
 	}
 
-	std::stable_sort(&spritesorter[0], &spritesorter[vsprcount], compare);
+	// The radix sort only pays for itself once there are enough sprites to
+	// amortize its key building and counting passes.
+	if (vsprcount >= 64 && (compare == sv_compare || compare == sv_compare2d))
+	{
+		R_RadixSortSprites (compare == sv_compare2d);
+	}
+	else
+	{
+		std::stable_sort(&spritesorter[0], &spritesorter[vsprcount], compare);
+	}
 }
 
 //
@@ -2205,14 +2291,13 @@ void R_DrawSprite (vissprite_t *spr)
 	// Scan drawsegs from end to start for obscuring segs.
 	// The first drawseg that is closer than the sprite is the clip seg.
 
-	// Modified by Lee Killough:
-	// (pointer check was originally nonportable
-	// and buggy, by going past LEFT end of array):
+	// Only drawsegs with a silhouette or a masked texture can affect the
+	// sprite, and those were recorded when they were stored, so the scan
+	// is over that list instead of the full drawseg array.
 
-	//		for (ds=ds_p-1 ; ds >= drawsegs ; ds--)    old buggy code
-
-	for (ds = ds_p; ds-- > firstdrawseg; )  // new -- killough
+	for (unsigned int index = ClippingDrawsegs.Size(); index-- > FirstClippingDrawseg; )
 	{
+		ds = &drawsegs[ClippingDrawsegs[index]];
 		// [ZZ] portal handling here
 		//if (ds->CurrentPortalUniq != spr->CurrentPortalUniq)
 		//	continue;
@@ -2362,18 +2447,16 @@ void R_DrawMaskedSingle (bool renew)
 
 	// render any remaining masked mid textures
 
-	// Modified by Lee Killough:
-	// (pointer check was originally nonportable
-	// and buggy, by going past LEFT end of array):
-
-	//		for (ds=ds_p-1 ; ds >= drawsegs ; ds--)    old buggy code
+	// InterestingDrawsegs already holds exactly the drawsegs with a masked
+	// texture or fog boundary, so there is no need to scan all of them.
 
 	if (renew)
 	{
 		fake3D |= FAKE3D_REFRESHCLIP;
 	}
-	for (ds = ds_p; ds-- > firstdrawseg; )	// new -- killough
+	for (unsigned int index = InterestingDrawsegs.Size(); index-- > FirstInterestingDrawseg; )
 	{
+		ds = &drawsegs[InterestingDrawsegs[index]];
 		// [ZZ] the same as above
 		if (ds->CurrentPortalUniq != CurrentPortalUniq)
 			continue;
@@ -304,6 +304,17 @@ CUSTOM_CVAR (Int, screenblocks, 10, CVAR_ARCHIVE)
 //
 //==========================================================================
 
+// One-entry result cache. The renderer asks about the unchanged view point
+// several times per frame and plenty of playsim callers re-query a position
+// that has not moved, so the full node walk often just repeats itself.
+static fixed_t PointInSubsectorX, PointInSubsectorY;
+static subsector_t *PointInSubsectorResult;
+
+void R_ClearPointInSubsectorCache ()
+{
+	PointInSubsectorResult = NULL;
+}
+
 subsector_t *R_PointInSubsector (fixed_t x, fixed_t y)
 {
 	node_t *node;
@@ -312,7 +323,10 @@ subsector_t *R_PointInSubsector (fixed_t x, fixed_t y)
 	// single subsector is a special case
 	if (numnodes == 0)
 		return subsectors;
-				
+
+	if (PointInSubsectorResult != NULL && x == PointInSubsectorX && y == PointInSubsectorY)
+		return PointInSubsectorResult;
+
 	node = nodes + numnodes - 1;
 
 	do
@@ -321,8 +335,11 @@ subsector_t *R_PointInSubsector (fixed_t x, fixed_t y)
 		node = (node_t *)node->children[side];
 	}
 	while (!((size_t)node & 1));
-		
-	return (subsector_t *)((BYTE *)node - 1);
+
+	PointInSubsectorX = x;
+	PointInSubsectorY = y;
+	PointInSubsectorResult = (subsector_t *)((BYTE *)node - 1);
+	return PointInSubsectorResult;
 }
 
 //==========================================================================
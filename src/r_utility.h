@@ -77,6 +77,7 @@ struct DVector3a
 
 
 subsector_t *R_PointInSubsector (fixed_t x, fixed_t y);
+void R_ClearPointInSubsectorCache ();
 inline subsector_t *R_PointInSubsector(const DVector2 &pos)
 {
 	return R_PointInSubsector(FLOAT2FIXED(pos.X), FLOAT2FIXED(pos.Y));
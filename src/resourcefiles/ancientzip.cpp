@@ -240,6 +240,14 @@ int FZipExploder::Explode(unsigned char *out, unsigned int outsize,
 	InLeft = insize;
 	bs = be = 0;
 
+	// The decoder tables grow by appending, so throw away whatever a
+	// previous call may have left in them. With this an exploder object
+	// can be reused, and since there is no global state anywhere in this
+	// file, separate instances can safely decode on separate threads.
+	LiteralDecoder.Clear();
+	LengthDecoder.Clear();
+	DistanceDecoder.Clear();
+
 	if ((flags & 4)) {
 		/* 3 trees: literals, lengths, distance top 6 */
 		minMatchLen = 3;
@@ -46,6 +46,7 @@
 #include "w_zip.h"
 #include "i_system.h"
 #include "w_wad.h"
+#include "threadpool.h"
 
 
 
@@ -258,27 +259,29 @@ bool F7ZFile::Open(bool quiet)
 	NumLumps = archPtr->NumFiles;
 	Lumps = new F7ZLump[NumLumps];
 
-	F7ZLump *lump_p = Lumps;
-	TArray<UInt16> nameUTF16;
-	TArray<char> nameASCII;
-
+	// Weed out directories and nameless entries first; the remaining
+	// per-entry setup only reads the archive database and writes to its
+	// own lump record, so it can run on the worker pool.
+	TArray<DWORD> entries((int)NumLumps);
 	for (DWORD i = 0; i < NumLumps; ++i)
 	{
-		// skip Directories
-		if (SzArEx_IsDir(archPtr, i))
+		if (SzArEx_IsDir(archPtr, i) || 0 == SzArEx_GetFileNameUtf16(archPtr, i, NULL))
 		{
 			skipped++;
 			continue;
 		}
+		entries.Push(i);
+	}
 
-		const size_t nameLength = SzArEx_GetFileNameUtf16(archPtr, i, NULL);
+	FThreadPool::Instance().ParallelFor((int)entries.Size(), [&](int j)
+	{
+		const DWORD i = entries[j];
+		F7ZLump *lump_p = &Lumps[j];
 
-		if (0 == nameLength)
-		{
-			++skipped;
-			continue;
-		}
+		const size_t nameLength = SzArEx_GetFileNameUtf16(archPtr, i, NULL);
 
+		TArray<UInt16> nameUTF16;
+		TArray<char> nameASCII;
 		nameUTF16.Resize((unsigned)nameLength);
 		nameASCII.Resize((unsigned)nameLength);
 		SzArEx_GetFileNameUtf16(archPtr, i, &nameUTF16[0]);
@@ -297,8 +300,7 @@ bool F7ZFile::Open(bool quiet)
 		lump_p->Flags = LUMPF_ZIPFILE;
 		lump_p->Position = i;
 		lump_p->CheckEmbedded();
-		lump_p++;
-	}
+	});
 	// Resize the lump record array to its actual size
 	NumLumps -= skipped;
 
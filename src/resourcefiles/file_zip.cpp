@@ -42,6 +42,7 @@
 #include "w_zip.h"
 #include "i_system.h"
 #include "ancientzip.h"
+#include "threadpool.h"
 
 #define BUFREADCOMMENT (0x400)
 
@@ -207,17 +208,20 @@ bool FZipFile::Open(bool quiet)
 	Reader->Seek(LittleLong(info.DirectoryOffset), SEEK_SET);
 	Reader->Read(directory, dirsize);
 
+	// Pass 1: decode the variable length central directory records and weed
+	// out everything that cannot be used. This has to stay serial because
+	// each record's position depends on the lengths of its predecessors
+	// (and skip diagnostics go through Printf).
 	char *dirptr = (char*)directory;
-	FZipLump *lump_p = Lumps;
+	TArray<FZipCentralDirectoryInfo *> entries((int)NumLumps);
 	for (DWORD i = 0; i < NumLumps; i++)
 	{
 		FZipCentralDirectoryInfo *zip_fh = (FZipCentralDirectoryInfo *)dirptr;
 
 		int len = LittleShort(zip_fh->NameLength);
-		FString name(dirptr + sizeof(FZipCentralDirectoryInfo), len);
-		dirptr += sizeof(FZipCentralDirectoryInfo) + 
-				  LittleShort(zip_fh->NameLength) + 
-				  LittleShort(zip_fh->ExtraLength) + 
+		dirptr += sizeof(FZipCentralDirectoryInfo) +
+				  LittleShort(zip_fh->NameLength) +
+				  LittleShort(zip_fh->ExtraLength) +
 				  LittleShort(zip_fh->CommentLength);
 
 		if (dirptr > ((char*)directory) + dirsize)	// This directory entry goes beyond the end of the file.
@@ -226,9 +230,10 @@ bool FZipFile::Open(bool quiet)
 			if (!quiet) Printf(TEXTCOLOR_RED "\n%s: Central directory corrupted.", Filename);
 			return false;
 		}
-		
+
 		// skip Directories
-		if (name[len - 1] == '/' && LittleLong(zip_fh->UncompressedSize) == 0) 
+		const char *entryname = (const char *)zip_fh + sizeof(FZipCentralDirectoryInfo);
+		if (entryname[len - 1] == '/' && LittleLong(zip_fh->UncompressedSize) == 0)
 		{
 			skipped++;
 			continue;
@@ -243,7 +248,7 @@ bool FZipFile::Open(bool quiet)
 			zip_fh->Method != METHOD_IMPLODE &&
 			zip_fh->Method != METHOD_SHRINK)
 		{
-			if (!quiet) Printf(TEXTCOLOR_YELLOW "\n%s: '%s' uses an unsupported compression algorithm (#%d).\n", Filename, name.GetChars(), zip_fh->Method);
+			if (!quiet) Printf(TEXTCOLOR_YELLOW "\n%s: '%s' uses an unsupported compression algorithm (#%d).\n", Filename, FString(entryname, len).GetChars(), zip_fh->Method);
 			skipped++;
 			continue;
 		}
@@ -251,11 +256,28 @@ bool FZipFile::Open(bool quiet)
 		zip_fh->Flags = LittleShort(zip_fh->Flags);
 		if (zip_fh->Flags & ZF_ENCRYPTED)
 		{
-			if (!quiet) Printf(TEXTCOLOR_YELLOW "\n%s: '%s' is encrypted. Encryption is not supported.\n", Filename, name.GetChars());
+			if (!quiet) Printf(TEXTCOLOR_YELLOW "\n%s: '%s' is encrypted. Encryption is not supported.\n", Filename, FString(entryname, len).GetChars());
 			skipped++;
 			continue;
 		}
 
+		entries.Push(zip_fh);
+	}
+
+	// Pass 2: each remaining entry's setup only touches its own lump record,
+	// so the name normalization and all the other per-lump work can be
+	// spread across the worker pool. For memory mapped or otherwise buffered
+	// archives the local file header fixup that is normally deferred to
+	// SetLumpAddress is done here as well, saving one seek per lump later.
+	const char *buffer = Reader->GetBuffer();
+	const long filelen = Reader->GetLength();
+	FThreadPool::Instance().ParallelFor((int)entries.Size(), [&](int i)
+	{
+		FZipCentralDirectoryInfo *zip_fh = entries[i];
+		FZipLump *lump_p = &Lumps[i];
+
+		int len = LittleShort(zip_fh->NameLength);
+		FString name((const char *)zip_fh + sizeof(FZipCentralDirectoryInfo), len);
 		FixPathSeperator(name);
 		name.ToLower();
 
@@ -277,8 +299,17 @@ bool FZipFile::Open(bool quiet)
 			memset(lump_p->Name, 0, sizeof(lump_p->Name));
 		}
 
-		lump_p++;
-	}
+		if (buffer != NULL && lump_p->Position + (long)sizeof(FZipLocalFileHeader) <= filelen)
+		{
+			// The whole file is already in memory, so the local file header
+			// can be skipped right away instead of on first access.
+			FZipLocalFileHeader *localHeader = (FZipLocalFileHeader *)(buffer + lump_p->Position);
+			lump_p->Position += (int)sizeof(FZipLocalFileHeader) +
+				LittleShort(localHeader->NameLength) + LittleShort(localHeader->ExtraLength);
+			lump_p->Flags &= ~LUMPFZIP_NEEDFILESTART;
+		}
+	});
+
 	// Resize the lump record array to its actual size
 	NumLumps -= skipped;
 	free(directory);
@@ -9,6 +9,9 @@ class FResourceFile;
 class FTexture;
 
 // This holds a compresed Zip entry with all needed info to decompress it.
+// mMethod must always be a method a zip archive can store, because these
+// buffers are written verbatim into savegames and other zips that external
+// tools are expected to be able to open.
 struct FCompressedBuffer
 {
 	unsigned mSize;
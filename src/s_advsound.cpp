@@ -420,6 +420,42 @@ void S_CheckIntegrity()
 	}
 }
 
+//==========================================================================
+//
+// S_FlattenAliases
+//
+// Path-compresses plain $alias chains so that playback resolution follows
+// one link instead of rewalking the chain on every sound start. A chain
+// node is only skipped if it contributes nothing of its own (no limit, no
+// custom rolloff), since S_StartSound picks those up along the walk. Must
+// run after S_CheckIntegrity has disabled recursive definitions.
+//
+//==========================================================================
+
+static void S_FlattenAliases()
+{
+	for (unsigned i = 0; i < S_sfx.Size(); ++i)
+	{
+		sfxinfo_t &sfx = S_sfx[i];
+
+		if (sfx.bRandomHeader || sfx.bPlayerReserve || sfx.link == sfxinfo_t::NO_LINK)
+		{
+			continue;
+		}
+
+		unsigned link = sfx.link;
+		while (S_sfx[link].link != sfxinfo_t::NO_LINK &&
+			!S_sfx[link].bRandomHeader &&
+			!S_sfx[link].bPlayerReserve &&
+			S_sfx[link].NearLimit < 0 &&
+			S_sfx[link].Rolloff.MinDistance == 0)
+		{
+			link = S_sfx[link].link;
+		}
+		sfx.link = link;
+	}
+}
+
 //==========================================================================
 //
 // S_PickReplacement
@@ -1035,6 +1071,7 @@ void S_ParseSndInfo (bool redefine)
 
 	sfx_empty = Wads.CheckNumForName ("dsempty", ns_sounds);
 	S_CheckIntegrity();
+	S_FlattenAliases();
 }
 
 //==========================================================================
@@ -1056,6 +1093,7 @@ void S_AddLocalSndInfo(int lump)
 
 	S_ShrinkPlayerSoundLists ();
 	S_CheckIntegrity();
+	S_FlattenAliases();
 }
 
 //==========================================================================
@@ -2252,10 +2290,23 @@ void AAmbientSound::MarkPrecacheSounds() const
 
 void AAmbientSound::Tick ()
 {
-	Super::Tick ();
-
 	if (!bActive || level.maptime < NextCheck)
+	{
+		// A dormant ambient is just a timer. If it is sitting still in its
+		// infinitely long spawn state, with nothing for gravity to do, the
+		// full actor machinery in Super::Tick would be a no-op for it, so
+		// don't bother running it. Maps decorated with thousands of
+		// emitters otherwise pay full actor ticks for all of them.
+		if (Vel.isZero() && tics == -1 && Inventory == NULL &&
+			((flags & MF_NOGRAVITY) || Z() <= floorz))
+		{
+			return;
+		}
+		Super::Tick ();
 		return;
+	}
+
+	Super::Tick ();
 
 	FAmbientSound *ambient;
 	int loop = 0;
@@ -36,6 +36,7 @@
 #include "s_playlist.h"
 #include "c_dispatch.h"
 #include "m_random.h"
+#include "profiler.h"
 #include "w_wad.h"
 #include "doomdef.h"
 #include "p_local.h"
@@ -120,11 +121,17 @@ static MusPlayingInfo mus_playing;	// music currently being played
 static FString	 LastSong;			// last music that was played
 static FPlayList *PlayList;
 static int		RestartEvictionsAt;	// do not restart evicted channels before this level.time
+static TMap<int, int> LoadedLumps;	// lump number -> S_sfx index owning the loaded data
 
 // PUBLIC DATA DEFINITIONS -------------------------------------------------
 
 int sfx_empty;
 
+// Channels links only the channels that are currently playing, so the
+// various per-source scans (S_StopSound, S_GetSoundPlayingInfo etc.) walk
+// at most snd_channels entries. A per-source index would not pay for the
+// bookkeeping it needs at every point a channel starts, ends, is evicted
+// or is relinked to another source.
 FSoundChan *Channels;
 FSoundChan *FreeChannels;
 
@@ -533,7 +540,10 @@ void S_CacheSound (sfxinfo_t *sfx)
 		}
 		else
 		{
-			S_LoadSound(sfx);
+			// Also decode the monoized 3D variant now. Nearly every world
+			// sound gets started in 3D, and deferring this to the first play
+			// means running the decoder again in the middle of the action.
+			S_LoadSound3D(S_LoadSound(sfx));
 			sfx->bUsed = true;
 		}
 	}
@@ -554,6 +564,11 @@ void S_UnloadSound (sfxinfo_t *sfx)
 		GSnd->UnloadSound(sfx->data);
 		sfx->data.Clear();
         sfx->data3d.Clear();
+		int *lumpowner = LoadedLumps.CheckKey(sfx->lumpnum);
+		if (lumpowner != nullptr && *lumpowner == int(sfx - &S_sfx[0]))
+		{
+			LoadedLumps.Remove(sfx->lumpnum);
+		}
 		DPrintf(DMSG_NOTIFY, "Unloaded sound \"%s\" (%td)\n", sfx->name.GetChars(), sfx - &S_sfx[0]);
 	}
 }
@@ -1351,9 +1366,11 @@ sfxinfo_t *S_LoadSound(sfxinfo_t *sfx)
 		
 		// See if there is another sound already initialized with this lump. If so,
 		// then set this one up as a link, and don't load the sound again.
-		for (i = 0; i < S_sfx.Size(); i++)
+		int *lumpowner = LoadedLumps.CheckKey(sfx->lumpnum);
+		if (lumpowner != nullptr)
 		{
-			if (S_sfx[i].data.isValid() && S_sfx[i].link == sfxinfo_t::NO_LINK && S_sfx[i].lumpnum == sfx->lumpnum)
+			i = *lumpowner;
+			if (S_sfx[i].data.isValid() && S_sfx[i].link == sfxinfo_t::NO_LINK)
 			{
 				DPrintf (DMSG_NOTIFY, "Linked %s to %s (%d)\n", sfx->name.GetChars(), S_sfx[i].name.GetChars(), i);
 				sfx->link = i;
@@ -1402,6 +1419,8 @@ sfxinfo_t *S_LoadSound(sfxinfo_t *sfx)
             sfx->data = snd.first;
             if(snd.second)
                 sfx->data3d = sfx->data;
+            if(sfx->data.isValid())
+                LoadedLumps[sfx->lumpnum] = int(sfx - &S_sfx[0]);
 		}
 
 		if (!sfx->data.isValid())
@@ -1991,6 +2010,47 @@ void S_RestoreEvictedChannels()
 	S_RestoreEvictedChannel(Channels);
 }
 
+//==========================================================================
+//
+// S_ChannelOutOfRange
+//
+// Cheap audibility pre-check for the per-frame 3D updates. A sound that
+// is beyond its rolloff's maximum distance plays at zero volume, so there
+// is no point in running the full position calculation and the backend
+// round trip for it; a plain distance test against the source actor is
+// enough to decide when it needs attention again. Only simple actor
+// sounds qualify: sector and polyobject origins depend on the listener's
+// position in non-trivial ways, and logarithmic rolloff never goes fully
+// silent.
+//
+//==========================================================================
+
+static bool S_ChannelOutOfRange (FSoundChan *chan, AActor *listenactor)
+{
+	if (chan->SourceType != SOURCE_Actor || chan->Actor == NULL || listenactor == NULL ||
+		chan->Rolloff.RolloffType == ROLLOFF_Log || chan->DistanceScale <= 0 ||
+		(chan->ChanFlags & (CHAN_JUSTSTARTED | CHAN_AREA | CHAN_LISTENERZ)))
+	{
+		return false;
+	}
+
+	DVector2 disp = Displacements.getOffset(listenactor->Sector->PortalGroup, chan->Actor->Sector->PortalGroup);
+	DVector3 delta = chan->Actor->Pos() - disp - listenactor->Pos();
+	double distsqr = delta.LengthSquared();
+
+	double range = chan->Rolloff.MaxDistance / chan->DistanceScale;
+	bool wasfar = chan->DistanceSqr > range * range;
+
+	// Keep the last known distance current so the channel eviction logic
+	// still picks the most distant victim.
+	chan->DistanceSqr = (float)distsqr;
+
+	// Let one full update through when the sound first leaves the audible
+	// range so the backend gets its volume set to zero before the updates
+	// stop.
+	return wasfar && distsqr > range * range;
+}
+
 //==========================================================================
 //
 // S_UpdateSounds
@@ -2003,6 +2063,7 @@ void S_UpdateSounds (AActor *listenactor)
 	FVector3 pos, vel;
 	SoundListener listener;
 
+	PROF_ZONE ("sound");
 	I_UpdateMusic();
 
 	// [RH] Update music and/or playlist. IsPlaying() must be called
@@ -2023,8 +2084,13 @@ void S_UpdateSounds (AActor *listenactor)
 	{
 		if ((chan->ChanFlags & (CHAN_EVICTED | CHAN_IS3D)) == CHAN_IS3D)
 		{
-			CalcPosVel(chan, &pos, &vel);
-			GSnd->UpdateSoundParams3D(&listener, chan, !!(chan->ChanFlags & CHAN_AREA), pos, vel);
+			// Inaudibly distant sounds get nothing but the distance check
+			// until the gap closes again.
+			if (!S_ChannelOutOfRange(chan, listenactor))
+			{
+				CalcPosVel(chan, &pos, &vel);
+				GSnd->UpdateSoundParams3D(&listener, chan, !!(chan->ChanFlags & CHAN_AREA), pos, vel);
+			}
 		}
 		chan->ChanFlags &= ~CHAN_JUSTSTARTED;
 	}
@@ -67,6 +67,10 @@
 char nulspace[1024 * 1024 * 4];
 bool save_full = false;	// for testing. Should be removed afterward.
 
+// Use the binary backend for unformatted output. JSON remains available
+// for debugging broken savegames and is always used with save_formatted.
+CVAR(Bool, save_binary, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
+
 int utf8_encode(int32_t codepoint, char *buffer, int *size)
 {
 	if (codepoint < 0)
@@ -227,6 +231,81 @@ struct FJSONObject
 	}
 };
 
+//==========================================================================
+//
+// Binary backend. This writes the same value tree the JSON writers
+// produce, but as length-prefixed tags with raw numeric payloads, which
+// avoids all of rapidjson's number formatting and parsing. The byte
+// order marker in the header doubles as an endianness check on load;
+// numbers are stored native-endian.
+//
+// Strings are deduplicated: the first occurrence is written in full and
+// assigned the next index, repeats become a 4 byte back reference. Keys,
+// class names and sprite names repeat for every actor in a save, so this
+// collapses the bulk of the string data to one copy per unique name.
+//
+//==========================================================================
+
+#define BINSER_MAGIC	"GZSB"
+#define BINSER_VERSION	2
+#define BINSER_BOM		0x01020304u
+
+class FBinaryWriter
+{
+	rapidjson::StringBuffer &mOut;
+	TMap<FString, uint32_t> mStringTable;
+
+	void PutBytes(const void *data, size_t len)
+	{
+		memcpy(mOut.Push(len), data, len);
+	}
+
+	void PutByte(char c)
+	{
+		*mOut.Push(1) = c;
+	}
+
+	void PutString(char tag, char reftag, const char *k)
+	{
+		FString str(k);
+		uint32_t *index = mStringTable.CheckKey(str);
+		if (index != nullptr)
+		{
+			PutByte(reftag);
+			PutBytes(index, 4);
+			return;
+		}
+		mStringTable.Insert(str, mStringTable.CountUsed());
+		uint32_t len = (uint32_t)strlen(k);
+		PutByte(tag);
+		PutBytes(&len, 4);
+		PutBytes(k, len);
+	}
+
+public:
+	FBinaryWriter(rapidjson::StringBuffer &out) : mOut(out)
+	{
+		uint32_t bom = BINSER_BOM;
+		PutBytes(BINSER_MAGIC, 4);
+		PutByte(BINSER_VERSION);
+		PutBytes(&bom, 4);
+	}
+
+	void StartObject() { PutByte('{'); }
+	void EndObject() { PutByte('}'); }
+	void StartArray() { PutByte('['); }
+	void EndArray() { PutByte(']'); }
+	void Key(const char *k) { PutString('k', 'K', k); }
+	void String(const char *k) { PutString('s', 'S', k); }
+	void Null() { PutByte('N'); }
+	void Bool(bool k) { PutByte(k ? 'T' : 'F'); }
+	void Int(int32_t k) { PutByte('i'); PutBytes(&k, 4); }
+	void Uint(uint32_t k) { PutByte('u'); PutBytes(&k, 4); }
+	void Int64(int64_t k) { PutByte('I'); PutBytes(&k, 8); }
+	void Uint64(uint64_t k) { PutByte('U'); PutBytes(&k, 8); }
+	void Double(double k) { PutByte('d'); PutBytes(&k, 8); }
+};
+
 //==========================================================================
 //
 // some wrapper stuff to keep the RapidJSON dependencies out of the global headers.
@@ -241,21 +320,27 @@ struct FWriter
 
 	Writer *mWriter1;
 	PrettyWriter *mWriter2;
+	FBinaryWriter *mWriter3;
 	TArray<bool> mInObject;
 	rapidjson::StringBuffer mOutString;
 	TArray<DObject *> mDObjects;
 	TMap<DObject *, int> mObjectMap;
-	
-	FWriter(bool pretty)
+
+	FWriter(bool pretty, bool binary)
 	{
-		if (!pretty)
+		mWriter1 = nullptr;
+		mWriter2 = nullptr;
+		mWriter3 = nullptr;
+		if (binary)
+		{
+			mWriter3 = new FBinaryWriter(mOutString);
+		}
+		else if (!pretty)
 		{
 			mWriter1 = new Writer(mOutString);
-			mWriter2 = nullptr;
 		}
 		else
 		{
-			mWriter1 = nullptr;
 			mWriter2 = new PrettyWriter(mOutString);
 		}
 	}
@@ -264,6 +349,7 @@ struct FWriter
 	{
 		if (mWriter1) delete mWriter1;
 		if (mWriter2) delete mWriter2;
+		if (mWriter3) delete mWriter3;
 	}
 
 
@@ -276,36 +362,42 @@ struct FWriter
 	{
 		if (mWriter1) mWriter1->StartObject();
 		else if (mWriter2) mWriter2->StartObject();
+		else if (mWriter3) mWriter3->StartObject();
 	}
 
 	void EndObject()
 	{
 		if (mWriter1) mWriter1->EndObject();
 		else if (mWriter2) mWriter2->EndObject();
+		else if (mWriter3) mWriter3->EndObject();
 	}
 
 	void StartArray()
 	{
 		if (mWriter1) mWriter1->StartArray();
 		else if (mWriter2) mWriter2->StartArray();
+		else if (mWriter3) mWriter3->StartArray();
 	}
 
 	void EndArray()
 	{
 		if (mWriter1) mWriter1->EndArray();
 		else if (mWriter2) mWriter2->EndArray();
+		else if (mWriter3) mWriter3->EndArray();
 	}
 
 	void Key(const char *k)
 	{
 		if (mWriter1) mWriter1->Key(k);
 		else if (mWriter2) mWriter2->Key(k);
+		else if (mWriter3) mWriter3->Key(k);
 	}
 
 	void Null()
 	{
 		if (mWriter1) mWriter1->Null();
 		else if (mWriter2) mWriter2->Null();
+		else if (mWriter3) mWriter3->Null();
 	}
 
 	void String(const char *k)
@@ -313,6 +405,7 @@ struct FWriter
 		k = StringToUnicode(k);
 		if (mWriter1) mWriter1->String(k);
 		else if (mWriter2) mWriter2->String(k);
+		else if (mWriter3) mWriter3->String(k);
 	}
 
 	void String(const char *k, int size)
@@ -320,36 +413,42 @@ struct FWriter
 		k = StringToUnicode(k, size);
 		if (mWriter1) mWriter1->String(k);
 		else if (mWriter2) mWriter2->String(k);
+		else if (mWriter3) mWriter3->String(k);
 	}
 
 	void Bool(bool k)
 	{
 		if (mWriter1) mWriter1->Bool(k);
 		else if (mWriter2) mWriter2->Bool(k);
+		else if (mWriter3) mWriter3->Bool(k);
 	}
 
 	void Int(int32_t k)
 	{
 		if (mWriter1) mWriter1->Int(k);
 		else if (mWriter2) mWriter2->Int(k);
+		else if (mWriter3) mWriter3->Int(k);
 	}
 
 	void Int64(int64_t k)
 	{
 		if (mWriter1) mWriter1->Int64(k);
 		else if (mWriter2) mWriter2->Int64(k);
+		else if (mWriter3) mWriter3->Int64(k);
 	}
 
 	void Uint(uint32_t k)
 	{
 		if (mWriter1) mWriter1->Uint(k);
 		else if (mWriter2) mWriter2->Uint(k);
+		else if (mWriter3) mWriter3->Uint(k);
 	}
 
 	void Uint64(int64_t k)
 	{
 		if (mWriter1) mWriter1->Uint64(k);
 		else if (mWriter2) mWriter2->Uint64(k);
+		else if (mWriter3) mWriter3->Uint64(k);
 	}
 
 	void Double(double k)
@@ -362,6 +461,10 @@ struct FWriter
 		{
 			mWriter2->Double(k);
 		}
+		else if (mWriter3)
+		{
+			mWriter3->Double(k);
+		}
 	}
 
 };
@@ -383,12 +486,201 @@ struct FReader
 
 	FReader(const char *buffer, size_t length)
 	{
-		rapidjson::Document doc;
-		mDoc.Parse(buffer, length);
+		if (length >= 9 && !memcmp(buffer, BINSER_MAGIC, 4))
+		{
+			ParseBinary(buffer, length);
+		}
+		else
+		{
+			mDoc.Parse(buffer, length);
+		}
 		mObjects.Push(FJSONObject(&mDoc));
 		memset(mPlayers, -1, sizeof(mPlayers));
 	}
 
+	//==========================================================================
+	//
+	// Rebuilds the DOM from FBinaryWriter's output so that all the reading
+	// code below can stay backend-agnostic. On malformed input this bails
+	// out and leaves a null document, same as a failed JSON parse.
+	//
+	//==========================================================================
+
+	bool mBinaryFail = false;
+	TArray<FString> mStringList;	// in-order string table for resolving back references
+
+	bool GetBytes(void *dest, size_t len, const char *&p, const char *end)
+	{
+		if ((size_t)(end - p) < len)
+		{
+			mBinaryFail = true;
+			return false;
+		}
+		memcpy(dest, p, len);
+		p += len;
+		return true;
+	}
+
+	rapidjson::Value DecodeBinaryValue(const char *&p, const char *end)
+	{
+		auto &alloc = mDoc.GetAllocator();
+		rapidjson::Value v;
+
+		if (p >= end)
+		{
+			mBinaryFail = true;
+			return v;
+		}
+		switch (*p++)
+		{
+		case 'N':
+			break;
+
+		case 'T':
+			v.SetBool(true);
+			break;
+
+		case 'F':
+			v.SetBool(false);
+			break;
+
+		case 'i':
+		{
+			int32_t i;
+			if (GetBytes(&i, 4, p, end)) v.SetInt(i);
+			break;
+		}
+		case 'u':
+		{
+			uint32_t i;
+			if (GetBytes(&i, 4, p, end)) v.SetUint(i);
+			break;
+		}
+		case 'I':
+		{
+			int64_t i;
+			if (GetBytes(&i, 8, p, end)) v.SetInt64(i);
+			break;
+		}
+		case 'U':
+		{
+			uint64_t i;
+			if (GetBytes(&i, 8, p, end)) v.SetUint64(i);
+			break;
+		}
+		case 'd':
+		{
+			double d;
+			if (GetBytes(&d, 8, p, end)) v.SetDouble(d);
+			break;
+		}
+		case 's':
+		{
+			uint32_t len;
+			if (!GetBytes(&len, 4, p, end)) break;
+			if ((size_t)(end - p) < len)
+			{
+				mBinaryFail = true;
+				break;
+			}
+			mStringList.Push(FString(p, (size_t)len));
+			v.SetString(p, len, alloc);
+			p += len;
+			break;
+		}
+		case 'S':
+		{
+			uint32_t index;
+			if (!GetBytes(&index, 4, p, end)) break;
+			if (index >= mStringList.Size())
+			{
+				mBinaryFail = true;
+				break;
+			}
+			v.SetString(mStringList[index].GetChars(), (rapidjson::SizeType)mStringList[index].Len(), alloc);
+			break;
+		}
+		case '[':
+			v.SetArray();
+			while (p < end && *p != ']' && !mBinaryFail)
+			{
+				v.PushBack(DecodeBinaryValue(p, end), alloc);
+			}
+			if (p < end) p++;
+			else mBinaryFail = true;
+			break;
+
+		case '{':
+			v.SetObject();
+			while (p < end && *p != '}' && !mBinaryFail)
+			{
+				const char *keystr;
+				uint32_t len;
+				char tag = *p++;
+				if (tag == 'k')
+				{
+					if (!GetBytes(&len, 4, p, end) || (size_t)(end - p) < len)
+					{
+						mBinaryFail = true;
+						break;
+					}
+					keystr = p;
+					mStringList.Push(FString(p, (size_t)len));
+					p += len;
+				}
+				else if (tag == 'K')
+				{
+					uint32_t index;
+					if (!GetBytes(&index, 4, p, end)) break;
+					if (index >= mStringList.Size())
+					{
+						mBinaryFail = true;
+						break;
+					}
+					keystr = mStringList[index].GetChars();
+					len = (uint32_t)mStringList[index].Len();
+				}
+				else
+				{
+					mBinaryFail = true;
+					break;
+				}
+				rapidjson::Value key(keystr, len, alloc);
+				v.AddMember(key, DecodeBinaryValue(p, end), alloc);
+			}
+			if (p < end && !mBinaryFail) p++;
+			else mBinaryFail = true;
+			break;
+
+		default:
+			mBinaryFail = true;
+			break;
+		}
+		return v;
+	}
+
+	void ParseBinary(const char *buffer, size_t length)
+	{
+		const char *p = buffer + 4;
+		const char *end = buffer + length;
+		uint32_t bom;
+
+		// Version 1 lacks string back references but is otherwise identical,
+		// so the same decoder handles both.
+		if (*p < 1 || *p > BINSER_VERSION) return;
+		p++;
+		memcpy(&bom, p, 4);
+		p += 4;
+		// A save taken on a machine with the opposite byte order cannot be read.
+		if (bom != BINSER_BOM) return;
+
+		rapidjson::Value root = DecodeBinaryValue(p, end);
+		if (!mBinaryFail)
+		{
+			static_cast<rapidjson::Value &>(mDoc) = root;
+		}
+	}
+
 	rapidjson::Value *FindKey(const char *key)
 	{
 		FJSONObject &obj = mObjects.Last();
@@ -430,7 +722,7 @@ bool FSerializer::OpenWriter(bool pretty)
 	if (w != nullptr || r != nullptr) return false;
 
 	mErrors = 0;
-	w = new FWriter(pretty);
+	w = new FWriter(pretty, !pretty && save_binary);
 	BeginObject(nullptr);
 	return true;
 }
@@ -1097,7 +1389,7 @@ const char *FSerializer::GetOutput(unsigned *len)
 //
 //==========================================================================
 
-FCompressedBuffer FSerializer::GetCompressedOutput()
+FCompressedBuffer FSerializer::GetCompressedOutput(int compresslevel)
 {
 	if (isReading()) return{ 0,0,0,0,0,nullptr };
 	FCompressedBuffer buff;
@@ -1121,7 +1413,7 @@ FCompressedBuffer FSerializer::GetCompressedOutput()
 	stream.opaque = (voidpf)0;
 
 	// create output in zip-compatible form as required by FCompressedBuffer
-	err = deflateInit2(&stream, 8, Z_DEFLATED, -15, 9, Z_DEFAULT_STRATEGY);
+	err = deflateInit2(&stream, compresslevel, Z_DEFLATED, -15, 9, Z_DEFAULT_STRATEGY);
 	if (err != Z_OK)
 	{
 		goto error;
@@ -411,23 +411,29 @@ MusInfo *I_RegisterSong (FileReader *reader, MidiDeviceSetting *device)
 	if ((id[0] & MAKE_ID(255, 255, 255, 0)) == GZIP_ID)
 	{
 		int len = reader->GetLength();
-		BYTE *gzipped = new BYTE[len];
-		if (reader->Read(gzipped, len) != len)
+		MemoryArrayReader *memreader = new MemoryArrayReader(NULL, 0);
+		const char *membuf = reader->GetBuffer();
+		bool ok;
+
+		if (membuf != NULL)
+		{
+			// Memory-backed reader: inflate straight out of its buffer
+			// instead of copying the compressed data first.
+			ok = ungzip((BYTE *)membuf, len, memreader->GetArray());
+		}
+		else
 		{
+			BYTE *gzipped = new BYTE[len];
+			ok = reader->Read(gzipped, len) == len &&
+				ungzip(gzipped, len, memreader->GetArray());
 			delete[] gzipped;
-			delete reader;
-			return NULL;
 		}
 		delete reader;
-
-		MemoryArrayReader *memreader = new MemoryArrayReader(NULL, 0);
-		if (!ungzip(gzipped, len, memreader->GetArray()))
+		if (!ok)
 		{
-			delete[] gzipped;
 			delete memreader;
 			return 0;
 		}
-		delete[] gzipped;
 		memreader->UpdateLength();
 
 		if (memreader->Read(id, 32) != 32 || memreader->Seek(-32, SEEK_CUR) != 0)
@@ -26,6 +26,10 @@
 #include "files.h"
 #include "wildmidi/wildmidi_lib.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 void I_InitMusicWin32 ();
 void I_ShutdownMusicWin32 ();
 
@@ -220,9 +224,54 @@ protected:
 #endif
 };
 
+// Render-ahead layer for synth-backed streams ------------------------------
+
+// Moves a stream's rendering off the latency-critical callback. A source
+// derives from this, implements ServiceStream as its synchronous renderer
+// and passes ReadCallback to CreateStream; while the producer thread runs,
+// the callback only copies samples out of a ring buffer and pads with
+// silence if the producer has fallen behind, instead of overrunning the
+// audio deadline. Without a thread ReadCallback renders directly, so a
+// source behaves exactly as before when snd_renderahead is 0.
+
+class FRenderAheadStream
+{
+public:
+	FRenderAheadStream();
+	virtual ~FRenderAheadStream();
+
+	// The synchronous renderer. Same contract as a SoundStream callback:
+	// fill the buffer completely, return false once the song has ended.
+	virtual bool ServiceStream(void *buff, int numbytes) = 0;
+
+	// Pass this to CreateStream, with the FRenderAheadStream as userdata.
+	static bool ReadCallback(SoundStream *stream, void *buff, int len, void *userdata);
+
+protected:
+	// Both of these may only be called while the stream is not playing.
+	// A derived class must stop the thread before tearing down whatever
+	// state its ServiceStream uses.
+	void StartRenderThread(int samplerate, int bytesperframe);
+	void StopRenderThread();
+
+	// Discards buffered output, e.g. after changing the subsong.
+	void FlushRenderAhead();
+
+private:
+	void RenderThread();
+
+	TArray<BYTE> raBuffer;
+	size_t raReadPos, raWritePos, raFilled;
+	bool raEof;
+	bool raExit;
+	std::thread raThread;
+	std::mutex raMutex;
+	std::condition_variable raWake;
+};
+
 // Base class for software synthesizer MIDI output devices ------------------
 
-class SoftSynthMIDIDevice : public MIDIDevice
+class SoftSynthMIDIDevice : public MIDIDevice, public FRenderAheadStream
 {
 public:
 	SoftSynthMIDIDevice();
@@ -248,6 +297,7 @@ protected:
 	double NextTickIn;
 	MIDIHDR *Events;
 	bool Started;
+	bool StereoStream;
 	DWORD Position;
 	int SampleRate;
 
@@ -257,7 +307,6 @@ protected:
 	virtual void CalcTickRate();
 	int PlayTick();
 	int OpenStream(int chunks, int flags, void (*callback)(unsigned int, void *, DWORD, DWORD), void *userdata);
-	static bool FillStream(SoundStream *stream, void *buff, int len, void *userdata);
 	virtual bool ServiceStream (void *buff, int numbytes);
 
 	virtual void HandleEvent(int status, int parm1, int parm2) = 0;
@@ -709,7 +758,7 @@ protected:
 
 // MUS file played by a software OPL2 synth and streamed through the sound system
 
-class OPLMUSSong : public StreamSong
+class OPLMUSSong : public StreamSong, public FRenderAheadStream
 {
 public:
 	OPLMUSSong (FileReader &reader, const char *args);
@@ -723,7 +772,7 @@ public:
 protected:
 	OPLMUSSong(const OPLMUSSong *original, const char *filename);	// OPL dump constructor
 
-	static bool FillStream (SoundStream *stream, void *buff, int len, void *userdata);
+	bool ServiceStream (void *buff, int numbytes);
 
 	OPLmusicFile *Music;
 };
@@ -27,11 +27,18 @@
 #include "doomdef.h"
 #include "m_swap.h"
 #include "m_fixed.h"
+#include "templates.h"
 #include "c_cvars.h"
 #include "i_sound.h"
 #include "i_system.h"
 #include "files.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__i386__) || defined(__amd64__)
+#define DUMB_CONVERT_SSE2
+#include <emmintrin.h>
+#include "x86.h"
+#endif
+
 #undef CDECL	// w32api's windef.h defines this
 #include "../dumb/include/dumb.h"
 #include "../dumb/include/internal/it.h"
@@ -40,7 +47,7 @@
 
 // TYPES -------------------------------------------------------------------
 
-class input_mod : public StreamSong
+class input_mod : public StreamSong, public FRenderAheadStream
 {
 public:
 	input_mod(DUH *myduh);
@@ -71,7 +78,7 @@ protected:
 	bool open2(long pos);
 	long render(double volume, double delta, long samples, sample_t **buffer);
 	int decode_run(void *buffer, unsigned int size);
-	static bool read(SoundStream *stream, void *buff, int len, void *userdata);
+	bool ServiceStream(void *buff, int numbytes);
 };
 
 #pragma pack(1)
@@ -466,6 +473,7 @@ typedef struct tdumbfile_mem_status
 {
 	const BYTE *ptr;
 	unsigned int offset, size;
+	bool borrowed;		// ptr belongs to the FileReader; do not delete it
 } dumbfile_mem_status;
 
 static int DUMBCALLBACK dumbfile_mem_skip(void *f, long n)
@@ -545,14 +553,25 @@ DUMBFILE *dumb_read_allfile(dumbfile_mem_status *filestate, BYTE *start, FileRea
 		filestate->ptr = (BYTE *)start;
     else
     {
-        BYTE *mem = new BYTE[lenfull];
-        memcpy(mem, start, lenhave);
-        if (reader.Read(mem + lenhave, lenfull - lenhave) != (lenfull - lenhave))
+        const char *membuf = reader.GetBuffer();
+        if (membuf != NULL)
         {
-            delete[] mem;
-            return NULL;
+            // Memory-backed reader: point DUMB straight at the file data
+            // instead of copying it into a temporary buffer.
+            filestate->ptr = (const BYTE *)membuf + reader.Tell() - lenhave;
+            filestate->borrowed = true;
+        }
+        else
+        {
+            BYTE *mem = new BYTE[lenfull];
+            memcpy(mem, start, lenhave);
+            if (reader.Read(mem + lenhave, lenfull - lenhave) != (lenfull - lenhave))
+            {
+                delete[] mem;
+                return NULL;
+            }
+            filestate->ptr = mem;
         }
-        filestate->ptr = mem;
     }
     return dumbfile_open_ex(filestate, &mem_dfs);
 }
@@ -781,6 +800,7 @@ MusInfo *MOD_OpenSong(FileReader &reader)
 
 	filestate.ptr = start;
 	filestate.offset = 0;
+	filestate.borrowed = false;
 	headsize = MIN((int)sizeof(start), size);
 
     if (headsize != reader.Read(start, headsize))
@@ -938,7 +958,7 @@ MusInfo *MOD_OpenSong(FileReader &reader)
 		// Reposition file pointer for other codecs to do their checks.
         reader.Seek(fpos, SEEK_SET);
 	}
-	if (filestate.ptr != (BYTE *)start)
+	if (!filestate.borrowed && filestate.ptr != (BYTE *)start)
 	{
 		delete[] const_cast<BYTE *>(filestate.ptr);
 	}
@@ -947,37 +967,52 @@ MusInfo *MOD_OpenSong(FileReader &reader)
 
 //==========================================================================
 //
-// input_mod :: read												static
+// input_mod :: ServiceStream
+//
+// Renders a buffer of float stereo pairs. This is the old body of the
+// stream callback; with render-ahead active it runs on the producer
+// thread instead.
 //
 //==========================================================================
 
-bool input_mod::read(SoundStream *stream, void *buffer, int sizebytes, void *userdata)
+bool input_mod::ServiceStream(void *buffer, int sizebytes)
 {
-	input_mod *state = (input_mod *)userdata;
-	if (state->eof)
+	if (eof)
 	{
 		memset(buffer, 0, sizebytes);
 		return false;
 	}
-	state->crit_sec.Enter();
+	crit_sec.Enter();
 	while (sizebytes > 0)
 	{
-		int written = state->decode_run(buffer, sizebytes / 8);
+		int written = decode_run(buffer, sizebytes / 8);
 		if (written < 0)
 		{
-			state->crit_sec.Leave();
+			crit_sec.Leave();
 			return false;
 		}
 		if (written == 0)
 		{
-			state->crit_sec.Leave();
+			crit_sec.Leave();
 			memset(buffer, 0, sizebytes);
 			return true;
 		}
 		else
 		{
 			// Convert to float
-			for (int i = 0; i < written * 2; ++i)
+			int i = 0;
+#ifdef DUMB_CONVERT_SSE2
+			if (CPU.bSSE2)
+			{
+				__m128 factor = _mm_set1_ps(mod_dumb_mastervolume / (float)(1 << 24));
+				for (; i <= written * 2 - 4; i += 4)
+				{
+					__m128i s = _mm_loadu_si128((const __m128i *)&((int *)buffer)[i]);
+					_mm_storeu_ps(&((float *)buffer)[i], _mm_mul_ps(_mm_cvtepi32_ps(s), factor));
+				}
+			}
+#endif
+			for (; i < written * 2; ++i)
 			{
 				((float *)buffer)[i] = (((int *)buffer)[i] / (float)(1 << 24)) * mod_dumb_mastervolume;
 			}
@@ -985,7 +1020,7 @@ bool input_mod::read(SoundStream *stream, void *buffer, int sizebytes, void *use
 		buffer = (BYTE *)buffer + written * 8;
 		sizebytes -= written * 8;
 	}
-	state->crit_sec.Leave();
+	crit_sec.Leave();
 	return true;
 }
 
@@ -1013,7 +1048,8 @@ input_mod::input_mod(DUH *myduh)
 	{
 		srate = (int)GSnd->GetOutputRate();
 	}
-	m_Stream = GSnd->CreateStream(read, 32*1024, SoundStream::Float, srate, this);
+	m_Stream = GSnd->CreateStream(FRenderAheadStream::ReadCallback, 32*1024,
+		SoundStream::Float, srate, static_cast<FRenderAheadStream *>(this));
 	delta = 65536.0 / srate;
 }
 
@@ -1026,6 +1062,7 @@ input_mod::input_mod(DUH *myduh)
 input_mod::~input_mod()
 {
 	Stop();
+	StopRenderThread();
 	if (m_Stream != NULL)
 	{
 		delete m_Stream;
@@ -1047,9 +1084,17 @@ void input_mod::Play(bool looping, int order)
 	m_Looping = looping;
 
 	start_order = order;
-	if (open2(0) && m_Stream->Play(m_Looping, 1))
+	if (open2(0))
 	{
-		m_Status = STATE_Playing;
+		StartRenderThread(srate, 8);
+		if (m_Stream->Play(m_Looping, 1))
+		{
+			m_Status = STATE_Playing;
+		}
+		else
+		{
+			StopRenderThread();
+		}
 	}
 }
 
@@ -1077,6 +1122,8 @@ bool input_mod::SetSubsong(int order)
 	}
 	duh_end_sigrenderer(oldsr);
 	crit_sec.Leave();
+	// Throw away whatever was rendered ahead of the old order.
+	FlushRenderAhead();
 	return true;
 }
 
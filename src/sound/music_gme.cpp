@@ -48,7 +48,7 @@
 
 // TYPES -------------------------------------------------------------------
 
-class GMESong : public StreamSong
+class GMESong : public StreamSong, public FRenderAheadStream
 {
 public:
 	GMESong(Music_Emu *emu, int sample_rate);
@@ -67,8 +67,7 @@ protected:
 	bool StartTrack(int track, bool getcritsec=true);
 	bool GetTrackInfo();
 	int CalcSongLength();
-
-	static bool Read(SoundStream *stream, void *buff, int len, void *userdata);
+	bool ServiceStream(void *buff, int numbytes);
 };
 
 // EXTERNAL FUNCTION PROTOTYPES --------------------------------------------
@@ -127,18 +126,28 @@ MusInfo *GME_OpenSong(FileReader &reader, const char *fmt)
 
     int fpos = reader.Tell();
     int len = reader.GetLength();
-    song = new BYTE[len];
-    if (reader.Read(song, len) != len)
+    const char *membuf = reader.GetBuffer();
+    if (membuf != NULL)
+    {
+        // Memory-backed reader: gme_load_data copies what it needs, so the
+        // file data can be handed over without duplicating it first.
+        err = gme_load_data(emu, membuf + fpos, len);
+    }
+    else
     {
+        song = new BYTE[len];
+        if (reader.Read(song, len) != len)
+        {
+            delete[] song;
+            gme_delete(emu);
+            reader.Seek(fpos, SEEK_SET);
+            return NULL;
+        }
+
+        err = gme_load_data(emu, song, len);
         delete[] song;
-        gme_delete(emu);
-        reader.Seek(fpos, SEEK_SET);
-        return NULL;
     }
 
-	err = gme_load_data(emu, song, len);
-    delete[] song;
-
 	if (err != NULL)
 	{
 		Printf("Failed loading song: %s\n", err);
@@ -161,7 +170,8 @@ GMESong::GMESong(Music_Emu *emu, int sample_rate)
 	SampleRate = sample_rate;
 	CurrTrack = 0;
 	TrackInfo = NULL;
-	m_Stream = GSnd->CreateStream(Read, 32*1024, 0, sample_rate, this);
+	m_Stream = GSnd->CreateStream(FRenderAheadStream::ReadCallback, 32*1024,
+		0, sample_rate, static_cast<FRenderAheadStream *>(this));
 }
 
 //==========================================================================
@@ -173,6 +183,7 @@ GMESong::GMESong(Music_Emu *emu, int sample_rate)
 GMESong::~GMESong()
 {
 	Stop();
+	StopRenderThread();
 	if (m_Stream != NULL)
 	{
 		delete m_Stream;
@@ -199,9 +210,17 @@ void GMESong::Play(bool looping, int track)
 {
 	m_Status = STATE_Stopped;
 	m_Looping = looping;
-	if (StartTrack(track) && m_Stream->Play(looping, 1))
+	if (StartTrack(track))
 	{
-		m_Status = STATE_Playing;
+		StartRenderThread(SampleRate, 4);
+		if (m_Stream->Play(looping, 1))
+		{
+			m_Status = STATE_Playing;
+		}
+		else
+		{
+			StopRenderThread();
+		}
 	}
 }
 
@@ -217,7 +236,13 @@ bool GMESong::SetSubsong(int track)
 	{
 		return false;
 	}
-	return StartTrack(track);
+	if (!StartTrack(track))
+	{
+		return false;
+	}
+	// Throw away whatever was rendered ahead of the old track.
+	FlushRenderAhead();
+	return true;
 }
 
 //==========================================================================
@@ -328,30 +353,29 @@ int GMESong::CalcSongLength()
 
 //==========================================================================
 //
-// GMESong :: Read													STATIC
+// GMESong :: ServiceStream
 //
 //==========================================================================
 
-bool GMESong::Read(SoundStream *stream, void *buff, int len, void *userdata)
+bool GMESong::ServiceStream(void *buff, int len)
 {
 	gme_err_t err;
-	GMESong *song = (GMESong *)userdata;
 
-	song->CritSec.Enter();
-	if (gme_track_ended(song->Emu))
+	CritSec.Enter();
+	if (gme_track_ended(Emu))
 	{
-		if (song->m_Looping)
+		if (m_Looping)
 		{
-			song->StartTrack(song->CurrTrack, false);
+			StartTrack(CurrTrack, false);
 		}
 		else
 		{
 			memset(buff, 0, len);
-			song->CritSec.Leave();
+			CritSec.Leave();
 			return false;
 		}
 	}
-	err = gme_play(song->Emu, len >> 1, (short *)buff);
-	song->CritSec.Leave();
+	err = gme_play(Emu, len >> 1, (short *)buff);
+	CritSec.Leave();
 	return (err == NULL);
 }
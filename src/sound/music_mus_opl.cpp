@@ -37,8 +37,9 @@ OPLMUSSong::OPLMUSSong (FileReader &reader, const char *args)
 	OPL_SetCore(args);
 	Music = new OPLmusicFile (&reader);
 
-	m_Stream = GSnd->CreateStream (FillStream, samples*4,
-		(current_opl_core == 0 ? SoundStream::Mono : 0) | SoundStream::Float, int(OPL_SAMPLE_RATE), this);
+	m_Stream = GSnd->CreateStream (FRenderAheadStream::ReadCallback, samples*4,
+		(current_opl_core == 0 ? SoundStream::Mono : 0) | SoundStream::Float, int(OPL_SAMPLE_RATE),
+		static_cast<FRenderAheadStream *>(this));
 	if (m_Stream == NULL)
 	{
 		Printf (PRINT_BOLD, "Could not create music stream.\n");
@@ -52,6 +53,7 @@ OPLMUSSong::~OPLMUSSong ()
 {
 	OPL_Active = false;
 	Stop ();
+	StopRenderThread ();
 	if (Music != NULL)
 	{
 		delete Music;
@@ -81,16 +83,23 @@ void OPLMUSSong::Play (bool looping, int subsong)
 	Music->SetLooping (looping);
 	Music->Restart ();
 
+	if (m_Stream != NULL)
+	{
+		StartRenderThread (int(OPL_SAMPLE_RATE), current_opl_core == 0 ? 4 : 8);
+	}
 	if (m_Stream == NULL || m_Stream->Play (true, snd_musicvolume))
 	{
 		m_Status = STATE_Playing;
 	}
+	else
+	{
+		StopRenderThread ();
+	}
 }
 
-bool OPLMUSSong::FillStream (SoundStream *stream, void *buff, int len, void *userdata)
+bool OPLMUSSong::ServiceStream (void *buff, int len)
 {
-	OPLMUSSong *song = (OPLMUSSong *)userdata;
-	return song->Music->ServiceStream (buff, len);
+	return Music->ServiceStream (buff, len);
 }
 
 MusInfo *OPLMUSSong::GetOPLDumper(const char *filename)
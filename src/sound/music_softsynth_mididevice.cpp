@@ -75,6 +75,7 @@ SoftSynthMIDIDevice::SoftSynthMIDIDevice()
 	Division = 0;
 	Events = NULL;
 	Started = false;
+	StereoStream = true;
 	SampleRate = GSnd != NULL ? (int)GSnd->GetOutputRate() : 44100;
 }
 
@@ -102,7 +103,9 @@ int SoftSynthMIDIDevice::OpenStream(int chunks, int flags, void (*callback)(unsi
 	{
 		chunksize *= 2;
 	}
-	Stream = GSnd->CreateStream(FillStream, chunksize, SoundStream::Float | flags, SampleRate, this);
+	StereoStream = !(flags & SoundStream::Mono);
+	Stream = GSnd->CreateStream(FRenderAheadStream::ReadCallback, chunksize,
+		SoundStream::Float | flags, SampleRate, static_cast<FRenderAheadStream *>(this));
 	if (Stream == NULL)
 	{
 		return 2;
@@ -124,6 +127,7 @@ int SoftSynthMIDIDevice::OpenStream(int chunks, int flags, void (*callback)(unsi
 
 void SoftSynthMIDIDevice::Close()
 {
+	StopRenderThread();
 	if (Stream != NULL)
 	{
 		delete Stream;
@@ -204,11 +208,15 @@ int SoftSynthMIDIDevice::Resume()
 {
 	if (!Started)
 	{
+		// The first events are already queued up at this point, so the
+		// producer thread has something to render right away.
+		StartRenderThread(SampleRate, StereoStream ? 8 : 4);
 		if (Stream->Play(true, 1))
 		{
 			Started = true;
 			return 0;
 		}
+		StopRenderThread();
 		return 1;
 	}
 	return 0;
@@ -225,6 +233,7 @@ void SoftSynthMIDIDevice::Stop()
 	if (Started)
 	{
 		Stream->Stop();
+		StopRenderThread();
 		Started = false;
 	}
 }
@@ -440,15 +449,3 @@ bool SoftSynthMIDIDevice::ServiceStream (void *buff, int numbytes)
 	CritSec.Leave();
 	return res;
 }
-
-//==========================================================================
-//
-// SoftSynthMIDIDevice :: FillStream								static
-//
-//==========================================================================
-
-bool SoftSynthMIDIDevice::FillStream(SoundStream *stream, void *buff, int len, void *userdata)
-{
-	SoftSynthMIDIDevice *device = (SoftSynthMIDIDevice *)userdata;
-	return device->ServiceStream(buff, len);
-}
@@ -1,4 +1,157 @@
 #include "i_musicinterns.h"
+#include "templates.h"
+
+CVAR(Int, snd_renderahead, 250, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)	// ms of synth output rendered ahead on a worker thread, 0 renders in the callback
+
+//==========================================================================
+//
+// FRenderAheadStream
+//
+// The producer thread renders fixed size chunks through ServiceStream
+// into the ring buffer whenever enough space is free, and sleeps
+// otherwise; the stream callback wakes it after consuming something.
+//
+//==========================================================================
+
+static const size_t RA_CHUNK = 8192;	// bytes rendered per ServiceStream call
+
+FRenderAheadStream::FRenderAheadStream()
+{
+	raReadPos = raWritePos = raFilled = 0;
+	raEof = raExit = false;
+}
+
+FRenderAheadStream::~FRenderAheadStream()
+{
+	StopRenderThread();
+}
+
+//==========================================================================
+//
+// FRenderAheadStream :: ReadCallback							static
+//
+//==========================================================================
+
+bool FRenderAheadStream::ReadCallback(SoundStream *stream, void *buff, int len, void *userdata)
+{
+	FRenderAheadStream *source = (FRenderAheadStream *)userdata;
+
+	if (source->raBuffer.Size() == 0)
+	{
+		// No producer thread, so render right here.
+		return source->ServiceStream(buff, len);
+	}
+
+	// Only drain the ring buffer here; if the producer has fallen behind
+	// pad with silence instead of stalling the audio thread.
+	BYTE *out = (BYTE *)buff;
+	size_t want = len;
+
+	std::unique_lock<std::mutex> lock(source->raMutex);
+	size_t have = MIN(want, source->raFilled);
+	size_t tail = MIN(have, source->raBuffer.Size() - source->raReadPos);
+	memcpy(out, &source->raBuffer[source->raReadPos], tail);
+	memcpy(out + tail, &source->raBuffer[0], have - tail);
+	source->raReadPos = (source->raReadPos + have) % source->raBuffer.Size();
+	source->raFilled -= have;
+	bool ended = source->raEof && source->raFilled == 0;
+	lock.unlock();
+	source->raWake.notify_one();
+
+	if (have < want)
+	{
+		memset(out + have, 0, want - have);
+	}
+	return !ended;
+}
+
+//==========================================================================
+//
+// FRenderAheadStream :: RenderThread
+//
+//==========================================================================
+
+void FRenderAheadStream::RenderThread()
+{
+	TArray<BYTE> temp;
+	temp.Resize(RA_CHUNK);
+
+	std::unique_lock<std::mutex> lock(raMutex);
+	while (!raExit)
+	{
+		if (raEof || raBuffer.Size() - raFilled < RA_CHUNK)
+		{
+			raWake.wait(lock);
+			continue;
+		}
+		lock.unlock();
+		bool res = ServiceStream(&temp[0], (int)RA_CHUNK);
+		lock.lock();
+		size_t tail = MIN(RA_CHUNK, raBuffer.Size() - raWritePos);
+		memcpy(&raBuffer[raWritePos], &temp[0], tail);
+		memcpy(&raBuffer[0], &temp[tail], RA_CHUNK - tail);
+		raWritePos = (raWritePos + RA_CHUNK) % raBuffer.Size();
+		raFilled += RA_CHUNK;
+		if (!res)
+		{
+			raEof = true;
+		}
+	}
+}
+
+//==========================================================================
+//
+// FRenderAheadStream :: StartRenderThread
+//
+//==========================================================================
+
+void FRenderAheadStream::StartRenderThread(int samplerate, int bytesperframe)
+{
+	StopRenderThread();
+	if (snd_renderahead <= 0) return;
+
+	size_t bytes = (size_t)samplerate * bytesperframe * clamp<int>(snd_renderahead, 0, 2000) / 1000;
+	raBuffer.Resize((unsigned)MAX<size_t>(bytes, 2 * RA_CHUNK));
+	raReadPos = raWritePos = raFilled = 0;
+	raEof = raExit = false;
+	raThread = std::thread([this]() { RenderThread(); });
+}
+
+//==========================================================================
+//
+// FRenderAheadStream :: StopRenderThread
+//
+//==========================================================================
+
+void FRenderAheadStream::StopRenderThread()
+{
+	if (raThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(raMutex);
+			raExit = true;
+		}
+		raWake.notify_one();
+		raThread.join();
+	}
+	raBuffer.Clear();
+}
+
+//==========================================================================
+//
+// FRenderAheadStream :: FlushRenderAhead
+//
+//==========================================================================
+
+void FRenderAheadStream::FlushRenderAhead()
+{
+	{
+		std::lock_guard<std::mutex> lock(raMutex);
+		raReadPos = raWritePos = raFilled = 0;
+		raEof = false;
+	}
+	raWake.notify_one();
+}
 
 void StreamSong::Play (bool looping, int subsong)
 {
@@ -841,6 +841,8 @@ OpenALSoundRenderer::OpenALSoundRenderer()
     DPrintf(DMSG_NOTIFY, "  Allocated " TEXTCOLOR_BLUE"%u" TEXTCOLOR_NORMAL" sources\n", Sources.Size());
 
     WasInWater = false;
+    ListenerValid = false;
+    LastListenerAngle = 0.f;
     if(*snd_efx && ALC.EXT_EFX)
     {
         // EFX function pointers
@@ -1418,6 +1420,19 @@ FISoundChannel *OpenALSoundRenderer::StartSound3D(SoundHandle sfx, SoundListener
 {
     float dist_sqr = (float)(pos - listener->position).LengthSquared();
 
+    if((chanflags&SNDF_LOOP))
+    {
+        // Distance-based virtualization: a looping sound that starts out of
+        // hearing range should not occupy a real source. Returning null turns
+        // it into an evicted channel, which UpdateSounds promotes back once
+        // the listener gets close enough to hear it.
+        float maxdist = (rolloff->RolloffType == ROLLOFF_Log) ?
+                        1000.f + rolloff->MinDistance : rolloff->MaxDistance;
+        maxdist /= distscale;
+        if(dist_sqr > maxdist*maxdist)
+            return NULL;
+    }
+
     if(FreeSfx.Size() == 0)
     {
         FSoundChan *lowest = FindLowestChannel();
@@ -1812,24 +1827,34 @@ void OpenALSoundRenderer::UpdateListener(SoundListener *listener)
     alDeferUpdatesSOFT();
 
     float angle = listener->angle;
-    ALfloat orient[6];
-    // forward
-    orient[0] = cosf(angle);
-    orient[1] = 0.f;
-    orient[2] = -sinf(angle);
-    // up
-    orient[3] = 0.f;
-    orient[4] = 1.f;
-    orient[5] = 0.f;
-
-    alListenerfv(AL_ORIENTATION, orient);
-    alListener3f(AL_POSITION, listener->position.X,
-                              listener->position.Y,
-                             -listener->position.Z);
-    alListener3f(AL_VELOCITY, listener->velocity.X,
-                              listener->velocity.Y,
-                             -listener->velocity.Z);
-    getALError();
+    if(!ListenerValid || angle != LastListenerAngle ||
+       listener->position != LastListenerPos ||
+       listener->velocity != LastListenerVel)
+    {
+        ListenerValid = true;
+        LastListenerAngle = angle;
+        LastListenerPos = listener->position;
+        LastListenerVel = listener->velocity;
+
+        ALfloat orient[6];
+        // forward
+        orient[0] = cosf(angle);
+        orient[1] = 0.f;
+        orient[2] = -sinf(angle);
+        // up
+        orient[3] = 0.f;
+        orient[4] = 1.f;
+        orient[5] = 0.f;
+
+        alListenerfv(AL_ORIENTATION, orient);
+        alListener3f(AL_POSITION, listener->position.X,
+                                  listener->position.Y,
+                                 -listener->position.Z);
+        alListener3f(AL_VELOCITY, listener->velocity.X,
+                                  listener->velocity.Y,
+                                 -listener->velocity.Z);
+        getALError();
+    }
 
     const ReverbContainer *env = ForcedEnvironment;
     if(!env)
@@ -1883,6 +1908,8 @@ void OpenALSoundRenderer::UpdateListener(SoundListener *listener)
     else if(WasInWater)
     {
         WasInWater = false;
+    ListenerValid = false;
+    LastListenerAngle = 0.f;
 
         if(EnvSlot != 0)
         {
@@ -1923,6 +1950,14 @@ void OpenALSoundRenderer::UpdateSounds()
     }
 
     PurgeStoppedSources();
+
+    // Source virtualization: channels that lost the priority/distance
+    // contest in StartSound3D keep ticking as evicted (virtual) channels
+    // in the sound engine. Once sources free up again, promote them back;
+    // the loudest sounds win the real sources through the same priority
+    // checks that evicted them.
+    if(FreeSfx.Size() > 0)
+        S_RestoreEvictedChannels();
 }
 
 bool OpenALSoundRenderer::IsValid()
@@ -2001,10 +2036,16 @@ FString OpenALSoundRenderer::GatherStats()
     uint32 total = Sources.Size();
     uint32 used = SfxGroup.Size()+Streams.Size();
     uint32 unused = FreeSfx.Size();
+    uint32 virt = 0;
+    for(FSoundChan *schan = Channels;schan != NULL;schan = schan->NextChan)
+    {
+        if(schan->ChanFlags & CHAN_EVICTED)
+            ++virt;
+    }
 
     FString out;
-    out.Format("%u sources (" TEXTCOLOR_YELLOW"%u" TEXTCOLOR_NORMAL" active, " TEXTCOLOR_YELLOW"%u" TEXTCOLOR_NORMAL" free), Update interval: " TEXTCOLOR_YELLOW"%d" TEXTCOLOR_NORMAL"ms",
-               total, used, unused, 1000/updates);
+    out.Format("%u sources (" TEXTCOLOR_YELLOW"%u" TEXTCOLOR_NORMAL" active, " TEXTCOLOR_YELLOW"%u" TEXTCOLOR_NORMAL" free, " TEXTCOLOR_YELLOW"%u" TEXTCOLOR_NORMAL" virtual), Update interval: " TEXTCOLOR_YELLOW"%d" TEXTCOLOR_NORMAL"ms",
+               total, used, unused, virt, 1000/updates);
     return out;
 }
 
@@ -227,6 +227,13 @@ private:
 
     bool WasInWater;
 
+    // Listener state as last submitted to OpenAL, so an unmoved listener
+    // isn't resubmitted every frame.
+    bool ListenerValid;
+    FVector3 LastListenerPos;
+    FVector3 LastListenerVel;
+    float LastListenerAngle;
+
     TArray<OpenALSoundStream*> Streams;
     friend class OpenALSoundStream;
 
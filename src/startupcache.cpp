@@ -0,0 +1,267 @@
+/*
+** startupcache.cpp
+**
+** persistent cache for work done while scanning the loaded resources
+**
+**---------------------------------------------------------------------------
+** Copyright 2017 GZDoom contributors
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+*/
+
+#include <sys/stat.h>
+
+#include "startupcache.h"
+#include "c_cvars.h"
+#include "c_dispatch.h"
+#include "cmdlib.h"
+#include "files.h"
+#include "i_system.h"
+#include "m_misc.h"
+#include "md5.h"
+#include "version.h"
+
+FStartupCache StartupCache;
+
+CVAR(Bool, startup_usecache, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG);
+
+static const DWORD STARTUPCACHE_VERSION = 1;
+
+static void SaveStartupCache()
+{
+	StartupCache.Save();
+}
+
+//==========================================================================
+//
+// FStartupCache :: CacheName
+//
+//==========================================================================
+
+FString FStartupCache::CacheName(bool create)
+{
+	FString path = M_GetCachePath(create);
+	if (create) CreatePath(path);
+	path << "/startup.cache";
+	return path;
+}
+
+//==========================================================================
+//
+// FStartupCache :: Init
+//
+// Loads the cache file the first time any block is requested. Anything
+// that doesn't match the expected header (including caches written by a
+// different engine version) is silently discarded.
+//
+//==========================================================================
+
+void FStartupCache::Init()
+{
+	if (Loaded) return;
+	Loaded = true;
+	atterm(SaveStartupCache);
+
+	FString path = CacheName(false);
+	FILE *f = fopen(path, "rb");
+	if (f == NULL) return;
+
+	char magic[4];
+	DWORD version, verlen, count;
+	if (fread(magic, 1, 4, f) != 4 || memcmp(magic, "ZDSC", 4) ||
+		fread(&version, 4, 1, f) != 1 || LittleLong(version) != STARTUPCACHE_VERSION ||
+		fread(&verlen, 4, 1, f) != 1 || LittleLong(verlen) != (DWORD)strlen(VERSIONSTR))
+	{
+		fclose(f);
+		return;
+	}
+	char verstr[64];
+	verlen = LittleLong(verlen);
+	if (verlen >= sizeof(verstr) || fread(verstr, 1, verlen, f) != verlen ||
+		memcmp(verstr, VERSIONSTR, verlen) || fread(&count, 4, 1, f) != 1)
+	{
+		fclose(f);
+		return;
+	}
+
+	count = LittleLong(count);
+	for (DWORD i = 0; i < count; i++)
+	{
+		DWORD keylen, datalen;
+		if (fread(&keylen, 4, 1, f) != 1 || fread(&datalen, 4, 1, f) != 1) break;
+		keylen = LittleLong(keylen);
+		datalen = LittleLong(datalen);
+
+		TArray<char> key(keylen + 1);
+		key.Resize(keylen + 1);
+		if (fread(&key[0], 1, keylen, f) != keylen) break;
+		key[keylen] = 0;
+
+		TArray<BYTE> data(datalen);
+		data.Resize(datalen);
+		if (datalen > 0 && fread(&data[0], 1, datalen, f) != datalen) break;
+
+		Blocks.Insert(&key[0], data);
+	}
+	fclose(f);
+}
+
+//==========================================================================
+//
+// FStartupCache :: Save
+//
+// Registered with atterm so a grown cache gets written back on exit.
+//
+//==========================================================================
+
+void FStartupCache::Save()
+{
+	if (!Dirty) return;
+
+	FString path = CacheName(true);
+	FILE *f = fopen(path, "wb");
+	if (f == NULL)
+	{
+		Printf("Cannot open startup cache %s for writing\n", path.GetChars());
+		return;
+	}
+
+	DWORD version = LittleLong(STARTUPCACHE_VERSION);
+	DWORD verlen = LittleLong((DWORD)strlen(VERSIONSTR));
+	DWORD count = LittleLong((DWORD)Blocks.CountUsed());
+	fwrite("ZDSC", 1, 4, f);
+	fwrite(&version, 4, 1, f);
+	fwrite(&verlen, 4, 1, f);
+	fwrite(VERSIONSTR, 1, strlen(VERSIONSTR), f);
+	fwrite(&count, 4, 1, f);
+
+	TMapIterator<FString, TArray<BYTE> > it(Blocks);
+	TMap<FString, TArray<BYTE> >::Pair *pair;
+	while (it.NextPair(pair))
+	{
+		DWORD keylen = LittleLong((DWORD)pair->Key.Len());
+		DWORD datalen = LittleLong(pair->Value.Size());
+		fwrite(&keylen, 4, 1, f);
+		fwrite(&datalen, 4, 1, f);
+		fwrite(pair->Key.GetChars(), 1, pair->Key.Len(), f);
+		if (pair->Value.Size() > 0) fwrite(&pair->Value[0], 1, pair->Value.Size(), f);
+	}
+	fclose(f);
+	Dirty = false;
+}
+
+//==========================================================================
+//
+// FStartupCache :: GetBlock
+//
+//==========================================================================
+
+bool FStartupCache::GetBlock(const char *key, TArray<BYTE> &data)
+{
+	if (!startup_usecache) return false;
+	Init();
+
+	TArray<BYTE> *block = Blocks.CheckKey(key);
+	if (block == NULL) return false;
+	data = *block;
+	return true;
+}
+
+//==========================================================================
+//
+// FStartupCache :: AddBlock
+//
+//==========================================================================
+
+void FStartupCache::AddBlock(const char *key, const void *data, unsigned size)
+{
+	if (!startup_usecache) return;
+	Init();
+
+	TArray<BYTE> block(size);
+	block.Resize(size);
+	if (size > 0) memcpy(&block[0], data, size);
+	Blocks.Insert(key, block);
+	Dirty = true;
+}
+
+//==========================================================================
+//
+// FStartupCache :: GetFileMD5
+//
+// Whole-file digests are needed to identify a few special WADs at every
+// startup; for large files this used to be a full read of the file.
+//
+//==========================================================================
+
+void FStartupCache::GetFileMD5(const char *filename, FileReader *reader, BYTE *md5out)
+{
+	FString key;
+	struct stat info;
+	if (startup_usecache && stat(filename, &info) == 0)
+	{
+		key.Format("md5:%s:%llu:%llu", filename,
+			(unsigned long long)info.st_size, (unsigned long long)info.st_mtime);
+		TArray<BYTE> data;
+		if (GetBlock(key, data) && data.Size() == 16)
+		{
+			memcpy(md5out, &data[0], 16);
+			return;
+		}
+	}
+
+	reader->Seek(0, SEEK_SET);
+	MD5Context md5;
+	md5.Update(reader, reader->GetLength());
+	md5.Final(md5out);
+
+	if (key.IsNotEmpty())
+	{
+		AddBlock(key, md5out, 16);
+	}
+}
+
+//==========================================================================
+//
+// FStartupCache :: Clear
+//
+//==========================================================================
+
+void FStartupCache::Clear()
+{
+	Blocks.Clear();
+	Loaded = false;
+	Dirty = false;
+
+	FString path = CacheName(false);
+	remove(path);
+}
+
+CCMD(clearstartupcache)
+{
+	StartupCache.Clear();
+}
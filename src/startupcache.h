@@ -0,0 +1,90 @@
+/*
+** startupcache.h
+**
+** persistent cache for work done while scanning the loaded resources
+**
+**---------------------------------------------------------------------------
+** Copyright 2017 GZDoom contributors
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+*/
+
+#ifndef __STARTUPCACHE_H
+#define __STARTUPCACHE_H
+
+#include "doomtype.h"
+#include "tarray.h"
+#include "zstring.h"
+
+class FileReader;
+
+//==========================================================================
+//
+// FStartupCache
+//
+// A small key/value store that survives between runs, kept next to the
+// node cache. Startup code can use it to skip work whose result only
+// depends on the loaded files; every key must therefore include whatever
+// identifies its inputs (file size and timestamp, lump checksum, ...).
+// Entries made by older engine versions are thrown away wholesale.
+//
+//==========================================================================
+
+class FStartupCache
+{
+public:
+	// Looks up a block. Returns false if the cache holds nothing for key.
+	bool GetBlock(const char *key, TArray<BYTE> &data);
+
+	// Stores (or replaces) a block. The data is copied.
+	void AddBlock(const char *key, const void *data, unsigned size);
+
+	// Returns the MD5 digest of the given open file, computing and caching
+	// it when no current entry exists. The key includes the file's size and
+	// modification time, so an updated file is hashed again.
+	//
+	// MD5 cannot be swapped for a faster hash: every remaining use compares
+	// against externally published digests (known IWAD versions, the map
+	// fingerprints in compatibility.txt). Caching the result here is how
+	// repeat hashing cost is avoided instead.
+	void GetFileMD5(const char *filename, FileReader *reader, BYTE *md5out);
+
+	void Save();
+	void Clear();
+
+private:
+	void Init();
+	FString CacheName(bool create);
+
+	TMap<FString, TArray<BYTE> > Blocks;
+	bool Loaded = false;
+	bool Dirty = false;
+};
+
+extern FStartupCache StartupCache;
+
+#endif
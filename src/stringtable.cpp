@@ -54,6 +54,7 @@ struct FStringTable::StringEntry
 {
 	StringEntry *Next;
 	char *Name;
+	DWORD Key;		// case-folded hash of Name, so lookups can skip most stricmps
 	BYTE PassNum;
 	char String[];
 };
@@ -263,7 +264,8 @@ void FStringTable::LoadLanguage (int lumpnum, DWORD code, bool exactMatch, int p
 			}
 
 			// Does this string exist? If so, should we overwrite it?
-			bucket = MakeKey (strName.GetChars()) & (HASH_SIZE-1);
+			DWORD key = MakeKey (strName.GetChars());
+			bucket = key & (HASH_SIZE-1);
 			pentry = &Buckets[bucket];
 			entry = *pentry;
 			cmpval = 1;
@@ -288,6 +290,7 @@ void FStringTable::LoadLanguage (int lumpnum, DWORD code, bool exactMatch, int p
 				*pentry = entry;
 				strcpy (entry->String, strText.GetChars());
 				strcpy (entry->Name = entry->String + strText.Len() + 1, strName.GetChars());
+				entry->Key = key;
 				entry->PassNum = passnum;
 			}
 		}
@@ -328,20 +331,15 @@ const char *FStringTable::operator[] (const char *name) const
 	{
 		return NULL;
 	}
-	DWORD bucket = MakeKey (name) & (HASH_SIZE - 1);
-	StringEntry *entry = Buckets[bucket];
+	DWORD key = MakeKey (name);
+	StringEntry *entry = Buckets[key & (HASH_SIZE - 1)];
 
 	while (entry != NULL)
 	{
-		int cmpval = stricmp (entry->Name, name);
-		if (cmpval == 0)
+		if (entry->Key == key && stricmp (entry->Name, name) == 0)
 		{
 			return entry->String;
 		}
-		if (cmpval == 1)
-		{
-			return NULL;
-		}
 		entry = entry->Next;
 	}
 	return NULL;
@@ -412,6 +410,7 @@ void FStringTable::SetString (const char *name, const char *newString)
 	StringEntry *entry = (StringEntry *)M_Malloc (sizeof(*entry) + newlen + namelen + 2);
 	strcpy (entry->String, newString);
 	strcpy (entry->Name = entry->String + newlen + 1, name);
+	entry->Key = MakeKey (name);
 	entry->PassNum = 0;
 
 	// If this is a new string, insert it. Otherwise, replace the old one.
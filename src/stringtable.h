@@ -63,7 +63,7 @@ public:
 	void SetString (const char *name, const char *newString);
 
 private:
-	enum { HASH_SIZE = 128 };
+	enum { HASH_SIZE = 1024 };
 
 	StringEntry *Buckets[HASH_SIZE];
 
@@ -243,6 +243,20 @@ public:
 		::new((void*)&Array[Count]) T(item);
 		return Count++;
 	}
+	unsigned int Push (T &&item)
+	{
+		Grow (1);
+		::new((void*)&Array[Count]) T(std::move(item));
+		return Count++;
+	}
+	// Constructs a new element in place at the end of the array.
+	template<typename... Args>
+	unsigned int Emplace (Args&&... args)
+	{
+		Grow (1);
+		::new((void*)&Array[Count]) T(std::forward<Args>(args)...);
+		return Count++;
+	}
 	bool Pop ()
 	{
 		if (Count > 0)
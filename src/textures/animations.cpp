@@ -922,16 +922,19 @@ void FTextureManager::UpdateAnimations (DWORD mstime)
 	for (unsigned int j = 0; j < mAnimations.Size(); ++j)
 	{
 		FAnimDef *anim = mAnimations[j];
+		bool advanced = false;
 
 		// If this is the first time through R_UpdateAnimations, just
 		// initialize the anim's switch time without actually animating.
 		if (anim->SwitchTime == 0)
 		{
 			anim->SetSwitchTime (mstime);
+			advanced = true;	// write the initial translations below
 		}
 		else while (anim->SwitchTime <= mstime)
 		{ // Multiple frames may have passed since the last time calling
 		  // R_UpdateAnimations, so be sure to loop through them all.
+			advanced = true;
 
 			switch (anim->AnimType)
 			{
@@ -980,6 +983,14 @@ void FTextureManager::UpdateAnimations (DWORD mstime)
 			anim->SetSwitchTime (mstime);
 		}
 
+		// The translation table keeps its contents between frames, so it
+		// only needs rewriting when the animation actually advanced. Most
+		// animations are between frames on any given render frame.
+		if (!advanced)
+		{
+			continue;
+		}
+
 		if (anim->bDiscrete)
 		{
 			SetTranslation (anim->BasePic, anim->Frames[anim->CurFrame].FramePic);
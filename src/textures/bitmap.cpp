@@ -412,6 +412,56 @@ void iCopyPaletted(BYTE *buffer, const BYTE * patch, int srcwidth, int srcheight
 	}
 }
 
+#ifndef __BIG_ENDIAN__
+//===========================================================================
+//
+// On little endian machines cBGRA's channel offsets match PalEntry's
+// in-memory layout, so the plain copy modes can store whole pixels at
+// once instead of assembling them channel by channel. These are by far
+// the most common modes, since every ordinary multipatch composition
+// goes through them.
+//
+//===========================================================================
+template<>
+void iCopyPaletted<cBGRA, bCopy>(BYTE *buffer, const BYTE * patch, int srcwidth, int srcheight, int Pitch,
+					int step_x, int step_y, int rotate, PalEntry * palette, FCopyInfo *inf)
+{
+	int x,y,pos;
+
+	for (y=0;y<srcheight;y++)
+	{
+		pos = y*Pitch;
+		for (x=0;x<srcwidth;x++,pos+=4)
+		{
+			int v=(unsigned char)patch[y*step_y+x*step_x];
+
+			if (palette[v].a)
+			{
+				*(uint32 *)&buffer[pos] = palette[v].d;
+			}
+		}
+	}
+}
+
+template<>
+void iCopyPaletted<cBGRA, bOverwrite>(BYTE *buffer, const BYTE * patch, int srcwidth, int srcheight, int Pitch,
+					int step_x, int step_y, int rotate, PalEntry * palette, FCopyInfo *inf)
+{
+	int x,y,pos;
+
+	for (y=0;y<srcheight;y++)
+	{
+		pos = y*Pitch;
+		for (x=0;x<srcwidth;x++,pos+=4)
+		{
+			int v=(unsigned char)patch[y*step_y+x*step_x];
+
+			*(uint32 *)&buffer[pos] = palette[v].d;
+		}
+	}
+}
+#endif
+
 typedef void (*CopyPalettedFunc)(BYTE *buffer, const BYTE * patch, int srcwidth, int srcheight, int Pitch,
 					int step_x, int step_y, int rotate, PalEntry * palette, FCopyInfo *inf);
 
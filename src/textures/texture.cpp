@@ -151,7 +151,8 @@ FTexture::FTexture (const char *name, int lumpnum)
   WidthBits(0), HeightBits(0), Scale(1,1), SourceLump(lumpnum),
   UseType(TEX_Any), bNoDecals(false), bNoRemap0(false), bWorldPanning(false),
   bMasked(true), bAlphaTexture(false), bHasCanvas(false), bWarped(0), bComplex(false), bMultiPatch(false), bKeepAround(false),
-  Rotations(0xFFFF), SkyOffset(0), Width(0), Height(0), WidthMask(0), Native(NULL)
+  bPixelCacheTracked(false),
+  Rotations(0xFFFF), SkyOffset(0), LastUsed(0), Width(0), Height(0), WidthMask(0), Native(NULL)
 {
 	id.SetInvalid();
 	if (name != NULL)
@@ -52,6 +52,8 @@
 #include "v_video.h"
 #include "r_renderer.h"
 #include "r_sky.h"
+
+#include <algorithm>
 #include "textures/textures.h"
 
 FTextureManager TexMan;
@@ -70,6 +72,8 @@ CUSTOM_CVAR(Bool, vid_nopalsubstitutions, false, CVAR_ARCHIVE)
 
 FTextureManager::FTextureManager ()
 {
+	PixelCacheSize = 0;
+	PixelFrame = 0;
 	memset (HashFirst, -1, sizeof(HashFirst));
 
 	for (int i = 0; i < 2048; ++i)
@@ -104,6 +108,8 @@ void FTextureManager::DeleteAll()
 	Textures.Clear();
 	Translation.Clear();
 	FirstTextureForFile.Clear();
+	PixelCacheList.Clear();
+	PixelCacheSize = 0;
 	memset (HashFirst, -1, sizeof(HashFirst));
 	DefaultTexture.SetInvalid();
 
@@ -167,13 +173,14 @@ FTextureID FTextureManager::CheckForTexture (const char *name, int usetype, BITF
 	{
 		return FTextureID(0);
 	}
-	i = HashFirst[MakeKey (name) % HASH_SIZE];
+	DWORD key = MakeKey (name);
+	i = HashFirst[key % HASH_SIZE];
 
 	while (i != HASH_END)
 	{
 		const FTexture *tex = Textures[i].Texture;
 
-		if (stricmp (tex->Name, name) == 0)
+		if (Textures[i].HashKey == key && stricmp (tex->Name, name) == 0)
 		{
 			// The name matches, so check the texture type
 			if (usetype == FTexture::TEX_Any)
@@ -282,13 +289,14 @@ int FTextureManager::ListTextures (const char *name, TArray<FTextureID> &list, b
 	{
 		return 0;
 	}
-	i = HashFirst[MakeKey (name) % HASH_SIZE];
+	DWORD key = MakeKey (name);
+	i = HashFirst[key % HASH_SIZE];
 
 	while (i != HASH_END)
 	{
 		const FTexture *tex = Textures[i].Texture;
 
-		if (stricmp (tex->Name, name) == 0)
+		if (Textures[i].HashKey == key && stricmp (tex->Name, name) == 0)
 		{
 			// NULL textures must be ignored.
 			if (tex->UseType!=FTexture::TEX_Null) 
@@ -360,8 +368,112 @@ void FTextureManager::UnloadAll ()
 {
 	for (unsigned int i = 0; i < Textures.Size(); ++i)
 	{
+		Textures[i].Texture->bPixelCacheTracked = false;
 		Textures[i].Texture->Unload ();
 	}
+	PixelCacheList.Clear();
+	PixelCacheSize = 0;
+}
+
+//==========================================================================
+//
+// FTextureManager :: TrackForSweep
+//
+// Called the first time a texture is handed out by one of the lookup
+// operators. The size estimate assumes paletted pixels and is an upper
+// bound, because a lookup does not necessarily load the pixels; textures
+// that never do get loaded are weeded out again by the sweep at no cost
+// since unloading them is a no-op.
+//
+//==========================================================================
+
+void FTextureManager::TrackForSweep (int picnum)
+{
+	FTexture *tex = Textures[picnum].Texture;
+
+	if (tex->bHasCanvas || tex->UseType == FTexture::TEX_Null)
+	{
+		return;
+	}
+	tex->bPixelCacheTracked = true;
+	PixelCacheList.Push (picnum);
+	PixelCacheSize += (size_t)tex->GetWidth() * tex->GetHeight();
+}
+
+//==========================================================================
+//
+// FTextureManager :: SweepPixelCache
+//
+// Called once per frame by the software renderer. When the estimated
+// size of the cached pixel data exceeds maxtexturecache, the least
+// recently referenced textures are unloaded until it fits again.
+// Textures referenced for the frame just rendered are pinned, so nothing
+// visible can be evicted.
+//
+//==========================================================================
+
+CUSTOM_CVAR (Int, maxtexturecache, 0, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
+{
+	if (self < 0)
+	{
+		self = 0;
+	}
+}
+
+void FTextureManager::SweepPixelCache ()
+{
+	PixelFrame++;
+	if (maxtexturecache <= 0 || PixelCacheSize <= (size_t)maxtexturecache << 20)
+	{
+		return;
+	}
+
+	TArray<int> keep, evict;
+	for (unsigned int i = 0; i < PixelCacheList.Size(); ++i)
+	{
+		FTexture *tex = Textures[PixelCacheList[i]].Texture;
+
+		if (!tex->bPixelCacheTracked)
+		{ // The slot was replaced since the texture was tracked.
+			continue;
+		}
+		// Textures referenced since the last sweep are pinned, and so are
+		// the component patches of multipatch textures.
+		if (tex->LastUsed + 1 >= PixelFrame || tex->bKeepAround)
+		{
+			keep.Push (PixelCacheList[i]);
+		}
+		else
+		{
+			evict.Push (PixelCacheList[i]);
+		}
+	}
+	if (evict.Size() > 0)
+	{
+		std::sort (&evict[0], &evict[0] + evict.Size(), [this](int a, int b)
+		{
+			return Textures[a].Texture->LastUsed < Textures[b].Texture->LastUsed;
+		});
+	}
+
+	size_t budget = (size_t)maxtexturecache << 20;
+	for (unsigned int i = 0; i < evict.Size(); ++i)
+	{
+		if (PixelCacheSize > budget)
+		{
+			FTexture *tex = Textures[evict[i]].Texture;
+			size_t bytes = (size_t)tex->GetWidth() * tex->GetHeight();
+
+			PixelCacheSize -= MIN (bytes, PixelCacheSize);
+			tex->bPixelCacheTracked = false;
+			tex->Unload ();
+		}
+		else
+		{
+			keep.Push (evict[i]);
+		}
+	}
+	PixelCacheList = keep;
 }
 
 //==========================================================================
@@ -374,6 +486,7 @@ FTextureID FTextureManager::AddTexture (FTexture *texture)
 {
 	int bucket;
 	int hash;
+	DWORD key = 0;
 
 	if (texture == NULL) return FTextureID(-1);
 
@@ -382,7 +495,8 @@ FTextureID FTextureManager::AddTexture (FTexture *texture)
 	// Textures without name can't be looked for
 	if (texture->Name[0] != '\0')
 	{
-		bucket = int(MakeKey (texture->Name) % HASH_SIZE);
+		key = MakeKey (texture->Name);
+		bucket = int(key % HASH_SIZE);
 		hash = HashFirst[bucket];
 	}
 	else
@@ -391,7 +505,7 @@ FTextureID FTextureManager::AddTexture (FTexture *texture)
 		hash = -1;
 	}
 
-	TextureHash hasher = { texture, hash };
+	TextureHash hasher = { texture, key, hash };
 	int trans = Textures.Push (hasher);
 	Translation.Push (trans);
 	if (bucket >= 0) HashFirst[bucket] = trans;
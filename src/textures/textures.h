@@ -163,9 +163,11 @@ public:
 							// doing it per patch.
 	BYTE bMultiPatch:1;		// This is a multipatch texture (we really could use real type info for textures...)
 	BYTE bKeepAround:1;		// This texture was used as part of a multi-patch texture. Do not free it.
+	BYTE bPixelCacheTracked:1;	// Accounted for by the texture manager's pixel cache sweep
 
 	WORD Rotations;
 	SWORD SkyOffset;
+	DWORD LastUsed;			// frame stamp of the last lookup through the texture manager
 
 	enum // UseTypes
 	{
@@ -349,13 +351,13 @@ public:
 	FTexture *operator[] (FTextureID texnum)
 	{
 		if ((unsigned)texnum.GetIndex() >= Textures.Size()) return NULL;
-		return Textures[texnum.GetIndex()].Texture;
+		return MarkUsed (texnum.GetIndex());
 	}
 	FTexture *operator[] (const char *texname)
 	{
 		FTextureID texnum = GetTexture (texname, FTexture::TEX_MiscPatch);
 		if (!texnum.Exists()) return NULL;
-		return Textures[texnum.GetIndex()].Texture;
+		return MarkUsed (texnum.GetIndex());
 	}
 	FTexture *ByIndex(int i)
 	{
@@ -373,13 +375,26 @@ public:
 		{
 			picnum = PalCheck(picnum).GetIndex();
 		}
-		return Textures[picnum].Texture;
+		return MarkUsed (picnum);
 	}
 	FTexture *operator() (const char *texname)
 	{
 		FTextureID texnum = GetTexture (texname, FTexture::TEX_MiscPatch);
 		if (texnum.texnum == -1) return NULL;
-		return Textures[Translation[texnum.texnum]].Texture;
+		return MarkUsed (Translation[texnum.texnum]);
+	}
+
+	// Stamps a texture as referenced for the pixel cache sweep and returns
+	// it. All lookups that feed the render paths come through here.
+	FTexture *MarkUsed (int picnum)
+	{
+		FTexture *tex = Textures[picnum].Texture;
+		tex->LastUsed = PixelFrame;
+		if (!tex->bPixelCacheTracked)
+		{
+			TrackForSweep (picnum);
+		}
+		return tex;
 	}
 
 	FTexture *ByIndexTranslated(int i)
@@ -443,6 +458,7 @@ public:
 	void ReplaceTexture (FTextureID picnum, FTexture *newtexture, bool free);
 
 	void UnloadAll ();
+	void SweepPixelCache ();
 
 	int NumTextures () const { return (int)Textures.Size(); }
 
@@ -484,6 +500,9 @@ private:
 
 	void InitPalettedVersions();
 
+	// Pixel cache sweeping
+	void TrackForSweep (int picnum);
+
 	// Switches
 
 	void InitSwitchList ();
@@ -494,9 +513,10 @@ private:
 	struct TextureHash
 	{
 		FTexture *Texture;
+		DWORD HashKey;		// case-folded key, so chain walks can skip most stricmps
 		int HashNext;
 	};
-	enum { HASH_END = -1, HASH_SIZE = 1027 };
+	enum { HASH_END = -1, HASH_SIZE = 4099 };
 	TArray<TextureHash> Textures;
 	TArray<int> Translation;
 	int HashFirst[HASH_SIZE];
@@ -508,6 +528,10 @@ private:
 	TArray<FSwitchDef *> mSwitchDefs;
 	TArray<FDoorAnimation> mAnimatedDoors;
 	TArray<BYTE *> BuildTileFiles;
+
+	TArray<int> PixelCacheList;		// indices of textures handed out since the last full unload
+	size_t PixelCacheSize;			// estimated bytes of cached pixel data
+	DWORD PixelFrame;
 public:
 	short sintable[2048];	// for texture warping
 	enum
@@ -37,18 +37,23 @@ void WarpBuffer(TYPE *Pixels, const TYPE *source, int width, int height, int xmu
 	{
 		unsigned timebase = unsigned(time * Speed * 40 / 28);
 		// [mxd] Rewrote to fix animation for NPo2 textures
+		// The y dependent sine offsets are the same for every column, so
+		// compute them once up front instead of twice per pixel.
+		int *yoffs = (int *)alloca(sizeof(int) * height * 2);
+		for (y = 0; y < height; y++)
+		{
+			yoffs[y*2] = (TexMan.sintable[((y*ymul + timebase * 5 + 900) >> 2) & TexMan.SINMASK]) >> 13;
+			yoffs[y*2+1] = (TexMan.sintable[((y*ymul + timebase * 3 + 700) >> 2) & TexMan.SINMASK]) >> 13;
+		}
 		for (x = 0; x < width; x++)
 		{
+			int xoff1 = (TexMan.sintable[((x*xmul + timebase * 4 + 300) >> 2) & TexMan.SINMASK]) >> 13;
+			int xoff2 = (TexMan.sintable[((x*xmul + timebase * 4 + 1200) >> 2) & TexMan.SINMASK]) >> 13;
 			TYPE *dest = Pixels + (x + ymask * x);
 			for (y = 0; y < height; y++)
 			{
-				int xt = (x + 128
-					+ ((TexMan.sintable[((y*ymul + timebase * 5 + 900) >> 2) & TexMan.SINMASK]) >> 13)
-					+ ((TexMan.sintable[((x*xmul + timebase * 4 + 300) >> 2) & TexMan.SINMASK]) >> 13)) % width;
-
-				int yt = (y + 128
-					+ ((TexMan.sintable[((y*ymul + timebase * 3 + 700) >> 2) & TexMan.SINMASK]) >> 13)
-					+ ((TexMan.sintable[((x*xmul + timebase * 4 + 1200) >> 2) & TexMan.SINMASK]) >> 13)) % height;
+				int xt = (x + 128 + yoffs[y*2] + xoff1) % width;
+				int yt = (y + 128 + yoffs[y*2+1] + xoff2) % height;
 
 				*dest++ = source[(xt + ymask * xt) + yt];
 			}
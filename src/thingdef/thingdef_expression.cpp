@@ -1341,6 +1341,26 @@ FxAddSub::FxAddSub(int o, FxExpression *l, FxExpression *r)
 //
 //==========================================================================
 
+//==========================================================================
+//
+// IsConstantValue
+//
+// Checks a constant operand for an identity value so that expressions
+// like x+0 or damage*1, common in generated and copy-pasted DECORATE,
+// don't emit an instruction for the no-op.
+//
+//==========================================================================
+
+static bool IsConstantValue(FxExpression *exp, int intval, double floatval)
+{
+	ExpVal value = static_cast<FxConstant *>(exp)->GetValue();
+	if (value.Type->GetRegType() == REGT_INT)
+	{
+		return value.GetInt() == intval;
+	}
+	return value.Type->GetRegType() == REGT_FLOAT && value.GetFloat() == floatval;
+}
+
 FxExpression *FxAddSub::Resolve(FCompileContext& ctx)
 {
 	CHECKRESOLVED();
@@ -1373,7 +1393,7 @@ FxExpression *FxAddSub::Resolve(FCompileContext& ctx)
 			int v1 = static_cast<FxConstant *>(left)->GetValue().GetInt();
 			int v2 = static_cast<FxConstant *>(right)->GetValue().GetInt();
 
-			v =	Operator == '+'? v1 + v2 : 
+			v =	Operator == '+'? v1 + v2 :
 				Operator == '-'? v1 - v2 : 0;
 
 			FxExpression *e = new FxConstant(v, ScriptPosition);
@@ -1382,6 +1402,22 @@ FxExpression *FxAddSub::Resolve(FCompileContext& ctx)
 
 		}
 	}
+	else if (Operator == '+' && left->isConstant() && IsConstantValue(left, 0, 0) &&
+		right->ValueType->GetRegType() == ValueType->GetRegType())
+	{ // 0 + x is x
+		FxExpression *e = right;
+		right = NULL;
+		delete this;
+		return e;
+	}
+	else if (right->isConstant() && IsConstantValue(right, 0, 0) &&
+		left->ValueType->GetRegType() == ValueType->GetRegType())
+	{ // x + 0 and x - 0 are x
+		FxExpression *e = left;
+		left = NULL;
+		delete this;
+		return e;
+	}
 	Promote(ctx);
 	return this;
 }
@@ -1514,8 +1550,8 @@ FxExpression *FxMulDiv::Resolve(FCompileContext& ctx)
 				return NULL;
 			}
 
-			v =	Operator == '*'? v1 * v2 : 
-				Operator == '/'? v1 / v2 : 
+			v =	Operator == '*'? v1 * v2 :
+				Operator == '/'? v1 / v2 :
 				Operator == '%'? v1 % v2 : 0;
 
 			FxExpression *e = new FxConstant(v, ScriptPosition);
@@ -1524,6 +1560,22 @@ FxExpression *FxMulDiv::Resolve(FCompileContext& ctx)
 
 		}
 	}
+	else if (Operator == '*' && left->isConstant() && IsConstantValue(left, 1, 1) &&
+		right->ValueType->GetRegType() == ValueType->GetRegType())
+	{ // 1 * x is x
+		FxExpression *e = right;
+		right = NULL;
+		delete this;
+		return e;
+	}
+	else if (Operator != '%' && right->isConstant() && IsConstantValue(right, 1, 1) &&
+		left->ValueType->GetRegType() == ValueType->GetRegType())
+	{ // x * 1 and x / 1 are x
+		FxExpression *e = left;
+		left = NULL;
+		delete this;
+		return e;
+	}
 	Promote(ctx);
 	return this;
 }
@@ -2023,13 +2075,13 @@ FxExpression *FxBinaryLogical::Resolve(FCompileContext& ctx)
 	{
 		if (b_left==0 || b_right==0)
 		{
-			FxExpression *x = new FxConstant(true, ScriptPosition);
+			FxExpression *x = new FxConstant(false, ScriptPosition);
 			delete this;
 			return x;
 		}
 		else if (b_left==1 && b_right==1)
 		{
-			FxExpression *x = new FxConstant(false, ScriptPosition);
+			FxExpression *x = new FxConstant(true, ScriptPosition);
 			delete this;
 			return x;
 		}
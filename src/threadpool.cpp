@@ -0,0 +1,187 @@
+/*
+** threadpool.cpp
+**
+** simple worker thread pool for data-parallel loading tasks
+**
+**---------------------------------------------------------------------------
+** Copyright 2017 GZDoom contributors
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+*/
+
+#include "threadpool.h"
+#include "templates.h"
+
+//==========================================================================
+//
+// FThreadPool :: Instance
+//
+//==========================================================================
+
+FThreadPool &FThreadPool::Instance()
+{
+	static FThreadPool pool;
+	return pool;
+}
+
+//==========================================================================
+//
+// FThreadPool :: FThreadPool
+//
+// One worker per hardware thread, minus one for the calling thread.
+//
+//==========================================================================
+
+FThreadPool::FThreadPool()
+{
+	NextIndex = 0;
+
+	int numthreads = (int)std::thread::hardware_concurrency() - 1;
+	for (int i = 0; i < numthreads; i++)
+	{
+		Workers.emplace_back(&FThreadPool::WorkerMain, this);
+	}
+}
+
+//==========================================================================
+//
+// FThreadPool :: ~FThreadPool
+//
+//==========================================================================
+
+FThreadPool::~FThreadPool()
+{
+	{
+		std::unique_lock<std::mutex> lock(Mutex);
+		ExitFlag = true;
+	}
+	WakeCondition.notify_all();
+	for (auto &worker : Workers)
+	{
+		worker.join();
+	}
+}
+
+//==========================================================================
+//
+// FThreadPool :: ParallelFor
+//
+//==========================================================================
+
+void FThreadPool::ParallelFor(int count, const std::function<void(int)> &func)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+	if (count == 1 || Workers.empty())
+	{
+		for (int i = 0; i < count; i++)
+		{
+			func(i);
+		}
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(Mutex);
+		JobFunc = &func;
+		JobCount = count;
+		// Hand out work in chunks so that tiny per-item jobs don't bounce
+		// the shared index between all cores for every single item.
+		ChunkSize = MAX(1, count / (NumThreads() * 8));
+		NextIndex = 0;
+		NumWorking = (int)Workers.size();
+		Generation++;
+	}
+	WakeCondition.notify_all();
+
+	// The calling thread processes its share of the range, too.
+	DoWork();
+
+	std::unique_lock<std::mutex> lock(Mutex);
+	DoneCondition.wait(lock, [this] { return NumWorking == 0; });
+	JobFunc = nullptr;
+}
+
+//==========================================================================
+//
+// FThreadPool :: DoWork
+//
+// Pulls chunks off the shared range until it is exhausted.
+//
+//==========================================================================
+
+void FThreadPool::DoWork()
+{
+	for (;;)
+	{
+		int start = NextIndex.fetch_add(ChunkSize);
+		if (start >= JobCount)
+		{
+			break;
+		}
+		int end = MIN(start + ChunkSize, JobCount);
+		for (int i = start; i < end; i++)
+		{
+			(*JobFunc)(i);
+		}
+	}
+}
+
+//==========================================================================
+//
+// FThreadPool :: WorkerMain
+//
+//==========================================================================
+
+void FThreadPool::WorkerMain()
+{
+	int generation = 0;
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(Mutex);
+			WakeCondition.wait(lock, [&] { return ExitFlag || Generation != generation; });
+			if (ExitFlag)
+			{
+				return;
+			}
+			generation = Generation;
+		}
+
+		DoWork();
+
+		{
+			std::unique_lock<std::mutex> lock(Mutex);
+			if (--NumWorking == 0)
+			{
+				DoneCondition.notify_all();
+			}
+		}
+	}
+}
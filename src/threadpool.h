@@ -0,0 +1,94 @@
+/*
+** threadpool.h
+**
+** simple worker thread pool for data-parallel loading tasks
+**
+**---------------------------------------------------------------------------
+** Copyright 2017 GZDoom contributors
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+*/
+
+#ifndef __THREADPOOL_H
+#define __THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//==========================================================================
+//
+// FThreadPool
+//
+// A fixed set of worker threads that sleep until a data-parallel job is
+// submitted. Jobs are plain index ranges; the calling thread always
+// participates in processing so a pool is never slower than a serial loop.
+// The workers are started lazily on first use, so code that never submits
+// a job (e.g. dedicated servers with -stdout parsing only) pays nothing.
+//
+//==========================================================================
+
+class FThreadPool
+{
+public:
+	~FThreadPool();
+
+	// The global pool shared by all loading code.
+	static FThreadPool &Instance();
+
+	// Calls func(i) once for every i in [0, count), distributing the range
+	// across all workers and the calling thread. Returns when the whole
+	// range has been processed. func must not submit jobs itself.
+	void ParallelFor(int count, const std::function<void(int)> &func);
+
+	// Number of threads that will process a job, including the caller.
+	int NumThreads() const { return (int)Workers.size() + 1; }
+
+private:
+	FThreadPool();
+
+	void WorkerMain();
+	void DoWork();
+
+	std::vector<std::thread> Workers;
+	std::mutex Mutex;
+	std::condition_variable WakeCondition;
+	std::condition_variable DoneCondition;
+
+	const std::function<void(int)> *JobFunc = nullptr;
+	std::atomic<int> NextIndex;
+	int JobCount = 0;
+	int ChunkSize = 1;
+	int Generation = 0;
+	int NumWorking = 0;
+	bool ExitFlag = false;
+};
+
+#endif
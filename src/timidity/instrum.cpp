@@ -641,6 +641,11 @@ static int fill_bank(Renderer *song, int dr, int b)
 	return errors;
 }
 
+// The tone banks and drum sets are process-wide globals, so the patches
+// loaded and converted here survive the Renderer that requested them and
+// are shared by every later TimidityMIDIDevice. A song change therefore
+// only ever loads instruments that no previous song has used; nothing is
+// freed before FreeAll() at shutdown.
 int Renderer::load_missing_instruments()
 {
 	int i = MAXBANK, errors = 0;
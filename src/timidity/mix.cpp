@@ -29,6 +29,12 @@
 #include "templates.h"
 #include "c_cvars.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__i386__) || defined(__amd64__)
+#define TIMIDITY_MIX_SSE2
+#include <emmintrin.h>
+#include "x86.h"
+#endif
+
 namespace Timidity
 {
 
@@ -426,13 +432,63 @@ static int update_signal(Voice *v)
 	return 0;
 }
 
+/* Mixes a run of samples into an interleaved stereo buffer with constant
+   amplitudes. This is the inner loop of the mixers below; on x86 it
+   processes two samples (one output vector) per step when SSE2 is
+   available. */
+static void mix_stereo_run(const sample_t *sp, float *lp, final_volume_t left, final_volume_t right, int count)
+{
+#ifdef TIMIDITY_MIX_SSE2
+	if (CPU.bSSE2)
+	{
+		__m128 amps = _mm_setr_ps(left, right, left, right);
+		while (count >= 2)
+		{
+			__m128 s = _mm_castpd_ps(_mm_load_sd((const double *)sp));
+			s = _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 0, 0));
+			_mm_storeu_ps(lp, _mm_add_ps(_mm_loadu_ps(lp), _mm_mul_ps(s, amps)));
+			sp += 2;
+			lp += 4;
+			count -= 2;
+		}
+	}
+#endif
+	while (count--)
+	{
+		sample_t s = *sp++;
+		lp[0] += left * s;
+		lp[1] += right * s;
+		lp += 2;
+	}
+}
+
+static void mix_mono_run(const sample_t *sp, float *lp, final_volume_t amp, int count)
+{
+#ifdef TIMIDITY_MIX_SSE2
+	if (CPU.bSSE2)
+	{
+		__m128 amps = _mm_set1_ps(amp);
+		while (count >= 4)
+		{
+			_mm_storeu_ps(lp, _mm_add_ps(_mm_loadu_ps(lp), _mm_mul_ps(_mm_loadu_ps(sp), amps)));
+			sp += 4;
+			lp += 4;
+			count -= 4;
+		}
+	}
+#endif
+	while (count--)
+	{
+		*lp++ += *sp++ * amp;
+	}
+}
+
 static void mix_mystery_signal(SDWORD control_ratio, const sample_t *sp, float *lp, Voice *v, int count)
 {
-	final_volume_t 
-		left = v->left_mix, 
+	final_volume_t
+		left = v->left_mix,
 		right = v->right_mix;
 	int cc;
-	sample_t s;
 
 	if (!(cc = v->control_counter))
 	{
@@ -449,13 +505,9 @@ static void mix_mystery_signal(SDWORD control_ratio, const sample_t *sp, float *
 		if (cc < count)
 		{
 			count -= cc;
-			while (cc--)
-			{
-				s = *sp++;
-				lp[0] += left * s;
-				lp[1] += right * s;
-				lp += 2;
-			}
+			mix_stereo_run(sp, lp, left, right, cc);
+			sp += cc;
+			lp += cc * 2;
 			cc = control_ratio;
 			if (update_signal(v))
 				return;	/* Envelope ran out */
@@ -465,13 +517,7 @@ static void mix_mystery_signal(SDWORD control_ratio, const sample_t *sp, float *
 		else
 		{
 			v->control_counter = cc - count;
-			while (count--)
-			{
-				s = *sp++;
-				lp[0] += left * s;
-				lp[1] += right * s;
-				lp += 2;
-			}
+			mix_stereo_run(sp, lp, left, right, count);
 			return;
 		}
 	}
@@ -547,10 +593,9 @@ static void mix_mono_signal(SDWORD control_ratio, const sample_t *sp, float *lp,
 		if (cc < count)
 		{
 			count -= cc;
-			while (cc--)
-			{
-				*lp++ += *sp++ * left;
-			}
+			mix_mono_run(sp, lp, left, cc);
+			sp += cc;
+			lp += cc;
 			cc = control_ratio;
 			if (update_signal(v))
 				return;	/* Envelope ran out */
@@ -559,10 +604,7 @@ static void mix_mono_signal(SDWORD control_ratio, const sample_t *sp, float *lp,
 		else
 		{
 			v->control_counter = cc - count;
-			while (count--)
-			{
-				*lp++ += *sp++ * left;
-			}
+			mix_mono_run(sp, lp, left, count);
 			return;
 		}
 	}
@@ -570,20 +612,11 @@ static void mix_mono_signal(SDWORD control_ratio, const sample_t *sp, float *lp,
 
 static void mix_mystery(SDWORD control_ratio, const sample_t *sp, float *lp, Voice *v, int count)
 {
-	final_volume_t 
-		left = v->left_mix, 
-		right = v->right_mix;
-	sample_t s;
-
-	while (count--)
-	{
-		s = *sp++;
-		lp[0] += s * left;
-		lp[1] += s * right;
-		lp += 2;
-	}
+	mix_stereo_run(sp, lp, v->left_mix, v->right_mix, count);
 }
 
+/* The single-channel mixes stay scalar: a 4-wide store through the offset
+   right channel pointer would touch one float past the buffer end. */
 static void mix_single(const sample_t *sp, float *lp, final_volume_t amp, int count)
 {
 	while (count--)
@@ -604,13 +637,7 @@ static void mix_single_right(const sample_t *sp, float *lp, Voice *v, int count)
 
 static void mix_mono(const sample_t *sp, float *lp, Voice *v, int count)
 {
-	final_volume_t 
-		left = v->left_mix;
-
-	while (count--)
-	{
-		*lp++ += *sp++ * left;
-	}
+	mix_mono_run(sp, lp, v->left_mix, count);
 }
 
 /* Ramp a note out in c samples */
@@ -83,6 +83,7 @@ The FON2 header is followed by variable length data:
 #include "doomtype.h"
 #include "m_swap.h"
 #include "v_font.h"
+#include "v_text.h"
 #include "v_video.h"
 #include "w_wad.h"
 #include "i_system.h"
@@ -459,6 +460,7 @@ FFont::FFont (const char *name, const char *nametemplate, int first, int count,
 
 FFont::~FFont ()
 {
+	V_ClearBrokenLinesCache (this);
 	if (Chars)
 	{
 		int count = LastChar - FirstChar + 1;
@@ -223,17 +223,23 @@ static void breakit (FBrokenLines *line, FFont *font, const BYTE *start, const B
 	line->Width = font->StringWidth (line->Text);
 }
 
-FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const BYTE *string, bool preservecolor)
+static FBrokenLines *BreakLines (FFont *font, int maxwidth, const BYTE *string, bool preservecolor)
 {
 	FBrokenLines lines[128];	// Support up to 128 lines (should be plenty)
 
 	const BYTE *space = NULL, *start = string;
 	size_t i, ii;
 	int c, w, nw;
+	int widths[256];			// direct character width LUT, filled as needed
 	FString lastcolor, linecolor;
 	bool lastWasSpace = false;
 	int kerning = font->GetDefaultKerning ();
 
+	for (ii = 0; ii < countof(widths); ++ii)
+	{
+		widths[ii] = -1;
+	}
+
 	i = w = 0;
 
 	while ( (c = *string++) && i < countof(lines) )
@@ -276,7 +282,13 @@ FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const BYTE *string, bool
 			lastWasSpace = false;
 		}
 
-		nw = font->GetCharWidth (c);
+		// GetCharWidth goes through the character code translation every
+		// time, so remember each width the first time it is measured.
+		nw = widths[c];
+		if (nw < 0)
+		{
+			widths[c] = nw = font->GetCharWidth (c);
+		}
 
 		if ((w > 0 && w + nw > maxwidth) || c == '\n')
 		{ // Time to break the line
@@ -339,6 +351,108 @@ FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const BYTE *string, bool
 	return broken;
 }
 
+//==========================================================================
+//
+// V_BreakLines
+//
+// The status bar log display and the intermission screen break the same
+// text with the same parameters every frame, so a small cache of recent
+// layouts is kept. The cache stores its own copies; callers still own
+// and free what they get back.
+//
+//==========================================================================
+
+struct FBrokenLinesCacheEntry
+{
+	FFont *Font;
+	int MaxWidth;
+	bool PreserveColor;
+	FString Text;
+	FBrokenLines *Lines;
+	unsigned int LastUse;
+};
+
+static FBrokenLinesCacheEntry BrokenLinesCache[8];
+static unsigned int BrokenLinesCacheTime;
+
+static FBrokenLines *CopyBrokenLines (const FBrokenLines *lines)
+{
+	int count = 0;
+
+	while (lines[count].Width != -1)
+	{
+		count++;
+	}
+
+	FBrokenLines *copy = new FBrokenLines[count + 1];
+	for (int i = 0; i < count; ++i)
+	{
+		copy[i] = lines[i];
+	}
+	copy[count].Width = -1;
+	return copy;
+}
+
+FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const BYTE *string, bool preservecolor)
+{
+	FBrokenLinesCacheEntry *entry = &BrokenLinesCache[0];
+
+	BrokenLinesCacheTime++;
+	for (size_t i = 0; i < countof(BrokenLinesCache); ++i)
+	{
+		FBrokenLinesCacheEntry *probe = &BrokenLinesCache[i];
+
+		if (probe->Lines != NULL && probe->Font == font && probe->MaxWidth == maxwidth &&
+			probe->PreserveColor == preservecolor && probe->Text.Compare ((const char *)string) == 0)
+		{
+			probe->LastUse = BrokenLinesCacheTime;
+			return CopyBrokenLines (probe->Lines);
+		}
+		if (probe->LastUse < entry->LastUse)
+		{ // remember the least recently used slot for replacement
+			entry = probe;
+		}
+	}
+
+	FBrokenLines *broken = BreakLines (font, maxwidth, string, preservecolor);
+
+	if (entry->Lines != NULL)
+	{
+		delete[] entry->Lines;
+	}
+	entry->Font = font;
+	entry->MaxWidth = maxwidth;
+	entry->PreserveColor = preservecolor;
+	entry->Text = (const char *)string;
+	entry->Lines = CopyBrokenLines (broken);
+	entry->LastUse = BrokenLinesCacheTime;
+
+	return broken;
+}
+
+//==========================================================================
+//
+// V_ClearBrokenLinesCache
+//
+// Called when a font is destroyed so the cache cannot match a new font
+// that happens to be allocated at the same address.
+//
+//==========================================================================
+
+void V_ClearBrokenLinesCache (FFont *font)
+{
+	for (size_t i = 0; i < countof(BrokenLinesCache); ++i)
+	{
+		if (BrokenLinesCache[i].Lines != NULL && BrokenLinesCache[i].Font == font)
+		{
+			delete[] BrokenLinesCache[i].Lines;
+			BrokenLinesCache[i].Lines = NULL;
+			BrokenLinesCache[i].Text = "";
+			BrokenLinesCache[i].LastUse = 0;
+		}
+	}
+}
+
 void V_FreeBrokenLines (FBrokenLines *lines)
 {
 	if (lines)
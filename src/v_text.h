@@ -77,6 +77,7 @@ struct FBrokenLines
 
 FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const BYTE *str, bool preservecolor = false);
 void V_FreeBrokenLines (FBrokenLines *lines);
+void V_ClearBrokenLinesCache (FFont *font);
 inline FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const char *str, bool preservecolor = false)
  { return V_BreakLines (font, maxwidth, (const BYTE *)str, preservecolor); }
 inline FBrokenLines *V_BreakLines (FFont *font, int maxwidth, const FString &str, bool preservecolor = false)
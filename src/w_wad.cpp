@@ -57,6 +57,7 @@
 #include "resourcefiles/resourcefile.h"
 #include "md5.h"
 #include "doomstat.h"
+#include "startupcache.h"
 
 // MACROS ------------------------------------------------------------------
 
@@ -243,15 +244,28 @@ void FWadCollection::AddFile (const char *filename, FileReader *wadinfo)
 
 		if (!isdir)
 		{
-			try
+			// Try to map the file into memory first. Uncompressed lumps can
+			// then be handed out straight from the mapping without being
+			// copied into separate cache buffers, and the OS only pages in
+			// what actually gets accessed.
+			MemoryMappedFileReader *mapped = new MemoryMappedFileReader;
+			if (mapped->Open(filename))
 			{
-				wadinfo = new FileReader(filename);
+				wadinfo = mapped;
 			}
-			catch (CRecoverableError &err)
-			{ // Didn't find file
-				Printf (TEXTCOLOR_RED "%s\n", err.GetMessage());
-				PrintLastError ();
-				return;
+			else
+			{
+				delete mapped;
+				try
+				{
+					wadinfo = new FileReader(filename);
+				}
+				catch (CRecoverableError &err)
+				{ // Didn't find file
+					Printf (TEXTCOLOR_RED "%s\n", err.GetMessage());
+					PrintLastError ();
+					return;
+				}
 			}
 		}
 	}
@@ -925,10 +939,7 @@ void FWadCollection::RenameNerve ()
 			// cheaper way to know this is not the file
 			continue;
 		}
-		fr->Seek(0, SEEK_SET);
-		MD5Context md5;
-		md5.Update(fr, fr->GetLength());
-		md5.Final(cksum);
+		StartupCache.GetFileMD5(GetWadFullName(w), fr, cksum);
 		if (memcmp(nerve, cksum, 16) == 0)
 		{
 			found = true;
@@ -989,12 +1000,8 @@ void FWadCollection::FixMacHexen()
 		return;
 	}
 
-	reader->Seek(0, SEEK_SET);
-
 	BYTE checksum[16];
-	MD5Context md5;
-	md5.Update(reader, iwadSize);
-	md5.Final(checksum);
+	StartupCache.GetFileMD5(GetWadFullName(IWAD_FILENUM), reader, checksum);
 
 	static const BYTE HEXEN_DEMO_MD5[16] =
 	{
@@ -1603,6 +1610,14 @@ char *FWadLump::Gets(char *strbuf, int len)
 	return strbuf;
 }
 
+const char *FWadLump::GetBuffer() const
+{
+	// Cache-backed lumps - which includes everything served out of a memory
+	// mapped archive - can expose their data as one contiguous block, so
+	// consumers that want the whole lump do not need to copy it first.
+	return Lump != NULL ? Lump->Cache : NULL;
+}
+
 // FMemLump -----------------------------------------------------------------
 
 FMemLump::FMemLump ()
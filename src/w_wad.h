@@ -109,6 +109,7 @@ public:
 	long Seek (long offset, int origin);
 	long Read (void *buffer, long len);
 	char *Gets(char *strbuf, int len);
+	const char *GetBuffer() const;
 
 private:
 	FWadLump (FResourceLump *Lump, bool alwayscache = false);
@@ -321,20 +321,13 @@ static bool IsExMy(const char * name)
 	return (tolower(name[0])=='e' && name[1]>='1' && name[1]<='3' && tolower(name[2])=='m');
 }
 
-void WI_LoadBackground(bool isenterpic)
+static const char *WI_GetBackground(bool isenterpic, const char *levelcur, const char *levelnext, char (&buffer)[10])
 {
 	const char *lumpname = NULL;
-	char buffer[10];
-	in_anim_t an;
-	lnode_t pt;
-	FTextureID texture;
-
-	bcnt=0;
 
-	texture.SetInvalid();
 	if (isenterpic)
 	{
-		level_info_t * li = FindLevelInfo(wbs->next);
+		level_info_t * li = FindLevelInfo(levelnext);
 		if (li != NULL) lumpname = li->EnterPic;
 	}
 	else
@@ -343,7 +336,7 @@ void WI_LoadBackground(bool isenterpic)
 	}
 
 	// Try to get a default if nothing specified
-	if (lumpname == NULL || lumpname[0]==0) 
+	if (lumpname == NULL || lumpname[0]==0)
 	{
 		lumpname = NULL;
 		switch(gameinfo.gametype)
@@ -352,31 +345,31 @@ void WI_LoadBackground(bool isenterpic)
 		case GAME_Doom:
 			if (!(gameinfo.flags & GI_MAPxx))
 			{
-				const char *level = isenterpic ? wbs->next : wbs->current;
+				const char *level = isenterpic ? levelnext : levelcur;
 				if (IsExMy(level))
 				{
 					mysnprintf(buffer, countof(buffer), "$IN_EPI%c", level[1]);
 					lumpname = buffer;
 				}
 			}
-			if (!lumpname) 
+			if (!lumpname)
 			{
-				if (isenterpic) 
+				if (isenterpic)
 				{
 					// One special case needs to be handled here!
 					// If going from E1-E3 to E4 the default should be used, not the exit pic.
 
 					// Not if the exit pic is user defined!
-					if (level.info->ExitPic.IsNotEmpty()) return;
+					if (level.info->ExitPic.IsNotEmpty()) return NULL;
 
 					// E1-E3 need special treatment when playing Doom 1.
 					if (!(gameinfo.flags & GI_MAPxx))
 					{
 						// not if the last level is not from the first 3 episodes
-						if (!IsExMy(wbs->current)) return;
+						if (!IsExMy(levelcur)) return NULL;
 
 						// not if the next level is one of the first 3 episodes
-						if (IsExMy(wbs->next)) return;
+						if (IsExMy(levelnext)) return NULL;
 					}
 				}
 				lumpname = "INTERPIC";
@@ -386,36 +379,50 @@ void WI_LoadBackground(bool isenterpic)
 		case GAME_Heretic:
 			if (isenterpic)
 			{
-				if (IsExMy(wbs->next))
+				if (IsExMy(levelnext))
 				{
-					mysnprintf(buffer, countof(buffer), "$IN_HTC%c", wbs->next[1]);
+					mysnprintf(buffer, countof(buffer), "$IN_HTC%c", levelnext[1]);
 					lumpname = buffer;
 				}
 			}
-			if (!lumpname) 
+			if (!lumpname)
 			{
-				if (isenterpic) return;
+				if (isenterpic) return NULL;
 				lumpname = "FLOOR16";
 			}
 			break;
 
 		case GAME_Hexen:
-			if (isenterpic) return;
+			if (isenterpic) return NULL;
 			lumpname = "INTERPIC";
 			break;
 
 		case GAME_Strife:
 		default:
 			// Strife doesn't have an intermission pic so choose something neutral.
-			if (isenterpic) return;
+			if (isenterpic) return NULL;
 			lumpname = gameinfo.BorderFlat;
 			break;
 		}
 	}
+	return lumpname;
+}
+
+void WI_LoadBackground(bool isenterpic)
+{
+	const char *lumpname;
+	char buffer[10];
+	in_anim_t an;
+	lnode_t pt;
+	FTextureID texture;
+
+	bcnt=0;
+
+	texture.SetInvalid();
+	lumpname = WI_GetBackground(isenterpic, wbs->current, wbs->next, buffer);
 	if (lumpname == NULL)
 	{
-		// shouldn't happen!
-		background = NULL;
+		// no default available - keep whatever the previous screen set.
 		return;
 	}
 
@@ -592,7 +599,70 @@ void WI_LoadBackground(bool isenterpic)
 }
 
 //====================================================================
-// 
+//
+//	Marks the intermission backgrounds for this level's exit in a
+//	precache hit list. Which art the intermission will use is known
+//	from MAPINFO as soon as the level is loaded, so adding it to the
+//	level's own precache decodes it during the load screen instead of
+//	at the moment of exit, and keeps it loaded across the unload pass
+//	of the following maps - within an episode it is the same art for
+//	every transition. Animation frames are small patches and are left
+//	to load on demand; the full screen background is what hitches.
+//
+//====================================================================
+
+static void WI_MarkBackground(const char *lumpname, BYTE *hitlist)
+{
+	FTextureID texture;
+
+	if (lumpname == NULL) return;
+
+	// a name with a starting '$' indicates an intermission script
+	if (*lumpname != '$')
+	{
+		texture = TexMan.CheckForTexture(lumpname, FTexture::TEX_MiscPatch, FTextureManager::TEXMAN_TryAny);
+	}
+	else
+	{
+		int lumpnum = Wads.CheckNumForFullName(lumpname+1, true);
+		if (lumpnum < 0) return;
+
+		// Only the Background command matters here so everything else
+		// can be skipped over as noise. The real parse with its error
+		// checking still happens in WI_LoadBackground.
+		FScanner sc(lumpnum);
+		texture.SetInvalid();
+		while (sc.GetString())
+		{
+			if (sc.Compare("Background") && sc.GetString())
+			{
+				texture = TexMan.CheckForTexture(sc.String, FTexture::TEX_MiscPatch, FTextureManager::TEXMAN_TryAny);
+				break;
+			}
+		}
+	}
+	if (texture.Exists())
+	{
+		hitlist[texture.GetIndex()] |= FTextureManager::HIT_Wall;
+	}
+}
+
+void WI_MarkBackgroundTextures(BYTE *hitlist)
+{
+	char buffer[10];
+
+	if (level.NextMap.Len() == 0 || !level.NextMap.Compare("enDSeQ", 6)) return;
+
+	WI_MarkBackground(WI_GetBackground(false, level.MapName, level.NextMap, buffer), hitlist);
+	WI_MarkBackground(WI_GetBackground(true, level.MapName, level.NextMap, buffer), hitlist);
+	if (level.NextSecretMap.Len() > 0 && level.NextSecretMap.Compare(level.NextMap) != 0 && level.NextSecretMap.Compare("enDSeQ", 6))
+	{
+		WI_MarkBackground(WI_GetBackground(true, level.MapName, level.NextSecretMap, buffer), hitlist);
+	}
+}
+
+//====================================================================
+//
 //	made this more generic and configurable through a script
 //	Removed all the ugly special case handling for different game modes
 //
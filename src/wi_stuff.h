@@ -87,4 +87,7 @@ void WI_Drawer ();
 // Setup for an intermission screen.
 void WI_Start (wbstartstruct_t *wbstartstruct);
 
+// Marks the backgrounds this level's exit will use in a precache hit list.
+void WI_MarkBackgroundTextures (BYTE *hitlist);
+
 #endif
@@ -66,7 +66,7 @@ FString::FString (const char *copyStr)
 {
 	if (copyStr == NULL || *copyStr == '\0')
 	{
-		NullString.RefCount++;
+		StringRefIncrement(NullString.RefCount);
 		Chars = &NullString.Nothing[0];
 	}
 	else
@@ -79,15 +79,23 @@ FString::FString (const char *copyStr)
 
 FString::FString (const char *copyStr, size_t len)
 {
-	AllocBuffer (len);
-	StrCopy (Chars, copyStr, len);
+	if (len == 0)
+	{
+		StringRefIncrement(NullString.RefCount);
+		Chars = &NullString.Nothing[0];
+	}
+	else
+	{
+		AllocBuffer (len);
+		StrCopy (Chars, copyStr, len);
+	}
 }
 
 FString::FString (char oneChar)
 {
 	if (oneChar == '\0')
 	{
-		NullString.RefCount++;
+		StringRefIncrement(NullString.RefCount);
 		Chars = &NullString.Nothing[0];
 	}
 	else
@@ -220,7 +228,7 @@ FString &FString::operator = (const char *copyStr)
 		if (copyStr == NULL || *copyStr == '\0')
 		{
 			Data()->Release();
-			NullString.RefCount++;
+			StringRefIncrement(NullString.RefCount);
 			Chars = &NullString.Nothing[0];
 		}
 		else
@@ -362,7 +370,7 @@ FString &FString::CopyCStrPart(const char *tail, size_t tailLen)
 	else
 	{
 		Data()->Release();
-		NullString.RefCount++;
+		StringRefIncrement(NullString.RefCount);
 		Chars = &NullString.Nothing[0];
 	}
 	return *this;
@@ -373,7 +381,7 @@ void FString::Truncate(long newlen)
 	if (newlen <= 0)
 	{
 		Data()->Release();
-		NullString.RefCount++;
+		StringRefIncrement(NullString.RefCount);
 		Chars = &NullString.Nothing[0];
 	}
 	else if (newlen < (long)Len())
@@ -65,6 +65,19 @@
 #endif
 
 
+// Strings are created and released on worker threads while archives are
+// being loaded, so the reference counts must be maintained atomically.
+// Locking a buffer (RefCount < 0) remains a main-thread-only operation.
+#ifdef _MSC_VER
+extern "C" long _InterlockedIncrement(long volatile *);
+extern "C" long _InterlockedDecrement(long volatile *);
+inline int StringRefIncrement(int &count) { return (int)_InterlockedIncrement((long volatile *)&count); }
+inline int StringRefDecrement(int &count) { return (int)_InterlockedDecrement((long volatile *)&count); }
+#else
+inline int StringRefIncrement(int &count) { return __atomic_add_fetch(&count, 1, __ATOMIC_SEQ_CST); }
+inline int StringRefDecrement(int &count) { return __atomic_sub_fetch(&count, 1, __ATOMIC_SEQ_CST); }
+#endif
+
 struct FStringData
 {
 	unsigned int Len;		// Length of string, excluding terminating null
@@ -90,7 +103,7 @@ struct FStringData
 		}
 		else
 		{
-			RefCount++;
+			StringRefIncrement(RefCount);
 			return (char *)(this + 1);
 		}
 	}
@@ -99,7 +112,7 @@ struct FStringData
 	{
 		assert (RefCount != 0);
 
-		if (--RefCount <= 0)
+		if (StringRefDecrement(RefCount) <= 0)
 		{
 			Dealloc();
 		}
@@ -127,7 +140,7 @@ enum ELumpNum
 class FString
 {
 public:
-	FString () : Chars(&NullString.Nothing[0]) { NullString.RefCount++; }
+	FString () : Chars(&NullString.Nothing[0]) { StringRefIncrement(NullString.RefCount); }
 
 	// Copy constructors
 	FString (const FString &other) { AttachToOther (other); }
@@ -52,11 +52,16 @@ uniform mat4 uQuadTexCoords;
 uniform int uQuadMode;
 #endif
 
-// matrices
-uniform mat4 ProjectionMatrix;
-uniform mat4 ViewMatrix;
+// matrices. The viewpoint matrices are shared between all shaders through
+// one uniform block so that a view change is a single buffer upload; the
+// per-object matrices remain plain uniforms.
+/*layout(std140)*/ uniform ViewpointUBO
+{
+	mat4 ProjectionMatrix;
+	mat4 ViewMatrix;
+	mat4 NormalViewMatrix;
+};
 uniform mat4 ModelMatrix;
-uniform mat4 NormalViewMatrix;
 uniform mat4 NormalModelMatrix;
 uniform mat4 TextureMatrix;
 